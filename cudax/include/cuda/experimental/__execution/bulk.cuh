@@ -0,0 +1,337 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_ASYNC_DETAIL_BULK
+#define __CUDAX_ASYNC_DETAIL_BULK
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cccl/unreachable.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_callable.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/void_t.h>
+
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/concepts.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/exception.cuh>
+#include <cuda/experimental/__execution/meta.cuh>
+#include <cuda/experimental/__execution/policy.cuh>
+#include <cuda/experimental/__execution/rcvr_ref.cuh>
+#include <cuda/experimental/__execution/transform_sender.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+#include <cuda/experimental/__execution/visit.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief The arguments of a `bulk` or `bulk_chunked` sender, besides its predecessor.
+template <class _Shape, class _Fn>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __bulk_data_t
+{
+  execution_policy __policy_;
+  _Shape __shape_;
+  _Fn __fn_;
+};
+
+//! @brief `bulk(sndr, policy, shape, fn)` completes with the values of `sndr` after calling `fn(i, values...)` for
+//! each `i` in `[0, shape)`, and `bulk_chunked(sndr, policy, shape, fn)` after calling `fn(begin, end, values...)` for
+//! subranges `[begin, end)` which together cover `[0, shape)`. The values are passed to `fn` as lvalues.
+//!
+//! By default, the calls are made one after the other on the execution agent on which `sndr` completes, whatever the
+//! policy, and `bulk_chunked` calls `fn` once for the whole range. Schedulers which can run the calls in parallel
+//! customize both algorithms through their domain, when the policy allows it.
+template <bool _Chunked>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT _CCCL_PREFERRED_NAME(bulk_t) _CCCL_PREFERRED_NAME(bulk_chunked_t) __bulk_t
+{
+  //! @brief Calls the function for the indices in `[__begin, __end)`: once with the whole range for `bulk_chunked`,
+  //! and once per index for `bulk`.
+  struct __run_fn
+  {
+    _CCCL_EXEC_CHECK_DISABLE
+    template <class _Fn, class _Shape, class... _Ts>
+    _CCCL_API void operator()(_Fn& __fn, _Shape __begin, _Shape __end, _Ts&... __ts) const
+      noexcept(noexcept(__fn(__begin, __end, __ts...)))
+    {
+      __fn(__begin, __end, __ts...);
+    }
+  };
+
+  template <class _Shape, class _Fn, class... _Ts>
+  static constexpr bool __nothrow_run = __nothrow_callable<_Fn&, _Shape, _Shape, _Ts&...>;
+
+  template <class _Shape, class _Fn, class... _Ts>
+  static constexpr bool __can_run = _CUDA_VSTD::__is_callable_v<_Fn&, _Shape, _Shape, _Ts&...>;
+
+private:
+  template <class _Rcvr, class _CvSndr, class _Shape, class _Fn>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t
+  {
+    using operation_state_concept _CCCL_NODEBUG_ALIAS = operation_state_t;
+    using __env_t _CCCL_NODEBUG_ALIAS                 = __fwd_env_t<env_of_t<_Rcvr>>;
+
+    _CCCL_API __opstate_t(_CvSndr&& __sndr, _Rcvr __rcvr, _Shape __shape, _Fn __fn)
+        : __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+        , __shape_{__shape}
+        , __fn_{static_cast<_Fn&&>(__fn)}
+        , __opstate_{execution::connect(static_cast<_CvSndr&&>(__sndr), __rcvr_ref{*this})}
+    {}
+
+    _CCCL_IMMOVABLE_OPSTATE(__opstate_t);
+
+    _CCCL_API void start() & noexcept
+    {
+      execution::start(__opstate_);
+    }
+
+    _CCCL_EXEC_CHECK_DISABLE
+    template <bool _CanThrow = false, class... _Ts>
+    _CCCL_API void __set(_Ts&&... __ts) noexcept(!_CanThrow)
+    {
+      if constexpr (_CanThrow || __nothrow_run<_Shape, _Fn, _Ts...>)
+      {
+        // Like on the pool's domain, a shape which isn't positive is empty, and the function isn't called.
+        if (__shape_ > 0)
+        {
+          __run_fn{}(__fn_, _Shape(0), __shape_, __ts...);
+        }
+        execution::set_value(static_cast<_Rcvr&&>(__rcvr_), static_cast<_Ts&&>(__ts)...);
+      }
+      else
+      {
+        _CUDAX_TRY( //
+          ({ //
+            __set<true>(static_cast<_Ts&&>(__ts)...); //
+          }), //
+          _CUDAX_CATCH(...) //
+          ({ //
+            execution::set_error(static_cast<_Rcvr&&>(__rcvr_), ::std::current_exception());
+          }) //
+        )
+      }
+    }
+
+    template <class... _Ts>
+    _CCCL_API void set_value(_Ts&&... __ts) noexcept
+    {
+      __set(static_cast<_Ts&&>(__ts)...);
+    }
+
+    template <class _Error>
+    _CCCL_API void set_error(_Error&& __error) noexcept
+    {
+      execution::set_error(static_cast<_Rcvr&&>(__rcvr_), static_cast<_Error&&>(__error));
+    }
+
+    _CCCL_API void set_stopped() noexcept
+    {
+      execution::set_stopped(static_cast<_Rcvr&&>(__rcvr_));
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __env_t
+    {
+      return __fwd_env(execution::get_env(__rcvr_));
+    }
+
+    _Rcvr __rcvr_;
+    _Shape __shape_;
+    _Fn __fn_;
+    connect_result_t<_CvSndr, __rcvr_ref<__opstate_t, __env_t>> __opstate_;
+  };
+
+  template <class _Shape, class _Fn>
+  struct __transform_args_fn
+  {
+    template <class... _Ts>
+    _CCCL_API constexpr auto operator()() const
+    {
+      if constexpr (!__can_run<_Shape, _Fn, _Ts...>)
+      {
+        return invalid_completion_signature<_WHERE(_IN_ALGORITHM, __bulk_t),
+                                            _WHAT(_FUNCTION_IS_NOT_CALLABLE),
+                                            _WITH_FUNCTION(_Fn),
+                                            _WITH_ARGUMENTS(_Shape, _Ts & ...)>();
+      }
+      else if constexpr (__nothrow_run<_Shape, _Fn, _Ts...>)
+      {
+        return completion_signatures<set_value_t(_Ts...)>();
+      }
+      else
+      {
+        return completion_signatures<set_value_t(_Ts...), set_error_t(::std::exception_ptr)>();
+      }
+    }
+  };
+
+  // bulk(sndr, policy, shape, fn) calls fn(i, values...) for each index of the chunks of bulk_chunked.
+  template <class _Fn>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __per_index_fn
+  {
+    _CCCL_EXEC_CHECK_DISABLE
+    _CCCL_TEMPLATE(class _Shape, class... _Ts)
+    _CCCL_REQUIRES(_CUDA_VSTD::__is_callable_v<_Fn&, _Shape, _Ts&...>)
+    _CCCL_API void operator()(_Shape __begin, _Shape __end, _Ts&... __ts) //
+      noexcept(__nothrow_callable<_Fn&, _Shape, _Ts&...>)
+    {
+      for (; __begin < __end; ++__begin)
+      {
+        __fn_(__begin, __ts...);
+      }
+    }
+
+    _Fn __fn_;
+  };
+
+public:
+  template <class _Sndr, class _Shape, class _Fn>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t;
+
+  template <class _Shape, class _Fn>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __closure_t;
+
+  template <class _Sndr, class _Shape, class _Fn>
+  _CCCL_TRIVIAL_API constexpr auto operator()(_Sndr __sndr, execution_policy __policy, _Shape __shape, _Fn __fn) const;
+
+  template <class _Shape, class _Fn>
+  _CCCL_TRIVIAL_API constexpr auto operator()(execution_policy __policy, _Shape __shape, _Fn __fn) const
+    -> __closure_t<_Shape, _Fn>;
+};
+
+template <bool _Chunked>
+template <class _Sndr, class _Shape, class _Fn>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __bulk_t<_Chunked>::__sndr_t
+{
+  using sender_concept _CCCL_NODEBUG_ALIAS = sender_t;
+  // bulk stores its function wrapped so that, like that of bulk_chunked, it is called with subranges of the shape.
+  using __fn_t _CCCL_NODEBUG_ALIAS = _CUDA_VSTD::conditional_t<_Chunked, _Fn, __per_index_fn<_Fn>>;
+
+  _CCCL_NO_UNIQUE_ADDRESS __bulk_t __tag_;
+  __bulk_data_t<_Shape, __fn_t> __data_;
+  _Sndr __sndr_;
+
+  template <class _Self, class... _Env>
+  _CCCL_API static constexpr auto get_completion_signatures()
+  {
+    _CUDAX_LET_COMPLETIONS(auto(__child_completions) = get_child_completion_signatures<_Self, _Sndr, _Env...>())
+    {
+      return transform_completion_signatures(__child_completions, __transform_args_fn<_Shape, __fn_t>{});
+    }
+
+    _CCCL_UNREACHABLE();
+  }
+
+  template <class _Rcvr>
+  _CCCL_API auto connect(_Rcvr __rcvr) && -> __opstate_t<_Rcvr, _Sndr, _Shape, __fn_t>
+  {
+    return {static_cast<_Sndr&&>(__sndr_),
+            static_cast<_Rcvr&&>(__rcvr),
+            __data_.__shape_,
+            static_cast<__fn_t&&>(__data_.__fn_)};
+  }
+
+  template <class _Rcvr>
+  _CCCL_API auto connect(_Rcvr __rcvr) const& -> __opstate_t<_Rcvr, const _Sndr&, _Shape, __fn_t>
+  {
+    return {__sndr_, static_cast<_Rcvr&&>(__rcvr), __data_.__shape_, __data_.__fn_};
+  }
+
+  [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __fwd_env_t<env_of_t<_Sndr>>
+  {
+    return __fwd_env(execution::get_env(__sndr_));
+  }
+};
+
+template <bool _Chunked>
+template <class _Shape, class _Fn>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __bulk_t<_Chunked>::__closure_t
+{
+  execution_policy __policy_;
+  _Shape __shape_;
+  _Fn __fn_;
+
+  template <class _Sndr>
+  _CCCL_TRIVIAL_API auto operator()(_Sndr __sndr) -> __call_result_t<__bulk_t, _Sndr, execution_policy, _Shape, _Fn>
+  {
+    return __bulk_t()(static_cast<_Sndr&&>(__sndr), __policy_, __shape_, static_cast<_Fn&&>(__fn_));
+  }
+
+  template <class _Sndr>
+  _CCCL_TRIVIAL_API friend auto operator|(_Sndr __sndr, __closure_t&& __self) //
+    -> __call_result_t<__bulk_t, _Sndr, execution_policy, _Shape, _Fn>
+  {
+    return __bulk_t()(
+      static_cast<_Sndr&&>(__sndr), __self.__policy_, __self.__shape_, static_cast<_Fn&&>(__self.__fn_));
+  }
+};
+
+template <bool _Chunked>
+template <class _Sndr, class _Shape, class _Fn>
+_CCCL_TRIVIAL_API constexpr auto
+__bulk_t<_Chunked>::operator()(_Sndr __sndr, execution_policy __policy, _Shape __shape, _Fn __fn) const
+{
+  static_assert(_CUDA_VSTD::is_integral_v<_Shape>, "The shape of a bulk operation must be an integer");
+  using __sndr_t _CCCL_NODEBUG_ALIAS = __sndr_t<_Sndr, _Shape, _Fn>;
+  using __dom_t _CCCL_NODEBUG_ALIAS  = domain_for_t<_Sndr>;
+  // If the incoming sender is non-dependent, we can check the completion
+  // signatures of the composed sender immediately.
+  if constexpr (!dependent_sender<_Sndr>)
+  {
+    __assert_valid_completion_signatures(get_completion_signatures<__sndr_t>());
+  }
+  using __fn_t _CCCL_NODEBUG_ALIAS   = typename __sndr_t::__fn_t;
+  return transform_sender(
+    __dom_t{}, __sndr_t{{}, {__policy, __shape, __fn_t{static_cast<_Fn&&>(__fn)}}, static_cast<_Sndr&&>(__sndr)});
+}
+
+template <bool _Chunked>
+template <class _Shape, class _Fn>
+_CCCL_TRIVIAL_API constexpr auto
+__bulk_t<_Chunked>::operator()(execution_policy __policy, _Shape __shape, _Fn __fn) const -> __closure_t<_Shape, _Fn>
+{
+  return __closure_t<_Shape, _Fn>{__policy, __shape, static_cast<_Fn&&>(__fn)};
+}
+
+template <class _Sndr, class _Shape, class _Fn>
+inline constexpr size_t structured_binding_size<bulk_t::__sndr_t<_Sndr, _Shape, _Fn>> = 3;
+template <class _Sndr, class _Shape, class _Fn>
+inline constexpr size_t structured_binding_size<bulk_chunked_t::__sndr_t<_Sndr, _Shape, _Fn>> = 3;
+
+// Whether a sender is the result of bulk or bulk_chunked, for the domains which customize them.
+template <class _Tag>
+inline constexpr bool __is_bulk_tag = false;
+template <bool _Chunked>
+inline constexpr bool __is_bulk_tag<__bulk_t<_Chunked>> = true;
+
+template <class _Sndr, class = void>
+inline constexpr bool __is_bulk_sender = false;
+template <class _Sndr>
+inline constexpr bool __is_bulk_sender<_Sndr, _CUDA_VSTD::void_t<tag_of_t<_Sndr>>> =
+  __is_bulk_tag<tag_of_t<_Sndr>>;
+
+_CCCL_GLOBAL_CONSTANT auto bulk         = bulk_t{};
+_CCCL_GLOBAL_CONSTANT auto bulk_chunked = bulk_chunked_t{};
+
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_ASYNC_DETAIL_BULK
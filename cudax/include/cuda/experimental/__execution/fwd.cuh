@@ -121,6 +121,11 @@ using then_t         = __upon_t<__value>;
 using upon_error_t   = __upon_t<__error>;
 using upon_stopped_t = __upon_t<__stopped>;
 
+template <bool _Chunked>
+struct __bulk_t;
+using bulk_t         = __bulk_t<false>;
+using bulk_chunked_t = __bulk_t<true>;
+
 struct when_all_t;
 struct conditional_t;
 struct sequence_t;
@@ -52,10 +52,15 @@ _CCCL_GLOBAL_CONSTANT execution_policy par_unseq_device = execution_policy::para
 _CCCL_GLOBAL_CONSTANT execution_policy unseq_host       = execution_policy::unsequenced_host;
 _CCCL_GLOBAL_CONSTANT execution_policy unseq_device     = execution_policy::unsequenced_device;
 
+[[nodiscard]] _CCCL_API constexpr bool __is_parallel_policy(execution_policy __policy) noexcept
+{
+  return __policy == execution_policy::parallel_host || __policy == execution_policy::parallel_device
+      || __policy == execution_policy::parallel_unsequenced_host
+      || __policy == execution_policy::parallel_unsequenced_device;
+}
+
 template <execution_policy _Policy>
-inline constexpr bool __is_parallel_execution_policy =
-  _Policy == execution_policy::parallel_host || _Policy == execution_policy::parallel_device
-  || _Policy == execution_policy::parallel_unsequenced_host || _Policy == execution_policy::parallel_unsequenced_device;
+inline constexpr bool __is_parallel_execution_policy = __is_parallel_policy(_Policy);
 
 template <execution_policy _Policy>
 inline constexpr bool __is_unsequenced_execution_policy =
@@ -0,0 +1,770 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_ASYNC_DETAIL_STATIC_THREAD_POOL
+#define __CUDAX_ASYNC_DETAIL_STATIC_THREAD_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HOST_COMPILATION()
+
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/__type_traits/make_unsigned.h>
+#  include <cuda/std/__utility/pod_tuple.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/experimental/__execution/bulk.cuh>
+#  include <cuda/experimental/__execution/completion_signatures.cuh>
+#  include <cuda/experimental/__execution/cpos.cuh>
+#  include <cuda/experimental/__execution/domain.cuh>
+#  include <cuda/experimental/__execution/env.cuh>
+#  include <cuda/experimental/__execution/exception.cuh>
+#  include <cuda/experimental/__execution/policy.cuh>
+#  include <cuda/experimental/__execution/queries.cuh>
+#  include <cuda/experimental/__execution/rcvr_ref.cuh>
+#  include <cuda/experimental/__execution/type_traits.cuh>
+#  include <cuda/experimental/__execution/utility.cuh>
+#  include <cuda/experimental/__execution/variant.cuh>
+
+#  include <condition_variable>
+#  include <memory>
+#  include <mutex>
+#  include <thread>
+
+#  if _CCCL_OS(LINUX)
+#    include <pthread.h>
+#    include <sched.h>
+#  endif // _CCCL_OS(LINUX)
+
+#  include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief How the worker threads of a @c static_thread_pool are placed on the CPUs of the machine.
+enum class thread_affinity : unsigned char
+{
+  //! The threads are scheduled by the operating system, on any of the CPUs the process may run on.
+  none,
+  //! Each thread is pinned to one of the CPUs the process may run on, in order, wrapping around when there are more
+  //! threads than CPUs. Only supported on Linux; elsewhere, this is the same as @c none.
+  one_cpu_per_thread,
+};
+
+//! @brief An execution context which runs the work scheduled on it on a fixed set of threads.
+//!
+//! Each worker thread owns a queue of tasks. Work scheduled from one of the pool's own threads goes to the back of
+//! that thread's queue, and work scheduled from any other thread is spread over the queues in turn. A worker runs the
+//! tasks from the back of its own queue, so that it continues with the work it just scheduled while its data is still
+//! in cache, and when its queue is empty it steals the task at the front of another worker's queue, which is the one
+//! its owner would get to last. Workers which find no work at all sleep until more is scheduled.
+//!
+//! A @c bulk or @c bulk_chunked sender whose predecessor completes on the pool splits its shape into one chunk per
+//! worker thread when its policy is parallel, and completes once, after the last chunk is done.
+//!
+//! Tasks which are scheduled before the pool is joined are all run; scheduling work on the pool after it is joined is
+//! undefined behavior.
+class _CCCL_TYPE_VISIBILITY_DEFAULT static_thread_pool : __immovable
+{
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __task : __immovable
+  {
+    using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__task*) noexcept;
+
+    _CCCL_HIDE_FROM_ABI __task() = default;
+    _CCCL_HOST_API explicit __task(__execute_fn_t* __execute_fn) noexcept
+        : __execute_fn_(__execute_fn)
+    {}
+
+    _CCCL_HOST_API void __execute() noexcept
+    {
+      (*__execute_fn_)(this);
+    }
+
+    __execute_fn_t* __execute_fn_ = nullptr;
+    __task* __next_               = nullptr;
+    __task* __prev_               = nullptr;
+  };
+
+  // The queue of one worker thread, a doubly linked list of tasks. The lock is only contended when another worker
+  // steals from the queue, or when work is scheduled on it from outside the pool.
+  struct alignas(64) __worker
+  {
+    _CCCL_HOST_API void __push_back(__task* __t) noexcept
+    {
+      ::std::lock_guard<::std::mutex> __guard{__mtx_};
+      __t->__next_ = nullptr;
+      __t->__prev_ = __tail_;
+      (__tail_ == nullptr ? __head_ : __tail_->__next_) = __t;
+      __tail_                                           = __t;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __pop_back() noexcept -> __task*
+    {
+      ::std::lock_guard<::std::mutex> __guard{__mtx_};
+      __task* __t = __tail_;
+      if (__t != nullptr)
+      {
+        __tail_                                           = __t->__prev_;
+        (__tail_ == nullptr ? __head_ : __tail_->__next_) = nullptr;
+      }
+      return __t;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __pop_front() noexcept -> __task*
+    {
+      ::std::lock_guard<::std::mutex> __guard{__mtx_};
+      __task* __t = __head_;
+      if (__t != nullptr)
+      {
+        __head_                                           = __t->__next_;
+        (__head_ == nullptr ? __tail_ : __head_->__prev_) = nullptr;
+      }
+      return __t;
+    }
+
+    static_thread_pool* __pool_ = nullptr;
+    ::std::mutex __mtx_;
+    __task* __head_ = nullptr;
+    __task* __tail_ = nullptr;
+    ::std::thread __thrd_;
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __task
+  {
+    static_thread_pool* __pool_;
+    _CCCL_NO_UNIQUE_ADDRESS _Rcvr __rcvr_;
+
+    _CCCL_HOST_API static void __execute_impl(__task* __p) noexcept
+    {
+      auto& __rcvr = static_cast<__opstate_t*>(__p)->__rcvr_;
+      _CUDAX_TRY( //
+        ({ //
+          if (get_stop_token(get_env(__rcvr)).stop_requested())
+          {
+            set_stopped(static_cast<_Rcvr&&>(__rcvr));
+          }
+          else
+          {
+            set_value(static_cast<_Rcvr&&>(__rcvr));
+          }
+        }),
+        _CUDAX_CATCH(...) //
+        ({ //
+          set_error(static_cast<_Rcvr&&>(__rcvr), ::std::current_exception());
+        }) //
+      )
+    }
+
+    _CCCL_HOST_API __opstate_t(static_thread_pool* __pool, _Rcvr __rcvr)
+        : __task{&__execute_impl}
+        , __pool_{__pool}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_HOST_API void start() & noexcept
+    {
+      __pool_->__enqueue(this);
+    }
+  };
+
+  template <class _Shape, class _Fn>
+  struct __bulk_args_fn
+  {
+    template <class... _Ts>
+    _CCCL_HOST_API constexpr auto operator()() const
+    {
+      if constexpr (!__decay_copyable<_Ts...>)
+      {
+        return invalid_completion_signature<_WHERE(_IN_ALGORITHM, bulk_t),
+                                            _WHAT(_ARGUMENTS_ARE_NOT_DECAY_COPYABLE),
+                                            _WITH_ARGUMENTS(_Ts...)>();
+      }
+      else if constexpr (!bulk_chunked_t::__can_run<_Shape, _Fn, __decay_t<_Ts>...>)
+      {
+        return invalid_completion_signature<_WHERE(_IN_ALGORITHM, bulk_t),
+                                            _WHAT(_FUNCTION_IS_NOT_CALLABLE),
+                                            _WITH_FUNCTION(_Fn),
+                                            _WITH_ARGUMENTS(_Shape, __decay_t<_Ts> & ...)>();
+      }
+      else if constexpr (__nothrow_decay_copyable<_Ts...>
+                         && bulk_chunked_t::__nothrow_run<_Shape, _Fn, __decay_t<_Ts>...>)
+      {
+        return completion_signatures<set_value_t(__decay_t<_Ts>...)>();
+      }
+      else
+      {
+        return completion_signatures<set_value_t(__decay_t<_Ts>...), set_error_t(::std::exception_ptr)>();
+      }
+    }
+  };
+
+  // The operation state of a bulk or bulk_chunked sender lowered by the pool's domain. The values of the predecessor
+  // are stored, and the shape is split into one chunk per worker thread for parallel policies. The first chunk runs on
+  // the thread on which the predecessor completes, the others are scheduled on the pool, and whichever chunk finishes
+  // last sends the values, or the first exception thrown by the function, to the receiver.
+  template <class _Rcvr, class _CvSndr, class _Shape, class _Fn>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __bulk_opstate_t
+  {
+    using operation_state_concept _CCCL_NODEBUG_ALIAS = operation_state_t;
+    using __env_t _CCCL_NODEBUG_ALIAS                 = __fwd_env_t<env_of_t<_Rcvr>>;
+    using __values_t _CCCL_NODEBUG_ALIAS =
+      __gather_completion_signatures<completion_signatures_of_t<_CvSndr, __env_t>,
+                                     set_value_t,
+                                     _CUDA_VSTD::__decayed_tuple,
+                                     __variant>;
+
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __chunk_t : __task
+    {
+      __bulk_opstate_t* __self_;
+      _Shape __begin_;
+      _Shape __end_;
+    };
+
+    _CCCL_HOST_API __bulk_opstate_t(
+      static_thread_pool* __pool, _CvSndr&& __sndr, _Rcvr __rcvr, execution_policy __policy, _Shape __shape, _Fn __fn)
+        : __pool_{__pool}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+        , __fn_{static_cast<_Fn&&>(__fn)}
+        , __chunk_count_{__shape > 0 && __is_parallel_policy(__policy) ? __chunk_count(__pool, __shape) : 1u}
+        , __chunks_{new __chunk_t[__chunk_count_]}
+        , __opstate_{execution::connect(static_cast<_CvSndr&&>(__sndr), __rcvr_ref{*this})}
+    {
+      const _Shape __count = static_cast<_Shape>(__chunk_count_);
+      const _Shape __size  = __shape > 0 ? __shape / __count : _Shape(0);
+      const _Shape __extra = __shape > 0 ? __shape % __count : _Shape(0);
+      _Shape __begin       = 0;
+      for (_CUDA_VSTD::uint32_t __i = 0; __i < __chunk_count_; ++__i)
+      {
+        const _Shape __end        = __begin + __size + (static_cast<_Shape>(__i) < __extra ? 1 : 0);
+        __chunks_[__i].__execute_fn_ = &__execute_chunk;
+        __chunks_[__i].__self_       = this;
+        __chunks_[__i].__begin_      = __begin;
+        __chunks_[__i].__end_        = __end;
+        __begin                      = __end;
+      }
+    }
+
+    _CCCL_IMMOVABLE_OPSTATE(__bulk_opstate_t);
+
+    _CCCL_HOST_API void start() & noexcept
+    {
+      execution::start(__opstate_);
+    }
+
+    template <class... _As>
+    _CCCL_HOST_API void set_value(_As&&... __as) noexcept
+    {
+      using __tupl_t _CCCL_NODEBUG_ALIAS = _CUDA_VSTD::__decayed_tuple<_As...>;
+      if constexpr (__nothrow_decay_copyable<_As...>)
+      {
+        __values_.template __emplace<__tupl_t>(static_cast<_As&&>(__as)...);
+      }
+      else
+      {
+        _CUDAX_TRY( //
+          ({ //
+            __values_.template __emplace<__tupl_t>(static_cast<_As&&>(__as)...);
+          }),
+          _CUDAX_CATCH(...) //
+          ({ //
+            execution::set_error(static_cast<_Rcvr&&>(__rcvr_), ::std::current_exception());
+            return;
+          }) //
+        )
+      }
+      __run_      = &__run_impl<__tupl_t>;
+      __complete_ = &__complete_impl<__tupl_t>;
+
+      if (__chunks_[0].__begin_ == __chunks_[0].__end_)
+      {
+        __complete_(this);
+        return;
+      }
+      __remaining_.store(__chunk_count_, _CUDA_VSTD::memory_order_relaxed);
+      for (_CUDA_VSTD::uint32_t __i = 1; __i < __chunk_count_; ++__i)
+      {
+        __pool_->__enqueue(&__chunks_[__i]);
+      }
+      __chunks_[0].__execute();
+    }
+
+    template <class _Error>
+    _CCCL_HOST_API void set_error(_Error&& __error) noexcept
+    {
+      execution::set_error(static_cast<_Rcvr&&>(__rcvr_), static_cast<_Error&&>(__error));
+    }
+
+    _CCCL_HOST_API void set_stopped() noexcept
+    {
+      execution::set_stopped(static_cast<_Rcvr&&>(__rcvr_));
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto get_env() const noexcept -> __env_t
+    {
+      return __fwd_env(execution::get_env(__rcvr_));
+    }
+
+    [[nodiscard]] _CCCL_HOST_API static auto __chunk_count(static_thread_pool* __pool, _Shape __shape) noexcept
+      -> _CUDA_VSTD::uint32_t
+    {
+      const auto __threads = static_cast<_CUDA_VSTD::make_unsigned_t<_Shape>>(__pool->__thread_count_);
+      return __threads < static_cast<_CUDA_VSTD::make_unsigned_t<_Shape>>(__shape)
+             ? __pool->__thread_count_
+             : static_cast<_CUDA_VSTD::uint32_t>(__shape);
+    }
+
+    _CCCL_HOST_API static void __execute_chunk(__task* __p) noexcept
+    {
+      auto& __chunk = *static_cast<__chunk_t*>(__p);
+      auto& __self  = *__chunk.__self_;
+      __self.__run_(__self, __chunk.__begin_, __chunk.__end_);
+      // The chunk which finishes last sees the effects of all the others, and completes the operation.
+      if (__self.__remaining_.fetch_sub(1, _CUDA_VSTD::memory_order_acq_rel) == 1)
+      {
+        __self.__complete_(&__self);
+      }
+    }
+
+    template <class _Tupl>
+    _CCCL_HOST_API static void __run_impl(__bulk_opstate_t& __self, _Shape __begin, _Shape __end) noexcept
+    {
+      auto& __tupl = *static_cast<_Tupl*>(__self.__values_.__ptr());
+      if constexpr (noexcept(_CUDA_VSTD::__apply(bulk_chunked_t::__run_fn{}, __tupl, __self.__fn_, __begin, __end)))
+      {
+        _CUDA_VSTD::__apply(bulk_chunked_t::__run_fn{}, __tupl, __self.__fn_, __begin, __end);
+      }
+      else
+      {
+        _CUDAX_TRY( //
+          ({ //
+            _CUDA_VSTD::__apply(bulk_chunked_t::__run_fn{}, __tupl, __self.__fn_, __begin, __end);
+          }),
+          _CUDAX_CATCH(...) //
+          ({ //
+            // Only the first exception is sent to the receiver.
+            if (!__self.__has_error_.exchange(true, _CUDA_VSTD::memory_order_relaxed))
+            {
+              __self.__error_ = ::std::current_exception();
+            }
+          }) //
+        )
+      }
+    }
+
+    template <class _Tupl>
+    _CCCL_HOST_API static void __complete_impl(__bulk_opstate_t* __self) noexcept
+    {
+      if (__self->__error_)
+      {
+        execution::set_error(static_cast<_Rcvr&&>(__self->__rcvr_),
+                             static_cast<::std::exception_ptr&&>(__self->__error_));
+        return;
+      }
+      auto& __tupl = *static_cast<_Tupl*>(__self->__values_.__ptr());
+      _CUDA_VSTD::__apply(execution::set_value, static_cast<_Tupl&&>(__tupl), static_cast<_Rcvr&&>(__self->__rcvr_));
+    }
+
+    static_thread_pool* __pool_;
+    _Rcvr __rcvr_;
+    _Fn __fn_;
+    const _CUDA_VSTD::uint32_t __chunk_count_;
+    ::std::unique_ptr<__chunk_t[]> __chunks_;
+    __values_t __values_;
+    void (*__run_)(__bulk_opstate_t&, _Shape, _Shape) noexcept = nullptr;
+    void (*__complete_)(__bulk_opstate_t*) noexcept             = nullptr;
+    _CUDA_VSTD::atomic<_CUDA_VSTD::uint32_t> __remaining_{0};
+    _CUDA_VSTD::atomic<bool> __has_error_{false};
+    ::std::exception_ptr __error_;
+    connect_result_t<_CvSndr, __rcvr_ref<__bulk_opstate_t, __env_t>> __opstate_;
+  };
+
+  template <class _Sndr, class _Shape, class _Fn>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __bulk_sndr_t
+  {
+    using sender_concept _CCCL_NODEBUG_ALIAS = sender_t;
+
+    template <class _Self, class... _Env>
+    _CCCL_HOST_API static constexpr auto get_completion_signatures()
+    {
+      _CUDAX_LET_COMPLETIONS(auto(__child_completions) = get_child_completion_signatures<_Self, _Sndr, _Env...>())
+      {
+        return transform_completion_signatures(__child_completions, __bulk_args_fn<_Shape, _Fn>{});
+      }
+
+      _CCCL_UNREACHABLE();
+    }
+
+    template <class _Rcvr>
+    _CCCL_HOST_API auto connect(_Rcvr __rcvr) && -> __bulk_opstate_t<_Rcvr, _Sndr, _Shape, _Fn>
+    {
+      return {__pool_,
+              static_cast<_Sndr&&>(__sndr_),
+              static_cast<_Rcvr&&>(__rcvr),
+              __data_.__policy_,
+              __data_.__shape_,
+              static_cast<_Fn&&>(__data_.__fn_)};
+    }
+
+    template <class _Rcvr>
+    _CCCL_HOST_API auto connect(_Rcvr __rcvr) const& -> __bulk_opstate_t<_Rcvr, const _Sndr&, _Shape, _Fn>
+    {
+      return {__pool_, __sndr_, static_cast<_Rcvr&&>(__rcvr), __data_.__policy_, __data_.__shape_, __data_.__fn_};
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto get_env() const noexcept -> __fwd_env_t<env_of_t<_Sndr>>
+    {
+      return __fwd_env(execution::get_env(__sndr_));
+    }
+
+    static_thread_pool* __pool_;
+    __bulk_data_t<_Shape, _Fn> __data_;
+    _Sndr __sndr_;
+  };
+
+public:
+  //! @brief The domain of the pool's scheduler, which runs the @c bulk and @c bulk_chunked senders whose predecessor
+  //! completes on the pool with one chunk of the shape per worker thread.
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __domain_t
+  {
+    _CCCL_TEMPLATE(class _Sndr, class _Env)
+    _CCCL_REQUIRES(__is_bulk_sender<_Sndr>)
+    _CCCL_HOST_API static auto transform_sender(_Sndr&& __sndr, const _Env& __env)
+    {
+      auto&& [__tag, __data, __child] = static_cast<_Sndr&&>(__sndr);
+      return __make_bulk_sndr(__pool_of(__child, __env),
+                              static_cast<__copy_cvref_t<_Sndr&&, decltype(__data)>>(__data),
+                              static_cast<__copy_cvref_t<_Sndr&&, decltype(__child)>>(__child));
+    }
+
+  private:
+    // The pool is the one the predecessor completes on, or else the one the receiver's environment schedules on.
+    template <class _Sndr, class _Env>
+    [[nodiscard]] _CCCL_HOST_API static auto __pool_of(const _Sndr& __sndr, const _Env& __env) noexcept
+      -> static_thread_pool*
+    {
+      if constexpr (_CUDA_VSTD::is_same_v<__call_result_t<get_completion_scheduler_t<set_value_t>, env_of_t<_Sndr>>,
+                                          scheduler>)
+      {
+        return get_completion_scheduler<set_value_t>(execution::get_env(__sndr)).__pool_;
+      }
+      else
+      {
+        return get_scheduler(__env).__pool_;
+      }
+    }
+
+    template <class _Shape, class _Fn, class _Sndr>
+    [[nodiscard]] _CCCL_HOST_API static auto
+    __make_bulk_sndr(static_thread_pool* __pool, __bulk_data_t<_Shape, _Fn> __data, _Sndr&& __sndr)
+      -> __bulk_sndr_t<__decay_t<_Sndr>, _Shape, _Fn>
+    {
+      return {__pool, static_cast<__bulk_data_t<_Shape, _Fn>&&>(__data), static_cast<_Sndr&&>(__sndr)};
+    }
+  };
+
+  class _CCCL_TYPE_VISIBILITY_DEFAULT scheduler
+  {
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t
+    {
+      using sender_concept _CCCL_NODEBUG_ALIAS = sender_t;
+
+      template <class _Rcvr>
+      _CCCL_HOST_API auto connect(_Rcvr __rcvr) const noexcept -> __opstate_t<_Rcvr>
+      {
+        return {__pool_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      template <class _Self>
+      _CCCL_HOST_API static constexpr auto get_completion_signatures() noexcept
+      {
+#  if _CCCL_HAS_EXCEPTIONS()
+        return completion_signatures<set_value_t(), set_error_t(::std::exception_ptr), set_stopped_t()>();
+#  else // ^^^ _CCCL_HAS_EXCEPTIONS() ^^^ / vvv !_CCCL_HAS_EXCEPTIONS() vvv
+        return completion_signatures<set_value_t(), set_stopped_t()>();
+#  endif // !_CCCL_HAS_EXCEPTIONS()
+      }
+
+    private:
+      friend scheduler;
+
+      struct _CCCL_TYPE_VISIBILITY_DEFAULT __env_t
+      {
+        static_thread_pool* __pool_;
+
+        _CCCL_HOST_API auto query(get_completion_scheduler_t<set_value_t>) const noexcept -> scheduler
+        {
+          return __pool_->get_scheduler();
+        }
+
+        _CCCL_HOST_API auto query(get_completion_scheduler_t<set_stopped_t>) const noexcept -> scheduler
+        {
+          return __pool_->get_scheduler();
+        }
+      };
+
+    public:
+      _CCCL_HOST_API auto get_env() const noexcept -> __env_t
+      {
+        return __env_t{__pool_};
+      }
+
+    private:
+      _CCCL_HOST_API explicit __sndr_t(static_thread_pool* __pool) noexcept
+          : __pool_(__pool)
+      {}
+
+      static_thread_pool* const __pool_;
+    };
+
+    friend static_thread_pool;
+
+    _CCCL_HOST_API explicit scheduler(static_thread_pool* __pool) noexcept
+        : __pool_(__pool)
+    {}
+
+    static_thread_pool* __pool_;
+
+  public:
+    using scheduler_concept _CCCL_NODEBUG_ALIAS = scheduler_t;
+
+    [[nodiscard]] _CCCL_HOST_API auto schedule() const noexcept -> __sndr_t
+    {
+      return __sndr_t{__pool_};
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto query(get_forward_progress_guarantee_t) const noexcept
+      -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API static constexpr auto query(get_domain_t) noexcept -> __domain_t
+    {
+      return {};
+    }
+
+    [[nodiscard]] _CCCL_HOST_API friend bool operator==(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__pool_ == __b.__pool_;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API friend bool operator!=(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__pool_ != __b.__pool_;
+    }
+  };
+
+  //! @brief Starts the worker threads of the pool.
+  //! @param __thread_count The number of worker threads. Defaults to the number of hardware threads.
+  //! @param __affinity How the worker threads are placed on the CPUs of the machine.
+  _CCCL_HOST_API explicit static_thread_pool(
+    _CUDA_VSTD::uint32_t __thread_count = ::std::thread::hardware_concurrency(),
+    thread_affinity __affinity          = thread_affinity::none)
+      : __thread_count_(__thread_count == 0 ? 1 : __thread_count)
+      , __workers_(new __worker[__thread_count_])
+  {
+    for (_CUDA_VSTD::uint32_t __i = 0; __i < __thread_count_; ++__i)
+    {
+      __workers_[__i].__pool_ = this;
+    }
+    _CUDAX_TRY( //
+      ({ //
+        for (_CUDA_VSTD::uint32_t __i = 0; __i < __thread_count_; ++__i)
+        {
+          __workers_[__i].__thrd_ = ::std::thread{[this, __i, __affinity] {
+            if (__affinity == thread_affinity::one_cpu_per_thread)
+            {
+              __pin_this_thread(__i);
+            }
+            __run(__workers_[__i]);
+          }};
+        }
+      }),
+      _CUDAX_CATCH(...) //
+      ({ //
+        // The threads which did start must be joined before they are destroyed, or the program terminates.
+        join();
+        throw;
+      }) //
+    )
+  }
+
+  _CCCL_HOST_API ~static_thread_pool() noexcept
+  {
+    join();
+  }
+
+  //! @brief Runs all the work scheduled on the pool, and then stops its worker threads.
+  //!
+  //! Must not be called from one of the pool's own threads, which would wait for itself to stop; the same goes for the
+  //! destructor.
+  _CCCL_HOST_API void join() noexcept
+  {
+    _CCCL_ASSERT(__this_worker() == nullptr || __this_worker()->__pool_ != this,
+                 "A static_thread_pool cannot be joined from one of its own threads");
+    {
+      ::std::lock_guard<::std::mutex> __guard{__sleep_mtx_};
+      __stopping_ = true;
+    }
+    __sleep_cv_.notify_all();
+    for (_CUDA_VSTD::uint32_t __i = 0; __i < __thread_count_; ++__i)
+    {
+      if (__workers_[__i].__thrd_.joinable())
+      {
+        __workers_[__i].__thrd_.join();
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto get_scheduler() noexcept -> scheduler
+  {
+    return scheduler{this};
+  }
+
+  //! @brief Returns the number of worker threads of the pool.
+  [[nodiscard]] _CCCL_HOST_API auto available_parallelism() const noexcept -> _CUDA_VSTD::uint32_t
+  {
+    return __thread_count_;
+  }
+
+private:
+  // The worker which runs on the calling thread, if any, in any pool.
+  [[nodiscard]] _CCCL_HOST_API static auto __this_worker() noexcept -> __worker*&
+  {
+    static thread_local __worker* __worker_ = nullptr;
+    return __worker_;
+  }
+
+  _CCCL_HOST_API void __enqueue(__task* __t) noexcept
+  {
+    __worker* __w = __this_worker();
+    if (__w == nullptr || __w->__pool_ != this)
+    {
+      __w = &__workers_[__next_worker_.fetch_add(1, _CUDA_VSTD::memory_order_relaxed) % __thread_count_];
+    }
+
+    // The task is counted before it is pushed, so that the worker which takes it never brings the count below zero. A
+    // worker which sees the count first only retries until the task is in the queue.
+    //
+    // Pairs with the sleeping worker, which counts itself as a sleeper before it checks for pending tasks: either the
+    // worker sees this task, or this sees the worker and wakes it up.
+    __pending_.fetch_add(1, _CUDA_VSTD::memory_order_seq_cst);
+    __w->__push_back(__t);
+    if (__sleepers_.load(_CUDA_VSTD::memory_order_seq_cst) != 0)
+    {
+      // Taking the lock makes sure that a worker between its check and its wait is done waiting for the notification.
+      { ::std::lock_guard<::std::mutex> __guard{__sleep_mtx_}; }
+      __sleep_cv_.notify_one();
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __steal(const __worker& __thief) noexcept -> __task*
+  {
+    const auto __first = static_cast<_CUDA_VSTD::uint32_t>(&__thief - __workers_.get());
+    for (_CUDA_VSTD::uint32_t __i = 1; __i < __thread_count_; ++__i)
+    {
+      const _CUDA_VSTD::uint32_t __victim = (__first + __i) % __thread_count_;
+      if (__task* __t = __workers_[__victim].__pop_front())
+      {
+        return __t;
+      }
+    }
+    return nullptr;
+  }
+
+  // Blocks until a task may be pending. Returns false when the pool is joined and no task is left to run.
+  [[nodiscard]] _CCCL_HOST_API bool __wait_for_work() noexcept
+  {
+    ::std::unique_lock<::std::mutex> __lock{__sleep_mtx_};
+    __sleepers_.fetch_add(1, _CUDA_VSTD::memory_order_seq_cst);
+    while (__pending_.load(_CUDA_VSTD::memory_order_seq_cst) == 0 && !__stopping_)
+    {
+      __sleep_cv_.wait(__lock);
+    }
+    __sleepers_.fetch_sub(1, _CUDA_VSTD::memory_order_relaxed);
+    return __pending_.load(_CUDA_VSTD::memory_order_relaxed) != 0 || !__stopping_;
+  }
+
+  _CCCL_HOST_API void __run(__worker& __self) noexcept
+  {
+    __this_worker() = &__self;
+    while (true)
+    {
+      __task* __t = __self.__pop_back();
+      if (__t == nullptr)
+      {
+        __t = __steal(__self);
+      }
+      if (__t != nullptr)
+      {
+        __pending_.fetch_sub(1, _CUDA_VSTD::memory_order_relaxed);
+        __t->__execute();
+      }
+      else if (!__wait_for_work())
+      {
+        break;
+      }
+    }
+    __this_worker() = nullptr;
+  }
+
+  _CCCL_HOST_API static void __pin_this_thread([[maybe_unused]] _CUDA_VSTD::uint32_t __index) noexcept
+  {
+#  if _CCCL_OS(LINUX)
+    // The new thread inherits the CPUs its creator may run on, which are the ones the threads are spread over.
+    ::cpu_set_t __allowed;
+    if (::sched_getaffinity(0, sizeof(__allowed), &__allowed) != 0 || CPU_COUNT(&__allowed) == 0)
+    {
+      return;
+    }
+    int __nth = static_cast<int>(__index % static_cast<_CUDA_VSTD::uint32_t>(CPU_COUNT(&__allowed)));
+    for (int __cpu = 0; __cpu < CPU_SETSIZE; ++__cpu)
+    {
+      if (CPU_ISSET(__cpu, &__allowed) && __nth-- == 0)
+      {
+        ::cpu_set_t __set;
+        CPU_ZERO(&__set);
+        CPU_SET(__cpu, &__set);
+        // Best effort: the thread keeps running wherever the operating system puts it if this fails.
+        ::pthread_setaffinity_np(::pthread_self(), sizeof(__set), &__set);
+        return;
+      }
+    }
+#  endif // _CCCL_OS(LINUX)
+  }
+
+  const _CUDA_VSTD::uint32_t __thread_count_;
+  ::std::unique_ptr<__worker[]> __workers_;
+  _CUDA_VSTD::atomic<_CUDA_VSTD::uint32_t> __next_worker_{0};
+
+  // The number of tasks which are in a queue, and not yet taken by a worker.
+  alignas(64) _CUDA_VSTD::atomic<_CUDA_VSTD::size_t> __pending_{0};
+  _CUDA_VSTD::atomic<_CUDA_VSTD::uint32_t> __sleepers_{0};
+  ::std::mutex __sleep_mtx_;
+  ::std::condition_variable __sleep_cv_;
+  bool __stopping_ = false;
+};
+} // namespace cuda::experimental::execution
+
+#  include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // _CCCL_HOST_COMPILATION()
+
+#endif // __CUDAX_ASYNC_DETAIL_STATIC_THREAD_POOL
@@ -13,6 +13,7 @@
 
 // IWYU pragma: begin_exports
 #include <cuda/experimental/__execution/apply_sender.cuh>
+#include <cuda/experimental/__execution/bulk.cuh>
 #include <cuda/experimental/__execution/conditional.cuh>
 #include <cuda/experimental/__execution/continues_on.cuh>
 #include <cuda/experimental/__execution/cpos.cuh>
@@ -29,6 +30,7 @@
 #include <cuda/experimental/__execution/sequence.cuh>
 #include <cuda/experimental/__execution/start_detached.cuh>
 #include <cuda/experimental/__execution/starts_on.cuh>
+#include <cuda/experimental/__execution/static_thread_pool.cuh>
 #include <cuda/experimental/__execution/stop_token.cuh>
 #include <cuda/experimental/__execution/sync_wait.cuh>
 #include <cuda/experimental/__execution/then.cuh>
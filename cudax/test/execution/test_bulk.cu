@@ -0,0 +1,271 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/checked_receiver.cuh"
+#include "common/error_scheduler.cuh"
+#include "common/inline_scheduler.cuh"
+#include "common/stopped_scheduler.cuh"
+#include "common/utility.cuh"
+#include "testing.cuh" // IWYU pragma: keep
+
+namespace
+{
+C2H_TEST("bulk returns a sender", "[adaptors][bulk]")
+{
+  auto sndr = cudax_async::bulk(cudax_async::just(), cudax_async::seq_host, 4, [](int) {});
+  static_assert(cudax_async::sender<decltype(sndr)>);
+  (void) sndr;
+}
+
+C2H_TEST("bulk_chunked returns a sender", "[adaptors][bulk]")
+{
+  auto sndr = cudax_async::bulk_chunked(cudax_async::just(), cudax_async::seq_host, 4, [](int, int) {});
+  static_assert(cudax_async::sender<decltype(sndr)>);
+  (void) sndr;
+}
+
+C2H_TEST("bulk calls the function once per index and forwards the values", "[adaptors][bulk]")
+{
+  int counts[5]{};
+  auto sndr = cudax_async::just(42) //
+            | cudax_async::bulk(cudax_async::seq_host, 5, [&](int i, int& value) {
+                CUDAX_CHECK(value == 42);
+                ++counts[i];
+              });
+  auto op = cudax_async::connect(std::move(sndr), checked_value_receiver{42});
+  cudax_async::start(op);
+  for (int count : counts)
+  {
+    CUDAX_CHECK(count == 1);
+  }
+}
+
+C2H_TEST("bulk_chunked calls the function once for the whole shape by default", "[adaptors][bulk]")
+{
+  int calls = 0;
+  auto sndr = cudax_async::just(42, 'a') //
+            | cudax_async::bulk_chunked(cudax_async::par_host, 5, [&](int begin, int end, int& value, char&) {
+                CUDAX_CHECK(begin == 0);
+                CUDAX_CHECK(end == 5);
+                CUDAX_CHECK(value == 42);
+                ++calls;
+              });
+  auto op = cudax_async::connect(std::move(sndr), checked_value_receiver{42, 'a'});
+  cudax_async::start(op);
+  CUDAX_CHECK(calls == 1);
+}
+
+C2H_TEST("bulk can modify the values it forwards", "[adaptors][bulk]")
+{
+  auto sndr = cudax_async::just(0) //
+            | cudax_async::bulk(cudax_async::seq_host, 10, [](int i, int& sum) {
+                sum += i;
+              });
+  auto op = cudax_async::connect(std::move(sndr), checked_value_receiver{45});
+  cudax_async::start(op);
+}
+
+C2H_TEST("bulk and bulk_chunked don't call the function when the shape is not positive", "[adaptors][bulk]")
+{
+  for (int shape : {0, -1, -5})
+  {
+    auto sndr = cudax_async::just(42) | cudax_async::bulk(cudax_async::seq_host, shape, [](int, int&) {
+                  CUDAX_FAIL("bulk function should not be called");
+                });
+    auto op = cudax_async::connect(std::move(sndr), checked_value_receiver{42});
+    cudax_async::start(op);
+
+    auto chunked_sndr =
+      cudax_async::just(42) | cudax_async::bulk_chunked(cudax_async::par_host, shape, [](int, int, int&) {
+        CUDAX_FAIL("bulk_chunked function should not be called");
+      });
+    auto chunked_op = cudax_async::connect(std::move(chunked_sndr), checked_value_receiver{42});
+    cudax_async::start(chunked_op);
+  }
+}
+
+C2H_TEST("bulk forwards errors and stopped", "[adaptors][bulk]")
+{
+  {
+    auto sndr = cudax_async::just_error(42) | cudax_async::bulk(cudax_async::seq_host, 5, [](int) {
+                  CUDAX_FAIL("bulk function should not be called");
+                });
+    auto op = cudax_async::connect(std::move(sndr), checked_error_receiver{42});
+    cudax_async::start(op);
+  }
+  {
+    auto sndr = cudax_async::just_stopped() | cudax_async::bulk(cudax_async::seq_host, 5, [](int) {
+                  CUDAX_FAIL("bulk function should not be called");
+                });
+    auto op = cudax_async::connect(std::move(sndr), checked_stopped_receiver{});
+    cudax_async::start(op);
+  }
+}
+
+C2H_TEST("bulk has the right completion signatures", "[adaptors][bulk]")
+{
+  auto nothrow_sndr = cudax_async::just(42) | cudax_async::bulk(cudax_async::seq_host, 5, [](int, int) noexcept {});
+  check_value_types<types<int>>(nothrow_sndr);
+  check_error_types<>(nothrow_sndr);
+  check_sends_stopped<false>(nothrow_sndr);
+
+  auto throwing_sndr = cudax_async::just(42) | cudax_async::bulk(cudax_async::seq_host, 5, [](int, int) {});
+  check_value_types<types<int>>(throwing_sndr);
+  check_error_types<::std::exception_ptr>(throwing_sndr);
+  check_sends_stopped<false>(throwing_sndr);
+}
+
+#if _CCCL_HAS_EXCEPTIONS() && !defined(__CUDA_ARCH__)
+C2H_TEST("bulk sends exceptions thrown by the function as errors", "[adaptors][bulk]")
+{
+  auto sndr = cudax_async::just() | cudax_async::bulk(cudax_async::seq_host, 5, [](int i) {
+                if (i == 3)
+                {
+                  throw std::runtime_error("bulk");
+                }
+              });
+  auto op = cudax_async::connect(std::move(sndr), checked_error_receiver{::std::exception_ptr{}});
+  cudax_async::start(op);
+}
+#endif // _CCCL_HAS_EXCEPTIONS() && !defined(__CUDA_ARCH__)
+
+// static_thread_pool is only available in host code.
+#if !defined(__CUDA_ARCH__)
+
+C2H_TEST("bulk on a static_thread_pool calls the function once per index", "[adaptors][bulk][static_thread_pool]")
+{
+  constexpr int shape = 1000;
+  std::vector<std::atomic<int>> counts(shape);
+
+  cudax_async::static_thread_pool pool{4};
+  auto sndr = cudax_async::just(42) | cudax_async::continues_on(pool.get_scheduler()) //
+            | cudax_async::bulk(cudax_async::par_host, shape, [&](int i, int value) {
+                CUDAX_CHECK(value == 42);
+                ++counts[i];
+              });
+  wait_for_value(std::move(sndr), 42);
+  CUDAX_CHECK(std::all_of(counts.begin(), counts.end(), [](const std::atomic<int>& count) {
+    return count == 1;
+  }));
+}
+
+C2H_TEST("bulk_chunked on a static_thread_pool splits the shape between its threads",
+         "[adaptors][bulk][static_thread_pool]")
+{
+  constexpr int shape = 1000;
+  std::vector<int> counts(shape);
+  std::atomic<int> calls{0};
+
+  cudax_async::static_thread_pool pool{4};
+  auto sndr = cudax_async::just() | cudax_async::continues_on(pool.get_scheduler()) //
+            | cudax_async::bulk_chunked(cudax_async::par_host, shape, [&](int begin, int end) {
+                ++calls;
+                for (int i = begin; i < end; ++i)
+                {
+                  ++counts[i];
+                }
+              });
+  CUDAX_CHECK(cudax_async::sync_wait(std::move(sndr)).has_value());
+  CUDAX_CHECK(calls == 4);
+  CUDAX_CHECK(std::count(counts.begin(), counts.end(), 1) == shape);
+}
+
+C2H_TEST("bulk_chunked on a static_thread_pool runs sequenced policies in one call",
+         "[adaptors][bulk][static_thread_pool]")
+{
+  std::atomic<int> calls{0};
+
+  cudax_async::static_thread_pool pool{4};
+  auto sndr = cudax_async::just() | cudax_async::continues_on(pool.get_scheduler()) //
+            | cudax_async::bulk_chunked(cudax_async::seq_host, 100, [&](int begin, int end) {
+                CUDAX_CHECK(begin == 0);
+                CUDAX_CHECK(end == 100);
+                ++calls;
+              });
+  CUDAX_CHECK(cudax_async::sync_wait(std::move(sndr)).has_value());
+  CUDAX_CHECK(calls == 1);
+}
+
+C2H_TEST("bulk_chunked on a static_thread_pool uses no more chunks than the shape",
+         "[adaptors][bulk][static_thread_pool]")
+{
+  std::atomic<int> calls{0};
+
+  cudax_async::static_thread_pool pool{4};
+  auto sndr = cudax_async::just() | cudax_async::continues_on(pool.get_scheduler()) //
+            | cudax_async::bulk_chunked(cudax_async::par_host, 2, [&](int begin, int end) {
+                CUDAX_CHECK(end == begin + 1);
+                ++calls;
+              });
+  CUDAX_CHECK(cudax_async::sync_wait(std::move(sndr)).has_value());
+  CUDAX_CHECK(calls == 2);
+
+  auto empty_sndr = cudax_async::just(42) | cudax_async::continues_on(pool.get_scheduler()) //
+                  | cudax_async::bulk(cudax_async::par_host, 0, [](int, int) {
+                      CUDAX_FAIL("bulk function should not be called");
+                    });
+  wait_for_value(std::move(empty_sndr), 42);
+}
+
+C2H_TEST("bulk on a static_thread_pool doesn't call the function when the shape is not positive",
+         "[adaptors][bulk][static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{4};
+  for (int shape : {0, -1, -5})
+  {
+    auto sndr = cudax_async::just(42) | cudax_async::continues_on(pool.get_scheduler()) //
+              | cudax_async::bulk(cudax_async::par_host, shape, [](int, int) {
+                  CUDAX_FAIL("bulk function should not be called");
+                });
+    wait_for_value(std::move(sndr), 42);
+
+    auto chunked_sndr = cudax_async::just(42) | cudax_async::continues_on(pool.get_scheduler()) //
+                      | cudax_async::bulk_chunked(cudax_async::par_host, shape, [](int, int, int) {
+                          CUDAX_FAIL("bulk_chunked function should not be called");
+                        });
+    wait_for_value(std::move(chunked_sndr), 42);
+  }
+}
+
+#  if _CCCL_HAS_EXCEPTIONS()
+C2H_TEST("bulk on a static_thread_pool sends exceptions thrown by the function as errors",
+         "[adaptors][bulk][static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{4};
+  auto sndr = cudax_async::just() | cudax_async::continues_on(pool.get_scheduler()) //
+            | cudax_async::bulk(cudax_async::par_host, 1000, [](int i) {
+                if (i % 100 == 7)
+                {
+                  throw std::runtime_error("bulk");
+                }
+              });
+  try
+  {
+    cudax_async::sync_wait(std::move(sndr));
+    CUDAX_FAIL("expected an exception");
+  }
+  catch (const std::runtime_error& e)
+  {
+    CUDAX_CHECK(std::string(e.what()) == "bulk");
+  }
+}
+#  endif // _CCCL_HAS_EXCEPTIONS()
+
+#endif // !defined(__CUDA_ARCH__)
+} // namespace
@@ -0,0 +1,155 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#if _CCCL_OS(LINUX)
+#  include <sched.h>
+#endif // _CCCL_OS(LINUX)
+
+#include "common/utility.cuh"
+#include "testing.cuh" // IWYU pragma: keep
+
+namespace
+{
+// static_thread_pool is only available in host code.
+#if !defined(__CUDA_ARCH__)
+
+C2H_TEST("static_thread_pool has a scheduler", "[context][static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+  CUDAX_CHECK(sched == pool.get_scheduler());
+  CUDAX_CHECK(cudax_async::get_forward_progress_guarantee(sched) == cudax_async::forward_progress_guarantee::parallel);
+  CUDAX_CHECK(pool.available_parallelism() == 2);
+
+  cudax_async::static_thread_pool other{1};
+  CUDAX_CHECK(sched != other.get_scheduler());
+}
+
+C2H_TEST("static_thread_pool runs work on its own threads", "[context][static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{2};
+  auto snd = cudax_async::starts_on(pool.get_scheduler(), cudax_async::just()) //
+           | cudax_async::then([] {
+               return std::this_thread::get_id();
+             });
+  auto [id] = cudax_async::sync_wait(std::move(snd)).value();
+  CUDAX_CHECK(id != std::this_thread::get_id());
+}
+
+C2H_TEST("static_thread_pool runs all the work scheduled before it is joined", "[context][static_thread_pool]")
+{
+  constexpr int num_tasks = 1000;
+  std::atomic<int> count{0};
+
+  cudax_async::static_thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+  for (int i = 0; i < num_tasks; ++i)
+  {
+    cudax_async::start_detached(cudax_async::starts_on(sched, cudax_async::just()) //
+                                | cudax_async::then([&] {
+                                    ++count;
+                                  }));
+  }
+  pool.join();
+
+  CUDAX_CHECK(count == num_tasks);
+}
+
+C2H_TEST("static_thread_pool runs work scheduled from its own threads", "[context][static_thread_pool]")
+{
+  constexpr int num_tasks = 100;
+  std::atomic<int> count{0};
+
+  cudax_async::static_thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+  cudax_async::start_detached(cudax_async::starts_on(sched, cudax_async::just()) //
+                              | cudax_async::then([&] {
+                                  for (int i = 0; i < num_tasks; ++i)
+                                  {
+                                    cudax_async::start_detached(cudax_async::starts_on(sched, cudax_async::just()) //
+                                                                | cudax_async::then([&] {
+                                                                    ++count;
+                                                                  }));
+                                  }
+                                }));
+  pool.join();
+
+  CUDAX_CHECK(count == num_tasks);
+}
+
+C2H_TEST("static_thread_pool can pin its threads", "[context][static_thread_pool]")
+{
+  cudax_async::static_thread_pool pool{3, cudax_async::thread_affinity::one_cpu_per_thread};
+  auto snd = cudax_async::starts_on(pool.get_scheduler(), cudax_async::just(42));
+  wait_for_value(std::move(snd), 42);
+
+#  if _CCCL_OS(LINUX)
+  // Each worker runs on a single CPU, among the ones the process may run on, and different workers run on different
+  // CPUs as long as there are enough of them.
+  cpu_set_t allowed;
+  CUDAX_REQUIRE(sched_getaffinity(0, sizeof(allowed), &allowed) == 0);
+
+  // Catch2 assertions aren't thread safe, so the workers only record what they see.
+  struct placement
+  {
+    std::thread::id id;
+    int cpu_count;
+    int cpu;
+  };
+  std::mutex mtx;
+  std::vector<placement> placements;
+  auto sched = pool.get_scheduler();
+  for (int i = 0; i < 100; ++i)
+  {
+    cudax_async::start_detached(cudax_async::starts_on(sched, cudax_async::just()) //
+                                | cudax_async::then([&] {
+                                    cpu_set_t set;
+                                    CPU_ZERO(&set);
+                                    sched_getaffinity(0, sizeof(set), &set);
+                                    int cpu = 0;
+                                    while (cpu < CPU_SETSIZE && !CPU_ISSET(cpu, &set))
+                                    {
+                                      ++cpu;
+                                    }
+                                    std::lock_guard<std::mutex> guard{mtx};
+                                    placements.push_back({std::this_thread::get_id(), CPU_COUNT(&set), cpu});
+                                  }));
+  }
+  pool.join();
+  CUDAX_REQUIRE(placements.size() == 100);
+
+  std::map<std::thread::id, int> cpus;
+  for (const auto& p : placements)
+  {
+    CUDAX_CHECK(p.cpu_count == 1);
+    CUDAX_CHECK(CPU_ISSET(p.cpu, &allowed));
+    cpus[p.id] = p.cpu;
+  }
+  std::set<int> distinct;
+  for (const auto& [id, cpu] : cpus)
+  {
+    distinct.insert(cpu);
+  }
+  CUDAX_CHECK(distinct.size() == std::min<std::size_t>(cpus.size(), CPU_COUNT(&allowed)));
+#  endif // _CCCL_OS(LINUX)
+}
+
+#endif // !defined(__CUDA_ARCH__)
+} // namespace
@@ -0,0 +1,259 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___BARRIER_TREE_BARRIER_H
+#define _CUDA___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__atomic/api/owned.h>
+#include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__barrier/empty_completion.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4324) // structure was padded due to alignment specifier
+
+// A small index which is unique to the calling thread, assigned in the order in which threads first arrive at any tree
+// barrier. Consecutive threads arrive at the same leaf of a barrier, so that a fixed team of threads fills its leaves
+// without probing.
+_CCCL_HOST_API inline _CUDA_VSTD::size_t __tree_barrier_thread_index()
+{
+  static _CUDA_VSTD::__atomic_impl<_CUDA_VSTD::size_t, thread_scope_system> __next(0);
+  static thread_local const _CUDA_VSTD::size_t __index = __next.fetch_add(1, _CUDA_VSTD::memory_order_relaxed);
+  return __index;
+}
+
+//! @brief A host barrier with the interface of @c cuda::barrier, whose arrivals are combined in a tree of counters
+//! rather than a single one.
+//!
+//! Each leaf of the tree is a cache line which expects up to four arrivals, and each inner node expects one arrival
+//! from each of its children, so that no counter is hit by more than a handful of threads per phase. The thread whose
+//! arrival completes a node arrives at its parent, and the one which completes the root runs the completion function,
+//! resets the tree and starts the next phase. This makes arrivals much cheaper than on @c cuda::barrier when many
+//! threads arrive at the same time, at the cost of a heap allocation proportional to the expected count, and of a
+//! longer completion step.
+//!
+//! Threads arrive at the leaf chosen by their index in the program, and move on to the next leaf when it's full.
+//!
+//! @tparam _Sco The scope of the threads which arrive at the barrier
+//! @tparam _CompletionF The type of the completion function
+template <thread_scope _Sco, class _CompletionF = _CUDA_VSTD::__empty_completion>
+class tree_barrier
+{
+  static constexpr _CUDA_VSTD::ptrdiff_t __radix = 4;
+
+  struct alignas(64) __node
+  {
+    _CUDA_VSTD::__atomic_impl<_CUDA_VSTD::ptrdiff_t, _Sco> __arrived{0};
+    // Only changes during the completion step, when no thread arrives.
+    _CUDA_VSTD::__atomic_impl<_CUDA_VSTD::ptrdiff_t, _Sco> __expected{0};
+    _CUDA_VSTD::ptrdiff_t __parent = -1;
+  };
+
+  // Leaves first, then each level of inner nodes, with the root last.
+  __node* __nodes;
+  _CUDA_VSTD::ptrdiff_t __node_count;
+  _CUDA_VSTD::ptrdiff_t __leaf_count;
+  _CUDA_VSTD::ptrdiff_t __expected;
+  _CUDA_VSTD::__atomic_impl<_CUDA_VSTD::ptrdiff_t, _Sco> __dropped{0};
+  _CompletionF __completion;
+  alignas(64) _CUDA_VSTD::__atomic_impl<bool, _Sco> __phase{false};
+
+  [[nodiscard]] _CCCL_HOST_API static _CUDA_VSTD::ptrdiff_t __ceil_div(_CUDA_VSTD::ptrdiff_t __a) noexcept
+  {
+    return (__a + __radix - 1) / __radix;
+  }
+
+  // Spreads the expected count over the leaves, densely, and updates the inner nodes to only expect the children which
+  // expect arrivals themselves.
+  _CCCL_HOST_API void __distribute(_CUDA_VSTD::ptrdiff_t __count) noexcept
+  {
+    for (_CUDA_VSTD::ptrdiff_t __i = 0; __i < __node_count; ++__i)
+    {
+      _CUDA_VSTD::ptrdiff_t __expected_here = 0;
+      if (__i < __leaf_count)
+      {
+        const _CUDA_VSTD::ptrdiff_t __left = __count - __i * __radix;
+        __expected_here                    = __left < 0 ? 0 : (__left < __radix ? __left : __radix);
+      }
+      __nodes[__i].__expected.store(__expected_here, _CUDA_VSTD::memory_order_relaxed);
+    }
+    // Children are stored before their parents, so each node is final by the time it's visited.
+    for (_CUDA_VSTD::ptrdiff_t __i = 0; __i < __node_count; ++__i)
+    {
+      if (__nodes[__i].__parent >= 0 && __nodes[__i].__expected.load(_CUDA_VSTD::memory_order_relaxed) != 0)
+      {
+        __nodes[__nodes[__i].__parent].__expected.fetch_add(1, _CUDA_VSTD::memory_order_relaxed);
+      }
+    }
+  }
+
+  _CCCL_HOST_API void __complete(bool __old_phase)
+  {
+    __completion();
+
+    for (_CUDA_VSTD::ptrdiff_t __i = 0; __i < __node_count; ++__i)
+    {
+      __nodes[__i].__arrived.store(0, _CUDA_VSTD::memory_order_relaxed);
+    }
+    const _CUDA_VSTD::ptrdiff_t __dropped_now = __dropped.exchange(0, _CUDA_VSTD::memory_order_relaxed);
+    if (__dropped_now != 0)
+    {
+      __expected -= __dropped_now;
+      __distribute(__expected);
+    }
+
+    __phase.store(!__old_phase, _CUDA_VSTD::memory_order_release);
+    __phase.notify_all();
+  }
+
+  // Arrives at the inner nodes from __node up, for as long as the arrivals complete them.
+  _CCCL_HOST_API void __arrive_from(_CUDA_VSTD::ptrdiff_t __node, bool __old_phase)
+  {
+    for (; __node >= 0; __node = __nodes[__node].__parent)
+    {
+      const _CUDA_VSTD::ptrdiff_t __old = __nodes[__node].__arrived.fetch_add(1, _CUDA_VSTD::memory_order_acq_rel);
+      if (__old + 1 != __nodes[__node].__expected.load(_CUDA_VSTD::memory_order_relaxed))
+      {
+        return;
+      }
+    }
+    __complete(__old_phase);
+  }
+
+public:
+  using arrival_token = bool;
+
+  //! @brief Constructs a barrier for @p __expected arrivals per phase.
+  //! @param __expected The number of arrivals per phase
+  //! @param __completion The function called by the last thread to arrive in each phase
+  _CCCL_HOST_API explicit tree_barrier(_CUDA_VSTD::ptrdiff_t __expected, _CompletionF __completion = _CompletionF())
+      : __nodes(nullptr)
+      , __node_count(0)
+      , __leaf_count(__ceil_div(__expected) > 0 ? __ceil_div(__expected) : 1)
+      , __expected(__expected)
+      , __completion(_CUDA_VSTD::move(__completion))
+  {
+    _CCCL_ASSERT(__expected >= 0, "Cannot initialize barrier with negative arrival count");
+
+    for (_CUDA_VSTD::ptrdiff_t __level = __leaf_count; __level > 1; __level = __ceil_div(__level))
+    {
+      __node_count += __level;
+    }
+    ++__node_count;
+
+    __nodes = new __node[__node_count];
+    for (_CUDA_VSTD::ptrdiff_t __first = 0, __level = __leaf_count; __level > 1;
+         __first += __level, __level = __ceil_div(__level))
+    {
+      for (_CUDA_VSTD::ptrdiff_t __i = 0; __i < __level; ++__i)
+      {
+        __nodes[__first + __i].__parent = __first + __level + __i / __radix;
+      }
+    }
+    __distribute(__expected);
+  }
+
+  tree_barrier(const tree_barrier&)            = delete;
+  tree_barrier& operator=(const tree_barrier&) = delete;
+
+  _CCCL_HOST_API ~tree_barrier()
+  {
+    delete[] __nodes;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API arrival_token arrive(_CUDA_VSTD::ptrdiff_t __update = 1)
+  {
+    _CCCL_ASSERT(__update > 0, "Barrier arrive must update by a positive count");
+
+    // Acquire, so that the reset of the tree by the completion of the previous phase is visible.
+    const bool __old_phase = __phase.load(_CUDA_VSTD::memory_order_acquire);
+
+    _CUDA_VSTD::ptrdiff_t __leaf = static_cast<_CUDA_VSTD::ptrdiff_t>(
+      __tree_barrier_thread_index() / __radix % static_cast<_CUDA_VSTD::size_t>(__leaf_count));
+    [[maybe_unused]] _CUDA_VSTD::ptrdiff_t __full_leaves = 0;
+    while (true)
+    {
+      __node& __n                                 = __nodes[__leaf];
+      const _CUDA_VSTD::ptrdiff_t __leaf_expected = __n.__expected.load(_CUDA_VSTD::memory_order_relaxed);
+      // Leaves stay full until the end of the phase, so full leaves are skipped without writing to them.
+      if (__n.__arrived.load(_CUDA_VSTD::memory_order_relaxed) < __leaf_expected)
+      {
+        const _CUDA_VSTD::ptrdiff_t __old = __n.__arrived.fetch_add(__update, _CUDA_VSTD::memory_order_acq_rel);
+        if (__old < __leaf_expected)
+        {
+          const _CUDA_VSTD::ptrdiff_t __left  = __leaf_expected - __old;
+          const _CUDA_VSTD::ptrdiff_t __taken = __left < __update ? __left : __update;
+          __update -= __taken;
+          // The phase can't complete before all of the update is counted, so this never arrives at the next phase.
+          if (__taken == __left)
+          {
+            __arrive_from(__n.__parent, __old_phase);
+          }
+          if (__update == 0)
+          {
+            break;
+          }
+          __full_leaves = 0;
+        }
+      }
+      ++__full_leaves;
+      _CCCL_ASSERT(__full_leaves <= __leaf_count, "Barrier arrive exceeds the expected count of the phase");
+      __leaf = __leaf + 1 == __leaf_count ? 0 : __leaf + 1;
+    }
+
+    return __old_phase;
+  }
+
+  _CCCL_HOST_API void wait(arrival_token&& __old_phase) const
+  {
+    __phase.wait(__old_phase, _CUDA_VSTD::memory_order_acquire);
+  }
+
+  _CCCL_HOST_API void arrive_and_wait()
+  {
+    wait(arrive());
+  }
+
+  _CCCL_HOST_API void arrive_and_drop()
+  {
+    __dropped.fetch_add(1, _CUDA_VSTD::memory_order_relaxed);
+    (void) arrive();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr _CUDA_VSTD::ptrdiff_t max() noexcept
+  {
+    return _CUDA_VSTD::numeric_limits<_CUDA_VSTD::ptrdiff_t>::max();
+  }
+};
+
+_CCCL_DIAG_POP
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___BARRIER_TREE_BARRIER_H
@@ -0,0 +1,265 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_INPLACE_MERGE_H
+#define _LIBCUDACXX___ALGORITHM_INPLACE_MERGE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/lower_bound.h>
+#include <cuda/std/__algorithm/move.h>
+#include <cuda/std/__algorithm/move_backward.h>
+#include <cuda/std/__algorithm/rotate.h>
+#include <cuda/std/__algorithm/upper_bound.h>
+#include <cuda/std/__functional/identity.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/is_trivially_copyable.h>
+#include <cuda/std/__type_traits/is_trivially_default_constructible.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstddef>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// The merges use a small buffer on the stack, rather than one proportional to the input, so that they never allocate.
+// Only values which can be copied around as bytes are buffered, because the buffer holds default constructed values.
+template <class _Tp>
+using __use_merge_buffer =
+  integral_constant<bool,
+                    _CCCL_TRAIT(is_trivially_copyable, _Tp) && _CCCL_TRAIT(is_trivially_default_constructible, _Tp)>;
+
+template <class _Tp>
+struct __merge_buffer_size
+{
+  static constexpr ptrdiff_t __bytes = 512;
+  static constexpr ptrdiff_t value   = sizeof(_Tp) < __bytes ? __bytes / static_cast<ptrdiff_t>(sizeof(_Tp)) : 1;
+};
+
+// Merges [__first, __middle) and [__middle, __last) by moving the shorter of them to __buff first, which must be large
+// enough for it.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _BidirectionalIterator, class _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __buffered_inplace_merge(
+  _BidirectionalIterator __first,
+  _BidirectionalIterator __middle,
+  _BidirectionalIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_BidirectionalIterator>::difference_type __len1,
+  typename iterator_traits<_BidirectionalIterator>::difference_type __len2,
+  _Tp* __buff)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+  if (__len1 <= __len2)
+  {
+    _Tp* __buff_last = _CUDA_VSTD::__move<_AlgPolicy>(__first, __middle, __buff).second;
+    // Merge forward, into the space freed at the front. The elements of the second range which remain at the end are
+    // already in place.
+    _Tp* __buff_first = __buff;
+    for (; __buff_first != __buff_last; ++__first)
+    {
+      if (__middle == __last)
+      {
+        _CUDA_VSTD::__move<_AlgPolicy>(__buff_first, __buff_last, __first);
+        return;
+      }
+      if (__comp(*__middle, *__buff_first))
+      {
+        *__first = _Ops::__iter_move(__middle);
+        ++__middle;
+      }
+      else
+      {
+        *__first = _CUDA_VSTD::move(*__buff_first);
+        ++__buff_first;
+      }
+    }
+  }
+  else
+  {
+    _Tp* __buff_last = _CUDA_VSTD::__move<_AlgPolicy>(__middle, __last, __buff).second;
+    // Merge backward, into the space freed at the back. Equal elements are taken from the second range first, so that
+    // they stay after the ones of the first range.
+    while (__buff_last != __buff)
+    {
+      if (__middle == __first)
+      {
+        _CUDA_VSTD::__move_backward<_AlgPolicy>(__buff, __buff_last, __last);
+        return;
+      }
+      _BidirectionalIterator __prev = _Ops::prev(__middle);
+      if (__comp(*(__buff_last - 1), *__prev))
+      {
+        *--__last = _Ops::__iter_move(__prev);
+        __middle  = __prev;
+      }
+      else
+      {
+        *--__last = _CUDA_VSTD::move(*--__buff_last);
+      }
+    }
+  }
+}
+
+// Merges the sorted ranges [__first, __middle) and [__middle, __last) stably. Once either of them fits in the buffer
+// they are merged linearly, otherwise they are split into four ranges and the middle two are rotated, so that the
+// merge becomes two smaller ones.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _BidirectionalIterator, class _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __inplace_merge(
+  _BidirectionalIterator __first,
+  _BidirectionalIterator __middle,
+  _BidirectionalIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_BidirectionalIterator>::difference_type __len1,
+  typename iterator_traits<_BidirectionalIterator>::difference_type __len2,
+  _Tp* __buff,
+  ptrdiff_t __buff_size)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_BidirectionalIterator>::difference_type;
+
+  while (true)
+  {
+    if (__len2 == 0)
+    {
+      return;
+    }
+    if (__len1 <= __buff_size || __len2 <= __buff_size)
+    {
+      _CUDA_VSTD::__buffered_inplace_merge<_AlgPolicy, _Compare>(
+        __first, __middle, __last, __comp, __len1, __len2, __buff);
+      return;
+    }
+    // Skip the elements at the front of the first range which are already in place.
+    for (; true; ++__first, (void) --__len1)
+    {
+      if (__len1 == 0)
+      {
+        return;
+      }
+      if (__comp(*__middle, *__first))
+      {
+        break;
+      }
+    }
+    // Split [__first, __middle) into [__first, __m1) [__m1, __middle) and [__middle, __last) into [__middle, __m2)
+    // [__m2, __last), so that [__middle, __m2) goes before [__m1, __middle), with one of the splits at the middle of
+    // its range.
+    _BidirectionalIterator __m1 = __first;
+    _BidirectionalIterator __m2 = __middle;
+    difference_type __len11     = 0;
+    difference_type __len21     = 0;
+    __identity __proj{};
+    if (__len1 < __len2)
+    {
+      __len21 = __len2 / 2;
+      __m2    = _Ops::next(__middle, __len21);
+      __m1    = _CUDA_VSTD::__upper_bound<_AlgPolicy>(__first, __middle, *__m2, __comp, __proj);
+      __len11 = _Ops::distance(__first, __m1);
+    }
+    else
+    {
+      if (__len1 == 1)
+      {
+        // Both ranges have a single element, and *__first > *__middle.
+        _Ops::iter_swap(__first, __middle);
+        return;
+      }
+      __len11 = __len1 / 2;
+      __m1    = _Ops::next(__first, __len11);
+      __m2    = _CUDA_VSTD::__lower_bound<_AlgPolicy>(__middle, __last, *__m1, __comp, __proj);
+      __len21 = _Ops::distance(__middle, __m2);
+    }
+    const difference_type __len12 = __len1 - __len11;
+    const difference_type __len22 = __len2 - __len21;
+    __middle                      = _CUDA_VSTD::__rotate<_AlgPolicy>(__m1, __middle, __m2).first;
+    // Merge the smaller half recursively, and the larger one in this loop.
+    if (__len11 + __len21 < __len12 + __len22)
+    {
+      _CUDA_VSTD::__inplace_merge<_AlgPolicy, _Compare>(
+        __first, __m1, __middle, __comp, __len11, __len21, __buff, __buff_size);
+      __first  = __middle;
+      __middle = __m2;
+      __len1   = __len12;
+      __len2   = __len22;
+    }
+    else
+    {
+      _CUDA_VSTD::__inplace_merge<_AlgPolicy, _Compare>(
+        __middle, __m2, __last, __comp, __len12, __len22, __buff, __buff_size);
+      __last   = __middle;
+      __middle = __m1;
+      __len1   = __len11;
+      __len2   = __len21;
+    }
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _BidirectionalIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __inplace_merge_with_buffer(
+  _BidirectionalIterator __first, _BidirectionalIterator __middle, _BidirectionalIterator __last, _Compare __comp)
+{
+  using value_type = typename iterator_traits<_BidirectionalIterator>::value_type;
+  using _Ops       = _IterOps<_AlgPolicy>;
+
+  const auto __len1 = _Ops::distance(__first, __middle);
+  const auto __len2 = _Ops::distance(__middle, __last);
+  if constexpr (__use_merge_buffer<value_type>::value)
+  {
+    value_type __buff[__merge_buffer_size<value_type>::value]{};
+    _CUDA_VSTD::__inplace_merge<_AlgPolicy, _Compare>(
+      __first, __middle, __last, __comp, __len1, __len2, __buff, __merge_buffer_size<value_type>::value);
+  }
+  else
+  {
+    _CUDA_VSTD::__inplace_merge<_AlgPolicy, _Compare>(
+      __first, __middle, __last, __comp, __len1, __len2, static_cast<value_type*>(nullptr), 0);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _BidirectionalIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void inplace_merge(
+  _BidirectionalIterator __first, _BidirectionalIterator __middle, _BidirectionalIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _BidirectionalIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _BidirectionalIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__inplace_merge_with_buffer<_ClassicAlgPolicy, __comp_ref_type<_Compare>>(
+    _CUDA_VSTD::move(__first), _CUDA_VSTD::move(__middle), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _BidirectionalIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+inplace_merge(_BidirectionalIterator __first, _BidirectionalIterator __middle, _BidirectionalIterator __last)
+{
+  _CUDA_VSTD::inplace_merge(__first, __middle, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___ALGORITHM_INPLACE_MERGE_H
@@ -0,0 +1,129 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
+#define _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/partial_sort.h>
+#include <cuda/std/__algorithm/sort.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__utility/move.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Introselect: quickselect on the median of three, which falls back to a heap select once it has partitioned the
+// range 2 * log2(n) times without finding the nth element.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __nth_element(
+  _RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare __comp)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  constexpr difference_type __insertion_sort_limit = 8;
+
+  if (__nth == __last)
+  {
+    return;
+  }
+  difference_type __depth = 2
+                          * static_cast<difference_type>(_CUDA_VSTD::__bit_log2(
+                            static_cast<make_unsigned_t<difference_type>>(__last - __first)));
+  bool __leftmost = true;
+  while (true)
+  {
+    const difference_type __len = __last - __first;
+    if (__len <= __insertion_sort_limit)
+    {
+      _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+      return;
+    }
+    if (__depth-- == 0)
+    {
+      _CUDA_VSTD::__partial_sort_impl<_AlgPolicy>(__first, __nth + 1, __last, __comp);
+      return;
+    }
+
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + __len / 2, __first, __last - 1, __comp);
+
+    // As in __pdqsort, when the pivot equals the element before the range, all the elements which are not greater
+    // than the pivot are equal to it.
+    if (!__leftmost && !__comp(*(__first - 1), *__first))
+    {
+      const _RandomAccessIterator __pivot_pos =
+        _CUDA_VSTD::__partition_with_equals_on_left<_AlgPolicy, _Compare>(__first, __last, __comp);
+      if (__nth <= __pivot_pos)
+      {
+        return;
+      }
+      __first = __pivot_pos + 1;
+      continue;
+    }
+
+    const _RandomAccessIterator __pivot_pos =
+      _CUDA_VSTD::__partition_with_equals_on_right<_AlgPolicy, _Compare>(__first, __last, __comp).first;
+    if (__nth == __pivot_pos)
+    {
+      return;
+    }
+    if (__nth < __pivot_pos)
+    {
+      __last = __pivot_pos;
+    }
+    else
+    {
+      __first    = __pivot_pos + 1;
+      __leftmost = false;
+    }
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _RandomAccessIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void nth_element(
+  _RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__nth_element<_ClassicAlgPolicy, __comp_ref_type<_Compare>>(
+    _CUDA_VSTD::move(__first), _CUDA_VSTD::move(__nth), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+nth_element(_RandomAccessIterator __first, _RandomAccessIterator __nth, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::nth_element(__first, __nth, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___ALGORITHM_NTH_ELEMENT_H
@@ -0,0 +1,799 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_SORT_H
+#define _LIBCUDACXX___ALGORITHM_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/partial_sort.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Comparators which are known to be cheap and to compare the values directly, so that the comparison results can be
+// used to select values rather than to branch.
+template <class _Compare>
+struct __is_simple_comparator : false_type
+{};
+template <>
+struct __is_simple_comparator<__less> : true_type
+{};
+template <class _Tp>
+struct __is_simple_comparator<less<_Tp>> : true_type
+{};
+template <class _Tp>
+struct __is_simple_comparator<greater<_Tp>> : true_type
+{};
+
+template <class _Compare, class _Iter, class _Tp = typename iterator_traits<_Iter>::value_type>
+using __use_branchless_sort =
+  integral_constant<bool,
+                    __is_cpp17_contiguous_iterator<_Iter>::value && sizeof(_Tp) <= sizeof(void*)
+                      && _CCCL_TRAIT(is_arithmetic, _Tp) && __is_simple_comparator<remove_cvref_t<_Compare>>::value>;
+
+// Sorts *__x and *__y without branching on the result of the comparison.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+__cond_swap(_RandomAccessIterator __x, _RandomAccessIterator __y, _Compare __comp)
+{
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  const bool __r   = __comp(*__x, *__y);
+  value_type __tmp = __r ? *__x : *__y;
+  *__y             = __r ? *__y : *__x;
+  *__x             = __tmp;
+}
+
+// Sorts *__x, *__y and *__z without branching, assuming that *__y and *__z are already sorted.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __partially_sorted_swap(
+  _RandomAccessIterator __x, _RandomAccessIterator __y, _RandomAccessIterator __z, _Compare __comp)
+{
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  bool __r         = __comp(*__z, *__x);
+  value_type __tmp = __r ? *__z : *__x;
+  *__z             = __r ? *__x : *__z;
+  __r              = __comp(__tmp, *__y);
+  *__x             = __r ? *__x : *__y;
+  *__y             = __r ? *__y : __tmp;
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+__sort3(_RandomAccessIterator __x, _RandomAccessIterator __y, _RandomAccessIterator __z, _Compare __comp)
+{
+  if constexpr (__use_branchless_sort<_Compare, _RandomAccessIterator>::value)
+  {
+    _CUDA_VSTD::__cond_swap<_Compare>(__y, __z, __comp);
+    _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x, __y, __z, __comp);
+  }
+  else
+  {
+    using _Ops = _IterOps<_AlgPolicy>;
+    if (!__comp(*__y, *__x))
+    {
+      if (!__comp(*__z, *__y))
+      {
+        return;
+      }
+      _Ops::iter_swap(__y, __z);
+      if (__comp(*__y, *__x))
+      {
+        _Ops::iter_swap(__x, __y);
+      }
+      return;
+    }
+    if (__comp(*__z, *__y))
+    {
+      _Ops::iter_swap(__x, __z);
+      return;
+    }
+    _Ops::iter_swap(__x, __y);
+    if (__comp(*__z, *__y))
+    {
+      _Ops::iter_swap(__y, __z);
+    }
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __sort4(
+  _RandomAccessIterator __x1,
+  _RandomAccessIterator __x2,
+  _RandomAccessIterator __x3,
+  _RandomAccessIterator __x4,
+  _Compare __comp)
+{
+  if constexpr (__use_branchless_sort<_Compare, _RandomAccessIterator>::value)
+  {
+    _CUDA_VSTD::__cond_swap<_Compare>(__x1, __x3, __comp);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x4, __comp);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x1, __x2, __comp);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x3, __x4, __comp);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x3, __comp);
+  }
+  else
+  {
+    using _Ops = _IterOps<_AlgPolicy>;
+    _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__x1, __x2, __x3, __comp);
+    if (__comp(*__x4, *__x3))
+    {
+      _Ops::iter_swap(__x3, __x4);
+      if (__comp(*__x3, *__x2))
+      {
+        _Ops::iter_swap(__x2, __x3);
+        if (__comp(*__x2, *__x1))
+        {
+          _Ops::iter_swap(__x1, __x2);
+        }
+      }
+    }
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __sort5(
+  _RandomAccessIterator __x1,
+  _RandomAccessIterator __x2,
+  _RandomAccessIterator __x3,
+  _RandomAccessIterator __x4,
+  _RandomAccessIterator __x5,
+  _Compare __comp)
+{
+  if constexpr (__use_branchless_sort<_Compare, _RandomAccessIterator>::value)
+  {
+    _CUDA_VSTD::__cond_swap<_Compare>(__x1, __x2, __comp);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x4, __x5, __comp);
+    _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x3, __x4, __x5, __comp);
+    _CUDA_VSTD::__cond_swap<_Compare>(__x2, __x5, __comp);
+    _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x1, __x3, __x4, __comp);
+    _CUDA_VSTD::__partially_sorted_swap<_Compare>(__x2, __x3, __x4, __comp);
+  }
+  else
+  {
+    using _Ops = _IterOps<_AlgPolicy>;
+    _CUDA_VSTD::__sort4<_AlgPolicy, _Compare>(__x1, __x2, __x3, __x4, __comp);
+    if (__comp(*__x5, *__x4))
+    {
+      _Ops::iter_swap(__x4, __x5);
+      if (__comp(*__x4, *__x3))
+      {
+        _Ops::iter_swap(__x3, __x4);
+        if (__comp(*__x3, *__x2))
+        {
+          _Ops::iter_swap(__x2, __x3);
+          if (__comp(*__x2, *__x1))
+          {
+            _Ops::iter_swap(__x1, __x2);
+          }
+        }
+      }
+    }
+  }
+}
+
+// Sorts [__first, __last) stably by insertion.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _BidirectionalIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+__insertion_sort(_BidirectionalIterator __first, _BidirectionalIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_BidirectionalIterator>::value_type;
+  if (__first == __last)
+  {
+    return;
+  }
+  _BidirectionalIterator __i = __first;
+  for (++__i; __i != __last; ++__i)
+  {
+    _BidirectionalIterator __j = __i;
+    --__j;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _BidirectionalIterator __k = __j;
+      __j                        = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__j != __first && __comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+    }
+  }
+}
+
+// Same as __insertion_sort, but relies on *(__first - 1) being no greater than any element of the range to stop the
+// inner loop without checking the bounds.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+__insertion_sort_unguarded(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+  if (__first == __last)
+  {
+    return;
+  }
+  for (_RandomAccessIterator __i = __first + 1; __i != __last; ++__i)
+  {
+    _RandomAccessIterator __j = __i - 1;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+    }
+  }
+}
+
+// Attempts to sort [__first, __last) by insertion, and gives up after a few elements were moved. Returns whether the
+// range is sorted.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr bool
+__insertion_sort_incomplete(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  switch (__last - __first)
+  {
+    case 0:
+    case 1:
+      return true;
+    case 2:
+      if (__comp(*--__last, *__first))
+      {
+        _Ops::iter_swap(__first, __last);
+      }
+      return true;
+    case 3:
+      _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first, __first + 1, --__last, __comp);
+      return true;
+    case 4:
+      _CUDA_VSTD::__sort4<_AlgPolicy, _Compare>(__first, __first + 1, __first + 2, --__last, __comp);
+      return true;
+    case 5:
+      _CUDA_VSTD::__sort5<_AlgPolicy, _Compare>(__first, __first + 1, __first + 2, __first + 3, --__last, __comp);
+      return true;
+    default:
+      break;
+  }
+  constexpr difference_type __limit = 8;
+  difference_type __count           = 0;
+  for (_RandomAccessIterator __i = __first + 1; __i != __last; ++__i)
+  {
+    _RandomAccessIterator __j = __i - 1;
+    if (__comp(*__i, *__j))
+    {
+      value_type __t(_Ops::__iter_move(__i));
+      _RandomAccessIterator __k = __j;
+      __j                       = __i;
+      do
+      {
+        *__j = _Ops::__iter_move(__k);
+        __j  = __k;
+      } while (__j != __first && __comp(__t, *--__k));
+      *__j = _CUDA_VSTD::move(__t);
+      if (++__count == __limit)
+      {
+        return ++__i == __last;
+      }
+    }
+  }
+  return true;
+}
+
+// Partitions [__begin, __end) around the pivot *__begin, putting the elements equal to the pivot on the right.
+// Returns the final position of the pivot, and whether the range was already partitioned. Requires an element not
+// less than the pivot after it.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr pair<_RandomAccessIterator, bool>
+__partition_with_equals_on_right(_RandomAccessIterator __begin, _RandomAccessIterator __end, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  value_type __pivot(_Ops::__iter_move(__begin));
+  _RandomAccessIterator __first = __begin;
+  _RandomAccessIterator __last  = __end;
+
+  // The search for an element not less than the pivot is bounded by the precondition.
+  while (__comp(*++__first, __pivot))
+  {
+  }
+  // The search for an element less than the pivot is bounded by the pivot position unless the first search moved.
+  if (__first - 1 == __begin)
+  {
+    while (__first < __last && !__comp(*--__last, __pivot))
+    {
+    }
+  }
+  else
+  {
+    while (!__comp(*--__last, __pivot))
+    {
+    }
+  }
+
+  const bool __already_partitioned = __first >= __last;
+  while (__first < __last)
+  {
+    _Ops::iter_swap(__first, __last);
+    while (__comp(*++__first, __pivot))
+    {
+    }
+    while (!__comp(*--__last, __pivot))
+    {
+    }
+  }
+
+  _RandomAccessIterator __pivot_pos = __first - 1;
+  if (__begin != __pivot_pos)
+  {
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  }
+  *__pivot_pos = _CUDA_VSTD::move(__pivot);
+  return {__pivot_pos, __already_partitioned};
+}
+
+// Partitions [__begin, __end) around the pivot *__begin, putting the elements equal to the pivot on the left. Returns
+// the final position of the pivot.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr _RandomAccessIterator
+__partition_with_equals_on_left(_RandomAccessIterator __begin, _RandomAccessIterator __end, _Compare __comp)
+{
+  using _Ops       = _IterOps<_AlgPolicy>;
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  value_type __pivot(_Ops::__iter_move(__begin));
+  _RandomAccessIterator __first = __begin;
+  _RandomAccessIterator __last  = __end;
+
+  while (__comp(__pivot, *--__last))
+  {
+  }
+  if (__last + 1 == __end)
+  {
+    while (__first < __last && !__comp(__pivot, *++__first))
+    {
+    }
+  }
+  else
+  {
+    while (!__comp(__pivot, *++__first))
+    {
+    }
+  }
+
+  while (__first < __last)
+  {
+    _Ops::iter_swap(__first, __last);
+    while (__comp(__pivot, *--__last))
+    {
+    }
+    while (!__comp(__pivot, *++__first))
+    {
+    }
+  }
+
+  _RandomAccessIterator __pivot_pos = __last;
+  if (__begin != __pivot_pos)
+  {
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  }
+  *__pivot_pos = _CUDA_VSTD::move(__pivot);
+  return __pivot_pos;
+}
+
+// The block partition below records the outcome of the comparisons of a block of elements in a bit set, without
+// branching on them, and then swaps the misplaced elements of the left and right blocks pairwise.
+_CCCL_GLOBAL_CONSTANT int __sort_block_size = 64;
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Compare, class _RandomAccessIterator, class _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __populate_left_bitset(
+  _RandomAccessIterator __first, _Compare __comp, const _Tp& __pivot, int __size, uint64_t& __left_bitset)
+{
+  for (int __j = 0; __j < __size; ++__j, ++__first)
+  {
+    __left_bitset |= static_cast<uint64_t>(!__comp(*__first, __pivot)) << __j;
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _Compare, class _RandomAccessIterator, class _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __populate_right_bitset(
+  _RandomAccessIterator __lm1, _Compare __comp, const _Tp& __pivot, int __size, uint64_t& __right_bitset)
+{
+  for (int __j = 0; __j < __size; ++__j, --__lm1)
+  {
+    __right_bitset |= static_cast<uint64_t>(__comp(*__lm1, __pivot)) << __j;
+  }
+}
+
+// Swaps pairs of elements recorded in both bit sets, until either of them runs out.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __swap_bitmap_pos(
+  _RandomAccessIterator __first, _RandomAccessIterator __lm1, uint64_t& __left_bitset, uint64_t& __right_bitset)
+{
+  while (__left_bitset != 0 && __right_bitset != 0)
+  {
+    const int __tz_left  = _CUDA_VSTD::countr_zero(__left_bitset);
+    __left_bitset        = __left_bitset & (__left_bitset - 1);
+    const int __tz_right = _CUDA_VSTD::countr_zero(__right_bitset);
+    __right_bitset       = __right_bitset & (__right_bitset - 1);
+    _IterOps<_AlgPolicy>::iter_swap(__first + __tz_left, __lm1 - __tz_right);
+  }
+}
+
+// Moves the elements still recorded in one of the bit sets to the middle of the range, once the other side ran out.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __swap_bitmap_pos_within(
+  _RandomAccessIterator& __first, _RandomAccessIterator& __lm1, uint64_t& __left_bitset, uint64_t& __right_bitset)
+{
+  using _Ops = _IterOps<_AlgPolicy>;
+  if (__left_bitset != 0)
+  {
+    // The positions are visited from the last one so that the elements which are yet to be moved stay in place.
+    while (__left_bitset != 0)
+    {
+      const int __tz_left = __sort_block_size - 1 - _CUDA_VSTD::countl_zero(__left_bitset);
+      __left_bitset &= (static_cast<uint64_t>(1) << __tz_left) - 1;
+      _RandomAccessIterator __it = __first + __tz_left;
+      if (__it != __lm1)
+      {
+        _Ops::iter_swap(__it, __lm1);
+      }
+      --__lm1;
+    }
+    __first = __lm1 + 1;
+  }
+  else if (__right_bitset != 0)
+  {
+    while (__right_bitset != 0)
+    {
+      const int __tz_right = __sort_block_size - 1 - _CUDA_VSTD::countl_zero(__right_bitset);
+      __right_bitset &= (static_cast<uint64_t>(1) << __tz_right) - 1;
+      _RandomAccessIterator __it = __lm1 - __tz_right;
+      if (__it != __first)
+      {
+        _Ops::iter_swap(__it, __first);
+      }
+      ++__first;
+    }
+  }
+}
+
+// Same as __partition_with_equals_on_right, but without branching on the comparisons.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr pair<_RandomAccessIterator, bool>
+__bitset_partition(_RandomAccessIterator __begin, _RandomAccessIterator __end, _Compare __comp)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using value_type      = typename iterator_traits<_RandomAccessIterator>::value_type;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  value_type __pivot(_Ops::__iter_move(__begin));
+  _RandomAccessIterator __first = __begin;
+  _RandomAccessIterator __last  = __end;
+
+  while (__comp(*++__first, __pivot))
+  {
+  }
+  if (__first - 1 == __begin)
+  {
+    while (__first < __last && !__comp(*--__last, __pivot))
+    {
+    }
+  }
+  else
+  {
+    while (!__comp(*--__last, __pivot))
+    {
+    }
+  }
+
+  const bool __already_partitioned = __first >= __last;
+  if (!__already_partitioned)
+  {
+    _Ops::iter_swap(__first, __last);
+    ++__first;
+  }
+
+  // From here on the range to partition is [__first, __lm1], inclusive on both sides.
+  _RandomAccessIterator __lm1 = __last - 1;
+  uint64_t __left_bitset      = 0;
+  uint64_t __right_bitset     = 0;
+
+  while (__lm1 - __first >= 2 * __sort_block_size - 1)
+  {
+    if (__left_bitset == 0)
+    {
+      _CUDA_VSTD::__populate_left_bitset(__first, __comp, __pivot, __sort_block_size, __left_bitset);
+    }
+    if (__right_bitset == 0)
+    {
+      _CUDA_VSTD::__populate_right_bitset(__lm1, __comp, __pivot, __sort_block_size, __right_bitset);
+    }
+    _CUDA_VSTD::__swap_bitmap_pos<_AlgPolicy>(__first, __lm1, __left_bitset, __right_bitset);
+    __first += (__left_bitset == 0) ? difference_type(__sort_block_size) : difference_type(0);
+    __lm1 -= (__right_bitset == 0) ? difference_type(__sort_block_size) : difference_type(0);
+  }
+
+  // Less than a block is left on at least one of the sides, so the remaining elements are split between two partial
+  // blocks, one of which may be a block in progress.
+  {
+    const difference_type __remaining_len = __lm1 - __first + 1;
+    difference_type __l_size              = __sort_block_size;
+    difference_type __r_size              = __sort_block_size;
+    if (__left_bitset == 0 && __right_bitset == 0)
+    {
+      __l_size = __remaining_len / 2;
+      __r_size = __remaining_len - __l_size;
+    }
+    else if (__left_bitset == 0)
+    {
+      __l_size = __remaining_len - __sort_block_size;
+    }
+    else
+    {
+      __r_size = __remaining_len - __sort_block_size;
+    }
+    if (__left_bitset == 0)
+    {
+      _CUDA_VSTD::__populate_left_bitset(__first, __comp, __pivot, static_cast<int>(__l_size), __left_bitset);
+    }
+    if (__right_bitset == 0)
+    {
+      _CUDA_VSTD::__populate_right_bitset(__lm1, __comp, __pivot, static_cast<int>(__r_size), __right_bitset);
+    }
+    _CUDA_VSTD::__swap_bitmap_pos<_AlgPolicy>(__first, __lm1, __left_bitset, __right_bitset);
+    __first += (__left_bitset == 0) ? __l_size : difference_type(0);
+    __lm1 -= (__right_bitset == 0) ? __r_size : difference_type(0);
+  }
+  _CUDA_VSTD::__swap_bitmap_pos_within<_AlgPolicy>(__first, __lm1, __left_bitset, __right_bitset);
+
+  _RandomAccessIterator __pivot_pos = __first - 1;
+  if (__begin != __pivot_pos)
+  {
+    *__begin = _Ops::__iter_move(__pivot_pos);
+  }
+  *__pivot_pos = _CUDA_VSTD::move(__pivot);
+  return {__pivot_pos, __already_partitioned};
+}
+
+// Swaps a few elements of a side of an unbalanced partition with elements further inside it, to break the patterns
+// which lead to bad pivots.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __break_patterns(_RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  const difference_type __len = __last - __first;
+  if (__len >= 24)
+  {
+    const difference_type __quarter = __len / 4;
+    _Ops::iter_swap(__first, __first + __quarter);
+    _Ops::iter_swap(__last - 1, __last - __quarter);
+    if (__len > 128)
+    {
+      _Ops::iter_swap(__first + 1, __first + (__quarter + 1));
+      _Ops::iter_swap(__first + 2, __first + (__quarter + 2));
+      _Ops::iter_swap(__last - 2, __last - (__quarter + 1));
+      _Ops::iter_swap(__last - 3, __last - (__quarter + 2));
+    }
+  }
+}
+
+// Pattern-defeating quicksort: an introsort which detects sorted and reverse sorted sequences as well as runs of equal
+// elements in linear time, and shuffles the elements when it picks bad pivots. It falls back to heap sort after
+// log2(n) unbalanced partitions.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, bool _UseBitSetPartition>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __pdqsort(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __bad_allowed,
+  bool __leftmost = true)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  constexpr difference_type __insertion_sort_limit = 24;
+  constexpr difference_type __ninther_threshold    = 128;
+
+  while (true)
+  {
+    const difference_type __len = __last - __first;
+    switch (__len)
+    {
+      case 0:
+      case 1:
+        return;
+      case 2:
+        if (__comp(*--__last, *__first))
+        {
+          _Ops::iter_swap(__first, __last);
+        }
+        return;
+      case 3:
+        _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first, __first + 1, --__last, __comp);
+        return;
+      case 4:
+        _CUDA_VSTD::__sort4<_AlgPolicy, _Compare>(__first, __first + 1, __first + 2, --__last, __comp);
+        return;
+      case 5:
+        _CUDA_VSTD::__sort5<_AlgPolicy, _Compare>(__first, __first + 1, __first + 2, __first + 3, --__last, __comp);
+        return;
+      default:
+        break;
+    }
+    if (__len < __insertion_sort_limit)
+    {
+      if (__leftmost)
+      {
+        _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+      }
+      else
+      {
+        _CUDA_VSTD::__insertion_sort_unguarded<_AlgPolicy, _Compare>(__first, __last, __comp);
+      }
+      return;
+    }
+
+    // Move the median of three, or the pseudo-median of nine for large ranges, to the front.
+    const difference_type __half_len = __len / 2;
+    if (__len > __ninther_threshold)
+    {
+      _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first, __first + __half_len, __last - 1, __comp);
+      _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + 1, __first + (__half_len - 1), __last - 2, __comp);
+      _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + 2, __first + (__half_len + 1), __last - 3, __comp);
+      _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(
+        __first + (__half_len - 1), __first + __half_len, __first + (__half_len + 1), __comp);
+      _Ops::iter_swap(__first, __first + __half_len);
+    }
+    else
+    {
+      _CUDA_VSTD::__sort3<_AlgPolicy, _Compare>(__first + __half_len, __first, __last - 1, __comp);
+    }
+
+    // The element before a range which is not the leftmost one is not greater than any element in it. If it equals
+    // the pivot, so do all the elements which are not greater than the pivot, so they need no further sorting.
+    if (!__leftmost && !__comp(*(__first - 1), *__first))
+    {
+      __first = _CUDA_VSTD::__partition_with_equals_on_left<_AlgPolicy, _Compare>(__first, __last, __comp) + 1;
+      continue;
+    }
+
+    const pair<_RandomAccessIterator, bool> __ret =
+      _UseBitSetPartition
+        ? _CUDA_VSTD::__bitset_partition<_AlgPolicy, _Compare>(__first, __last, __comp)
+        : _CUDA_VSTD::__partition_with_equals_on_right<_AlgPolicy, _Compare>(__first, __last, __comp);
+    const _RandomAccessIterator __pivot_pos = __ret.first;
+
+    const difference_type __l_size = __pivot_pos - __first;
+    const difference_type __r_size = __last - (__pivot_pos + 1);
+    if (__l_size < __len / 8 || __r_size < __len / 8)
+    {
+      if (--__bad_allowed == 0)
+      {
+        _CUDA_VSTD::__partial_sort_impl<_AlgPolicy>(__first, __last, __last, __comp);
+        return;
+      }
+      _CUDA_VSTD::__break_patterns<_AlgPolicy>(__first, __pivot_pos);
+      _CUDA_VSTD::__break_patterns<_AlgPolicy>(__pivot_pos + 1, __last);
+    }
+    else if (__ret.second
+             && _CUDA_VSTD::__insertion_sort_incomplete<_AlgPolicy, _Compare>(__first, __pivot_pos, __comp)
+             && _CUDA_VSTD::__insertion_sort_incomplete<_AlgPolicy, _Compare>(__pivot_pos + 1, __last, __comp))
+    {
+      // The partition didn't move anything and both sides turned out to be almost sorted.
+      return;
+    }
+
+    // Sort the left side recursively, and the right side in this loop.
+    _CUDA_VSTD::__pdqsort<_AlgPolicy, _Compare, _RandomAccessIterator, _UseBitSetPartition>(
+      __first, __pivot_pos, __comp, __bad_allowed, __leftmost);
+    __first    = __pivot_pos + 1;
+    __leftmost = false;
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+__sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+  const difference_type __len = __last - __first;
+  if (__len < 2)
+  {
+    return;
+  }
+  const difference_type __bad_allowed =
+    static_cast<difference_type>(_CUDA_VSTD::__bit_log2(static_cast<make_unsigned_t<difference_type>>(__len)));
+  _CUDA_VSTD::__pdqsort<_AlgPolicy,
+                        _Compare,
+                        _RandomAccessIterator,
+                        __use_branchless_sort<_Compare, _RandomAccessIterator>::value>(
+    __first, __last, __comp, __bad_allowed);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _RandomAccessIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__sort<_ClassicAlgPolicy, __comp_ref_type<_Compare>>(
+    _CUDA_VSTD::move(__first), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void sort(_RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::sort(__first, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___ALGORITHM_SORT_H
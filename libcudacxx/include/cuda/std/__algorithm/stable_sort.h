@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ALGORITHM_STABLE_SORT_H
+#define _LIBCUDACXX___ALGORITHM_STABLE_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/comp_ref_type.h>
+#include <cuda/std/__algorithm/inplace_merge.h>
+#include <cuda/std/__algorithm/iterator_operations.h>
+#include <cuda/std/__algorithm/sort.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_copy_assignable.h>
+#include <cuda/std/__type_traits/is_copy_constructible.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstddef>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Equal integers can't be told apart, so when they are compared by value a stable sort is no different from any other.
+template <class _Compare, class _Tp>
+struct __compares_integers_by_value : false_type
+{};
+template <class _Tp>
+struct __compares_integers_by_value<__less, _Tp> : integral_constant<bool, _CCCL_TRAIT(is_integral, _Tp)>
+{};
+template <class _Tp>
+struct __compares_integers_by_value<less<_Tp>, _Tp> : integral_constant<bool, _CCCL_TRAIT(is_integral, _Tp)>
+{};
+template <class _Tp>
+struct __compares_integers_by_value<less<void>, _Tp> : integral_constant<bool, _CCCL_TRAIT(is_integral, _Tp)>
+{};
+template <class _Tp>
+struct __compares_integers_by_value<greater<_Tp>, _Tp> : integral_constant<bool, _CCCL_TRAIT(is_integral, _Tp)>
+{};
+template <class _Tp>
+struct __compares_integers_by_value<greater<void>, _Tp> : integral_constant<bool, _CCCL_TRAIT(is_integral, _Tp)>
+{};
+
+// Top-down merge sort, which sorts short runs by insertion and merges the halves with __inplace_merge.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator, class _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __stable_sort(
+  _RandomAccessIterator __first,
+  _RandomAccessIterator __last,
+  _Compare __comp,
+  typename iterator_traits<_RandomAccessIterator>::difference_type __len,
+  _Tp* __buff,
+  ptrdiff_t __buff_size)
+{
+  using _Ops            = _IterOps<_AlgPolicy>;
+  using difference_type = typename iterator_traits<_RandomAccessIterator>::difference_type;
+
+  constexpr difference_type __insertion_sort_limit = 32;
+
+  if (__len <= __insertion_sort_limit)
+  {
+    _CUDA_VSTD::__insertion_sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+    return;
+  }
+  const difference_type __l2        = __len / 2;
+  const _RandomAccessIterator __mid = __first + __l2;
+  _CUDA_VSTD::__stable_sort<_AlgPolicy, _Compare>(__first, __mid, __comp, __l2, __buff, __buff_size);
+  _CUDA_VSTD::__stable_sort<_AlgPolicy, _Compare>(__mid, __last, __comp, __len - __l2, __buff, __buff_size);
+  // The halves are often already in order, for example when the input was nearly sorted.
+  if (!__comp(*__mid, *_Ops::prev(__mid)))
+  {
+    return;
+  }
+  _CUDA_VSTD::__inplace_merge<_AlgPolicy, _Compare>(
+    __first, __mid, __last, __comp, __l2, __len - __l2, __buff, __buff_size);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _AlgPolicy, class _Compare, class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+__stable_sort_with_buffer(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using value_type = typename iterator_traits<_RandomAccessIterator>::value_type;
+
+  const auto __len = __last - __first;
+  if constexpr (__compares_integers_by_value<remove_cvref_t<_Compare>, value_type>::value)
+  {
+    _CUDA_VSTD::__sort<_AlgPolicy, _Compare>(__first, __last, __comp);
+  }
+  else if constexpr (__use_merge_buffer<value_type>::value)
+  {
+    value_type __buff[__merge_buffer_size<value_type>::value]{};
+    _CUDA_VSTD::__stable_sort<_AlgPolicy, _Compare>(
+      __first, __last, __comp, __len, __buff, __merge_buffer_size<value_type>::value);
+  }
+  else
+  {
+    _CUDA_VSTD::__stable_sort<_AlgPolicy, _Compare>(
+      __first, __last, __comp, __len, static_cast<value_type*>(nullptr), 0);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _RandomAccessIterator, class _Compare>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void
+stable_sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  static_assert(_CCCL_TRAIT(is_copy_constructible, _RandomAccessIterator), "Iterators must be copy constructible.");
+  static_assert(_CCCL_TRAIT(is_copy_assignable, _RandomAccessIterator), "Iterators must be copy assignable.");
+
+  _CUDA_VSTD::__stable_sort_with_buffer<_ClassicAlgPolicy, __comp_ref_type<_Compare>>(
+    _CUDA_VSTD::move(__first), _CUDA_VSTD::move(__last), __comp);
+}
+
+template <class _RandomAccessIterator>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void stable_sort(_RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+  _CUDA_VSTD::stable_sort(__first, __last, __less{});
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___ALGORITHM_STABLE_SORT_H
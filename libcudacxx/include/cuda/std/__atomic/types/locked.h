@@ -25,12 +25,134 @@
 #include <cuda/std/__atomic/scopes.h>
 #include <cuda/std/__atomic/types/base.h>
 #include <cuda/std/__atomic/types/common.h>
+#include <cuda/std/__thread/threading_support.h>
 #include <cuda/std/__type_traits/remove_cv.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+
+// With LIBCUDACXX_ENABLE_STRIPED_ATOMIC_LOCKS, locked atomics don't embed a lock, but use one of a table of locks
+// shared by the whole program, chosen by the address of the atomic; 16 byte atomics use the platform's 16 byte compare
+// and swap, where there is one. Host and device threads can't share the lock table, so this is only supported when
+// compiling without a CUDA compiler, and must be consistent across the program. The 16 byte compare and swap also
+// changes the alignment of these atomics, and makes their loads write to them.
+#if defined(LIBCUDACXX_ENABLE_STRIPED_ATOMIC_LOCKS)
+#  if _CCCL_HAS_CUDA_COMPILER()
+#    error "LIBCUDACXX_ENABLE_STRIPED_ATOMIC_LOCKS is only supported when compiling without a CUDA compiler."
+#  endif // _CCCL_HAS_CUDA_COMPILER()
+#  define _LIBCUDACXX_ATOMIC_STRIPED_LOCKS
+#  if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+#    define _LIBCUDACXX_ATOMIC_HAS_CAS16
+#  endif // __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16
+#endif // LIBCUDACXX_ENABLE_STRIPED_ATOMIC_LOCKS
 
 #include <cuda/std/__cccl/prologue.h>
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
+using __atomic_lock_t = __atomic_storage<_LIBCUDACXX_ATOMIC_FLAG_TYPE>;
+
+// Test and test-and-set: waiting threads only read the lock, so that they don't take its cache line away from the
+// owner, and back off exponentially while it's held.
+template <typename _Sco>
+_CCCL_HOST_DEVICE inline void __atomic_lock_acquire(__atomic_lock_t volatile* __lock, _Sco) noexcept
+{
+  while (0 != __atomic_exchange_dispatch(__lock, _LIBCUDACXX_ATOMIC_FLAG_TYPE(true), memory_order_acquire, _Sco{}))
+  {
+    for (int __spins = 1; 0 != __atomic_load_dispatch(__lock, memory_order_relaxed, _Sco{});)
+    {
+      if (__spins <= 64)
+      {
+        for (int __i = 0; __i < __spins; ++__i)
+        {
+          _CUDA_VSTD::__cccl_thread_yield_processor();
+        }
+        __spins *= 2;
+      }
+      else
+      {
+        _CUDA_VSTD::__cccl_thread_yield();
+      }
+    }
+  }
+}
+
+template <typename _Sco>
+_CCCL_HOST_DEVICE inline void __atomic_lock_release(__atomic_lock_t volatile* __lock, _Sco) noexcept
+{
+  __atomic_store_dispatch(__lock, _LIBCUDACXX_ATOMIC_FLAG_TYPE(false), memory_order_release, _Sco{});
+}
+
+#if defined(_LIBCUDACXX_ATOMIC_STRIPED_LOCKS)
+
+struct alignas(64) __atomic_striped_lock
+{
+  __atomic_lock_t __lock;
+};
+
+_CCCL_GLOBAL_CONSTANT size_t __atomic_lock_table_size = 256;
+
+// The table must be unique in the program, so that all the threads which access an atomic agree on its lock; it's
+// therefore a function-local static of an inline function, with default visibility.
+_CCCL_HOST inline __atomic_lock_t volatile* __atomic_lock_of(void const volatile* __addr) noexcept
+{
+  static __atomic_striped_lock __table[__atomic_lock_table_size];
+  // Fibonacci hashing: spreads the addresses of neighboring atomics over the whole table.
+  const uint64_t __hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(__addr)) * 0x9E3779B97F4A7C15ull;
+  return &__table[(__hash >> 56) % __atomic_lock_table_size].__lock;
+}
+
+#endif // _LIBCUDACXX_ATOMIC_STRIPED_LOCKS
+
+#if defined(_LIBCUDACXX_ATOMIC_HAS_CAS16)
+
+using __atomic_cas16_t = unsigned __int128;
+
+template <typename _Tp>
+struct __atomic_locked_uses_cas16
+{
+  static constexpr bool __value = sizeof(_Tp) == sizeof(__atomic_cas16_t);
+};
+
+_CCCL_HOST inline __atomic_cas16_t
+__atomic_cas16(__atomic_cas16_t volatile* __ptr, __atomic_cas16_t __expected, __atomic_cas16_t __desired) noexcept
+{
+  return __sync_val_compare_and_swap(__ptr, __expected, __desired);
+}
+
+template <typename _Tp>
+_CCCL_HOST inline __atomic_cas16_t volatile* __atomic_cas16_address(_Tp const volatile* __ptr) noexcept
+{
+  return reinterpret_cast<__atomic_cas16_t volatile*>(const_cast<_Tp volatile*>(__ptr));
+}
+
+// Compares and swaps 0 with 0, which doesn't change the value, and returns it.
+template <typename _Tp>
+_CCCL_HOST inline _Tp __atomic_cas16_load(_Tp const volatile* __ptr) noexcept
+{
+  const __atomic_cas16_t __bits = __atomic_cas16(__atomic_cas16_address(__ptr), 0, 0);
+  _Tp __ret;
+  _CUDA_VSTD::memcpy(static_cast<void*>(&__ret), &__bits, sizeof(_Tp));
+  return __ret;
+}
+
+template <typename _Tp>
+_CCCL_HOST inline __atomic_cas16_t __atomic_cas16_bits(_Tp const& __val) noexcept
+{
+  __atomic_cas16_t __bits;
+  _CUDA_VSTD::memcpy(&__bits, static_cast<const void*>(&__val), sizeof(_Tp));
+  return __bits;
+}
+
+#else // ^^^ _LIBCUDACXX_ATOMIC_HAS_CAS16 ^^^ / vvv !_LIBCUDACXX_ATOMIC_HAS_CAS16 vvv
+
+template <typename _Tp>
+struct __atomic_locked_uses_cas16
+{
+  static constexpr bool __value = false;
+};
+
+#endif // !_LIBCUDACXX_ATOMIC_HAS_CAS16
+
 // Locked atomics must override the dispatch to be able to implement RMW primitives around the embedded lock.
 template <typename _Tp>
 struct __atomic_locked_storage
@@ -38,40 +160,83 @@ struct __atomic_locked_storage
   using __underlying_t                = _Tp;
   static constexpr __atomic_tag __tag = __atomic_tag::__atomic_locked_tag;
 
-  _Tp __a_value;
-  mutable __atomic_storage<_LIBCUDACXX_ATOMIC_FLAG_TYPE> __a_lock;
+#if defined(_LIBCUDACXX_ATOMIC_STRIPED_LOCKS)
+  alignas(__atomic_locked_uses_cas16<_Tp>::__value ? 16 : alignof(_Tp)) _Tp __a_value;
 
   _CCCL_HIDE_FROM_ABI explicit constexpr __atomic_locked_storage() noexcept = default;
 
   _CCCL_HOST_DEVICE constexpr explicit inline __atomic_locked_storage(_Tp value) noexcept
       : __a_value(value)
-      , __a_lock{}
   {}
 
   template <typename _Sco>
   _CCCL_HOST_DEVICE inline void __lock(_Sco) const volatile noexcept
   {
-    while (1 == __atomic_exchange_dispatch(&__a_lock, _LIBCUDACXX_ATOMIC_FLAG_TYPE(true), memory_order_acquire, _Sco{}))
-      /*spin*/;
+    __atomic_lock_acquire(__atomic_lock_of(&__a_value), _Sco{});
   }
   template <typename _Sco>
-  _CCCL_HOST_DEVICE inline void __lock(_Sco) const noexcept
+  _CCCL_HOST_DEVICE inline void __unlock(_Sco) const volatile noexcept
   {
-    while (1 == __atomic_exchange_dispatch(&__a_lock, _LIBCUDACXX_ATOMIC_FLAG_TYPE(true), memory_order_acquire, _Sco{}))
-      /*spin*/;
+    __atomic_lock_release(__atomic_lock_of(&__a_value), _Sco{});
   }
+#else // ^^^ _LIBCUDACXX_ATOMIC_STRIPED_LOCKS ^^^ / vvv !_LIBCUDACXX_ATOMIC_STRIPED_LOCKS vvv
+  _Tp __a_value;
+  mutable __atomic_lock_t __a_lock;
+
+  _CCCL_HIDE_FROM_ABI explicit constexpr __atomic_locked_storage() noexcept = default;
+
+  _CCCL_HOST_DEVICE constexpr explicit inline __atomic_locked_storage(_Tp value) noexcept
+      : __a_value(value)
+      , __a_lock{}
+  {}
+
   template <typename _Sco>
-  _CCCL_HOST_DEVICE inline void __unlock(_Sco) const volatile noexcept
+  _CCCL_HOST_DEVICE inline void __lock(_Sco) const volatile noexcept
   {
-    __atomic_store_dispatch(&__a_lock, _LIBCUDACXX_ATOMIC_FLAG_TYPE(false), memory_order_release, _Sco{});
+    __atomic_lock_acquire(&__a_lock, _Sco{});
   }
   template <typename _Sco>
-  _CCCL_HOST_DEVICE inline void __unlock(_Sco) const noexcept
+  _CCCL_HOST_DEVICE inline void __unlock(_Sco) const volatile noexcept
   {
-    __atomic_store_dispatch(&__a_lock, _LIBCUDACXX_ATOMIC_FLAG_TYPE(false), memory_order_release, _Sco{});
+    __atomic_lock_release(&__a_lock, _Sco{});
   }
+#endif // !_LIBCUDACXX_ATOMIC_STRIPED_LOCKS
 };
 
+// Replaces the value of a locked atomic with __op(__old), where __old is its current value, and returns __old.
+template <typename _Sto, typename _Sco, typename _Op>
+_CCCL_HOST_DEVICE inline auto __atomic_locked_update(_Sto* __a, _Sco, _Op __op) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+#if defined(_LIBCUDACXX_ATOMIC_HAS_CAS16)
+  if constexpr (__atomic_locked_uses_cas16<_Tp>::__value)
+  {
+    const auto __ptr       = __atomic_cas16_address(&__a->__a_value);
+    __atomic_cas16_t __old = __atomic_cas16(__ptr, 0, 0);
+    while (true)
+    {
+      _Tp __old_value;
+      _CUDA_VSTD::memcpy(static_cast<void*>(&__old_value), &__old, sizeof(_Tp));
+      const __atomic_cas16_t __seen = __atomic_cas16(__ptr, __old, __atomic_cas16_bits(_Tp(__op(__old_value))));
+      if (__seen == __old)
+      {
+        return __old_value;
+      }
+      __old = __seen;
+    }
+  }
+  else
+#endif // _LIBCUDACXX_ATOMIC_HAS_CAS16
+  {
+    _Tp __old;
+    __a->__lock(_Sco{});
+    __atomic_assign_volatile(&__old, __a->__a_value);
+    __atomic_assign_volatile(&__a->__a_value, _Tp(__op(__old)));
+    __a->__unlock(_Sco{});
+    return __old;
+  }
+}
+
 template <typename _Sto, typename _Up, __atomic_storage_is_locked<_Sto> = 0>
 _CCCL_HOST_DEVICE inline void __atomic_init_dispatch(_Sto* __a, _Up __val)
 {
@@ -81,9 +246,10 @@ _CCCL_HOST_DEVICE inline void __atomic_init_dispatch(_Sto* __a, _Up __val)
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
 _CCCL_HOST_DEVICE inline void __atomic_store_dispatch(_Sto* __a, _Up __val, memory_order, _Sco = {})
 {
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__a->__a_value, __val);
-  __a->__unlock(_Sco{});
+  using _Tp = __atomic_underlying_t<_Sto>;
+  (void) __atomic_locked_update(__a, _Sco{}, [&__val](const _Tp&) -> const _Up& {
+    return __val;
+  });
 }
 
 template <typename _Sto, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -91,11 +257,20 @@ _CCCL_HOST_DEVICE inline auto __atomic_load_dispatch(const _Sto* __a, memory_ord
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __a->__unlock(_Sco{});
-  return __old;
+#if defined(_LIBCUDACXX_ATOMIC_HAS_CAS16)
+  if constexpr (__atomic_locked_uses_cas16<_Tp>::__value)
+  {
+    return __atomic_cas16_load(&__a->__a_value);
+  }
+  else
+#endif // _LIBCUDACXX_ATOMIC_HAS_CAS16
+  {
+    _Tp __old;
+    __a->__lock(_Sco{});
+    __atomic_assign_volatile(&__old, __a->__a_value);
+    __a->__unlock(_Sco{});
+    return __old;
+  }
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -103,12 +278,9 @@ _CCCL_HOST_DEVICE inline auto __atomic_exchange_dispatch(_Sto* __a, _Up __value,
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, __value);
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(__a, _Sco{}, [&__value](const _Tp&) -> const _Up& {
+    return __value;
+  });
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -116,41 +288,55 @@ _CCCL_HOST_DEVICE inline bool __atomic_compare_exchange_strong_dispatch(
   _Sto* __a, _Up* __expected, _Up __value, memory_order, memory_order, _Sco = {})
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __temp;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__temp, __a->__a_value);
-  bool __ret = __temp == *__expected;
-  if (__ret)
+#if defined(_LIBCUDACXX_ATOMIC_HAS_CAS16)
+  if constexpr (__atomic_locked_uses_cas16<_Tp>::__value)
   {
-    __atomic_assign_volatile(&__a->__a_value, __value);
+    // Values are compared with ==, like under the lock, so the swap is retried as long as the value changes to one
+    // which still compares equal to the expected one.
+    const auto __ptr       = __atomic_cas16_address(&__a->__a_value);
+    __atomic_cas16_t __old = __atomic_cas16(__ptr, 0, 0);
+    while (true)
+    {
+      _Tp __temp;
+      _CUDA_VSTD::memcpy(static_cast<void*>(&__temp), &__old, sizeof(_Tp));
+      if (!(__temp == *__expected))
+      {
+        __atomic_assign_volatile(__expected, __temp);
+        return false;
+      }
+      const __atomic_cas16_t __seen = __atomic_cas16(__ptr, __old, __atomic_cas16_bits(_Tp(__value)));
+      if (__seen == __old)
+      {
+        return true;
+      }
+      __old = __seen;
+    }
   }
   else
+#endif // _LIBCUDACXX_ATOMIC_HAS_CAS16
   {
-    __atomic_assign_volatile(__expected, __a->__a_value);
+    _Tp __temp;
+    __a->__lock(_Sco{});
+    __atomic_assign_volatile(&__temp, __a->__a_value);
+    bool __ret = __temp == *__expected;
+    if (__ret)
+    {
+      __atomic_assign_volatile(&__a->__a_value, __value);
+    }
+    else
+    {
+      __atomic_assign_volatile(__expected, __a->__a_value);
+    }
+    __a->__unlock(_Sco{});
+    return __ret;
   }
-  __a->__unlock(_Sco{});
-  return __ret;
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
-_CCCL_HOST_DEVICE inline bool
-__atomic_compare_exchange_weak_dispatch(_Sto* __a, _Up* __expected, _Up __value, memory_order, memory_order, _Sco = {})
+_CCCL_HOST_DEVICE inline bool __atomic_compare_exchange_weak_dispatch(
+  _Sto* __a, _Up* __expected, _Up __value, memory_order __success, memory_order __failure, _Sco = {})
 {
-  using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __temp;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__temp, __a->__a_value);
-  bool __ret = __temp == *__expected;
-  if (__ret)
-  {
-    __atomic_assign_volatile(&__a->__a_value, __value);
-  }
-  else
-  {
-    __atomic_assign_volatile(__expected, __a->__a_value);
-  }
-  __a->__unlock(_Sco{});
-  return __ret;
+  return __atomic_compare_exchange_strong_dispatch(__a, __expected, __value, __success, __failure, _Sco{});
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -158,12 +344,9 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_add_dispatch(_Sto* __a, _Up __delta
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old + __delta));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(__a, _Sco{}, [&__delta](const _Tp& __old) {
+    return _Tp(__old + __delta);
+  });
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -171,12 +354,9 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_sub_dispatch(_Sto* __a, _Up __delta
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old - __delta));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(__a, _Sco{}, [&__delta](const _Tp& __old) {
+    return _Tp(__old - __delta);
+  });
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -184,12 +364,9 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_and_dispatch(_Sto* __a, _Up __patte
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old & __pattern));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(__a, _Sco{}, [&__pattern](const _Tp& __old) {
+    return _Tp(__old & __pattern);
+  });
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -197,12 +374,9 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_or_dispatch(_Sto* __a, _Up __patter
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old | __pattern));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(__a, _Sco{}, [&__pattern](const _Tp& __old) {
+    return _Tp(__old | __pattern);
+  });
 }
 
 template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_locked<_Sto> = 0>
@@ -210,12 +384,9 @@ _CCCL_HOST_DEVICE inline auto __atomic_fetch_xor_dispatch(_Sto* __a, _Up __patte
   -> __atomic_underlying_t<_Sto>
 {
   using _Tp = __atomic_underlying_t<_Sto>;
-  _Tp __old;
-  __a->__lock(_Sco{});
-  __atomic_assign_volatile(&__old, __a->__a_value);
-  __atomic_assign_volatile(&__a->__a_value, _Tp(__old ^ __pattern));
-  __a->__unlock(_Sco{});
-  return __old;
+  return __atomic_locked_update(__a, _Sco{}, [&__pattern](const _Tp& __old) {
+    return _Tp(__old ^ __pattern);
+  });
 }
 
 _LIBCUDACXX_END_NAMESPACE_STD
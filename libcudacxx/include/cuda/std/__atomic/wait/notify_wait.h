@@ -23,6 +23,7 @@
 
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/wait/platform_wait.h>
 #include <cuda/std/__atomic/wait/polling.h>
 #include <cuda/std/cstring>
 
@@ -32,35 +33,54 @@ _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
 extern "C" _CCCL_DEVICE void __atomic_try_wait_unsupported_before_SM_70__();
 
+// Host threads block in the platform's wait primitive where there is one. Otherwise they poll with backoff, like
+// device threads, and notifications have nothing to do.
+template <typename _Tp, typename _Sco>
+_CCCL_HOST void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+#if defined(_LIBCUDACXX_HAS_PLATFORM_WAIT)
+  __atomic_platform_wait(__a, __val, __order, _Sco{});
+#else // ^^^ _LIBCUDACXX_HAS_PLATFORM_WAIT ^^^ / vvv !_LIBCUDACXX_HAS_PLATFORM_WAIT vvv
+  __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+#endif // !_LIBCUDACXX_HAS_PLATFORM_WAIT
+}
+
+template <typename _Tp>
+_CCCL_HOST void __atomic_notify_host([[maybe_unused]] _Tp const volatile* __a, [[maybe_unused]] bool __all)
+{
+#if defined(_LIBCUDACXX_HAS_PLATFORM_WAIT)
+  __atomic_platform_notify(__a, __all);
+#endif // _LIBCUDACXX_HAS_PLATFORM_WAIT
+}
+
 template <typename _Tp, typename _Sco>
 _LIBCUDACXX_HIDE_FROM_ABI void
 __atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
-                     , NV_IS_HOST, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+                     , NV_IS_HOST, __atomic_try_wait_slow_host(__a, __val, __order, _Sco{});
                      , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_LIBCUDACXX_HIDE_FROM_ABI void __atomic_notify_one(_Tp const volatile*, _Sco)
+_LIBCUDACXX_HIDE_FROM_ABI void __atomic_notify_one([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70,
+                     ,
+                     NV_IS_HOST,
+                     __atomic_notify_host(__a, false);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_LIBCUDACXX_HIDE_FROM_ABI void __atomic_notify_all(_Tp const volatile*, _Sco)
+_LIBCUDACXX_HIDE_FROM_ABI void __atomic_notify_all([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
-}
-
-template <typename _Tp>
-_LIBCUDACXX_HIDE_FROM_ABI bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
-{
-#if _CCCL_HAS_CUDA_COMPILER()
-  return __lhs == __rhs;
-#else
-  return _CUDA_VSTD::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
-#endif
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70,
+                     ,
+                     NV_IS_HOST,
+                     __atomic_notify_host(__a, true);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
@@ -0,0 +1,189 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ATOMIC_WAIT_PLATFORM_WAIT_H
+#define _LIBCUDACXX___ATOMIC_WAIT_PLATFORM_WAIT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__atomic/functions/host.h>
+#include <cuda/std/__atomic/order.h>
+#include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types.h>
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+template <typename _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+{
+#if _CCCL_HAS_CUDA_COMPILER()
+  return __lhs == __rhs;
+#else
+  return _CUDA_VSTD::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+#endif
+}
+
+#if defined(_LIBCUDACXX_HAS_PLATFORM_WAIT)
+
+// Host threads which wait on an atomic block in the kernel, and are woken up by notify_one and notify_all. Atomics
+// whose value is a single platform wait word are waited on directly; all others are waited on through a version
+// counter, which is bumped by every notification. Both are tracked in a table of contention states, indexed by a hash
+// of the address of the atomic's value, and shared by all the atomics whose addresses collide.
+struct alignas(64) __atomic_contention_state
+{
+  // The number of threads blocked, or about to block, on any of the atomics hashing to this state.
+  __cccl_platform_wait_t __waiters;
+  // The word on which the threads waiting on atomics which can't be waited on directly block.
+  __cccl_platform_wait_t __version;
+};
+
+_CCCL_GLOBAL_CONSTANT size_t __atomic_contention_table_size = 256;
+
+// The table must be unique in the program, so that a notification always finds the state of its waiters; it's
+// therefore a function-local static of an inline function. Shared libraries built with hidden visibility each get their
+// own table, though: a notification from one of them misses the waiters of another, which then only resume at the
+// timeout of their wait.
+_CCCL_HOST inline __atomic_contention_state* __atomic_contention_table()
+{
+  static __atomic_contention_state __table[__atomic_contention_table_size];
+  return __table;
+}
+
+_CCCL_HOST inline __atomic_contention_state* __atomic_contention_state_of(void const volatile* __addr)
+{
+  // Fibonacci hashing: spreads the addresses of neighboring atomics over the whole table.
+  const uint64_t __hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(__addr)) * 0x9E3779B97F4A7C15ull;
+  return __atomic_contention_table() + (__hash >> 56) % __atomic_contention_table_size;
+}
+
+// The address of the value of an atomic, which identifies it for the purpose of waiting, whether it's accessed through
+// an atomic or an atomic_ref.
+template <typename _Sto, __atomic_storage_is_base<_Sto> = 0>
+_CCCL_HOST void const volatile* __atomic_wait_address(_Sto const volatile* __a)
+{
+  return __a->get();
+}
+
+template <typename _Sto, __atomic_storage_is_small<_Sto> = 0>
+_CCCL_HOST void const volatile* __atomic_wait_address(_Sto const volatile* __a)
+{
+  return &__a->__a_value;
+}
+
+template <typename _Sto, __atomic_storage_is_locked<_Sto> = 0>
+_CCCL_HOST void const volatile* __atomic_wait_address(_Sto const volatile* __a)
+{
+  return &__a->__a_value;
+}
+
+template <typename _Sto>
+struct __atomic_waits_directly
+{
+  static constexpr bool __value = _Sto::__tag == __atomic_tag::__atomic_base_tag
+                               && sizeof(__atomic_underlying_t<_Sto>) == sizeof(__cccl_platform_wait_t);
+};
+
+// Device threads can store to system scope atomics, but can't wake up host threads, so waits on those are bounded by
+// the longest sleep of the polling fallback. The others are bounded as well, as a safety net.
+template <typename _Sco>
+_CCCL_HOST constexpr _CUDA_VSTD::chrono::nanoseconds __atomic_platform_wait_timeout(_Sco)
+{
+  return _CUDA_VSTD::chrono::seconds(2);
+}
+
+_CCCL_HOST constexpr _CUDA_VSTD::chrono::nanoseconds __atomic_platform_wait_timeout(__thread_scope_system_tag)
+{
+  return _CUDA_VSTD::chrono::milliseconds(1);
+}
+
+// Blocks until the atomic is notified, unless it no longer holds __val. May return spuriously.
+template <typename _Sto, typename _Sco>
+_CCCL_HOST void __atomic_platform_wait(
+  _Sto const volatile* __a, __atomic_underlying_remove_cv_t<_Sto> const& __val, memory_order __order, _Sco)
+{
+  void const volatile* __addr              = __atomic_wait_address(__a);
+  __atomic_contention_state* const __state = __atomic_contention_state_of(__addr);
+
+  __atomic_fetch_add_host(&__state->__waiters, __cccl_platform_wait_t(1), memory_order_seq_cst);
+
+  if constexpr (__atomic_waits_directly<_Sto>::__value)
+  {
+    auto __word = static_cast<__cccl_platform_wait_t const volatile*>(__addr);
+    const __cccl_platform_wait_t __current = __atomic_load_host(__word, memory_order_seq_cst);
+
+    __atomic_underlying_remove_cv_t<_Sto> __value;
+    _CUDA_VSTD::memcpy(&__value, &__current, sizeof(__value));
+    if (_CUDA_VSTD::__nonatomic_compare_equal(__value, __val))
+    {
+      __cccl_platform_wait(__word, __current, __atomic_platform_wait_timeout(_Sco{}));
+    }
+  }
+  else
+  {
+    // The version must be read before the value is checked: a notification between the two bumps it, and the wait
+    // below then returns immediately.
+    const __cccl_platform_wait_t __version = __atomic_load_host(&__state->__version, memory_order_seq_cst);
+
+    if (_CUDA_VSTD::__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
+    {
+      __cccl_platform_wait(&__state->__version, __version, __atomic_platform_wait_timeout(_Sco{}));
+    }
+  }
+
+  __atomic_fetch_sub_host(&__state->__waiters, __cccl_platform_wait_t(1), memory_order_release);
+}
+
+template <typename _Sto>
+_CCCL_HOST void __atomic_platform_notify(_Sto const volatile* __a, bool __all)
+{
+  void const volatile* __addr              = __atomic_wait_address(__a);
+  __atomic_contention_state* const __state = __atomic_contention_state_of(__addr);
+
+  if constexpr (__atomic_waits_directly<_Sto>::__value)
+  {
+    // Orders the store which is being notified before the check for waiters, which may not have seen it.
+    __atomic_thread_fence_host(memory_order_seq_cst);
+    if (__atomic_load_host(&__state->__waiters, memory_order_relaxed) != 0)
+    {
+      __cccl_platform_wake(static_cast<__cccl_platform_wait_t const volatile*>(__addr), __all);
+    }
+  }
+  else
+  {
+    __atomic_fetch_add_host(&__state->__version, __cccl_platform_wait_t(1), memory_order_seq_cst);
+    if (__atomic_load_host(&__state->__waiters, memory_order_seq_cst) != 0)
+    {
+      // The version is shared by all the atomics hashing to this state, so waking up a single thread could wake up
+      // one which waits on another atomic.
+      __cccl_platform_wake(&__state->__version, true);
+    }
+  }
+}
+
+#endif // _LIBCUDACXX_HAS_PLATFORM_WAIT
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___ATOMIC_WAIT_PLATFORM_WAIT_H
@@ -131,6 +131,14 @@
 #  define _CCCL_NO_CFI
 #endif
 
+// _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW
+
+#if _CCCL_COMPILER(CLANG)
+#  define _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW _CCCL_NO_SANITIZE("unsigned-integer-overflow")
+#else // ^^^ _CCCL_COMPILER(CLANG) ^^^ / vvv !_CCCL_COMPILER(CLANG) vvv
+#  define _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW
+#endif // !_CCCL_COMPILER(CLANG)
+
 // _CCCL_NO_SANITIZE
 
 #if _CCCL_HAS_ATTRIBUTE(__no_sanitize__)
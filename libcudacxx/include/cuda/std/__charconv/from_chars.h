@@ -0,0 +1,275 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CHARCONV_FROM_CHARS_H
+#define _LIBCUDACXX___CHARCONV_FROM_CHARS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_integer.h>
+#include <cuda/std/__type_traits/is_signed.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Returns the value of the digit __c in any base up to 36, or 36 when __c is not a digit.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr int __from_chars_digit_value(char __c) noexcept
+{
+  if (__c >= '0' && __c <= '9')
+  {
+    return __c - '0';
+  }
+  if (__c >= 'a' && __c <= 'z')
+  {
+    return __c - 'a' + 10;
+  }
+  if (__c >= 'A' && __c <= 'Z')
+  {
+    return __c - 'A' + 10;
+  }
+  return 36;
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr bool __from_chars_is_digit(char __c) noexcept
+{
+  return static_cast<unsigned char>(__c - '0') < 10;
+}
+
+// Reads 8 characters as the bytes of an integer, the first one in the lowest byte. Compilers turn this into a single
+// unaligned load on little endian targets.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr uint64_t __from_chars_read8(const char* __p) noexcept
+{
+  uint64_t __v = 0;
+  _CCCL_PRAGMA_UNROLL_FULL()
+  for (int __i = 0; __i < 8; ++__i)
+  {
+    __v |= static_cast<uint64_t>(static_cast<unsigned char>(__p[__i])) << (8 * __i);
+  }
+  return __v;
+}
+
+// Whether all the bytes of __v are in ['0', '9']: adding 6 carries a digit's low nibble into the high one exactly when
+// it is above 9.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr bool __from_chars_is_eight_digits(uint64_t __v) noexcept
+{
+  return (((__v & 0xF0F0F0F0F0F0F0F0) | (((__v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+          == 0x3333333333333333);
+}
+
+// Converts 8 decimal digits read by __from_chars_read8 with three multiplications, combining pairs of digits, then
+// pairs of pairs, then the two halves.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr uint32_t __from_chars_parse_eight_digits(uint64_t __v) noexcept
+{
+  constexpr uint64_t __mask = 0x000000FF000000FF;
+  constexpr uint64_t __mul1 = 100 + (1000000ull << 32);
+  constexpr uint64_t __mul2 = 1 + (10000ull << 32);
+  __v -= 0x3030303030303030;
+  __v = (__v * 10) + (__v >> 8);
+  __v = (((__v & __mask) * __mul1) + (((__v >> 16) & __mask) * __mul2)) >> 32;
+  return static_cast<uint32_t>(__v);
+}
+
+// Parses a decimal number of at most 64 bits, 8 digits at a time while they don't overflow.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr from_chars_result
+__from_chars_uint64_decimal(const char* __first, const char* __last, uint64_t& __value, uint64_t __max) noexcept
+{
+  constexpr ptrdiff_t __max_safe_digits = 19;
+
+  const char* __p = __first;
+  while (__p != __last && *__p == '0')
+  {
+    ++__p;
+  }
+  const char* const __safe_last = (__last - __p > __max_safe_digits) ? __p + __max_safe_digits : __last;
+  uint64_t __acc                = 0;
+  while (__safe_last - __p >= 8)
+  {
+    const uint64_t __chunk = _CUDA_VSTD::__from_chars_read8(__p);
+    if (!_CUDA_VSTD::__from_chars_is_eight_digits(__chunk))
+    {
+      break;
+    }
+    __acc = __acc * 100000000 + _CUDA_VSTD::__from_chars_parse_eight_digits(__chunk);
+    __p += 8;
+  }
+  if (__p != __safe_last && __safe_last - __p < 8 && __safe_last - __first >= 8)
+  {
+    // Read the 8 characters which end with the remaining ones, and replace those already parsed with zeros.
+    constexpr uint32_t __pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000};
+    const auto __remaining       = static_cast<int>(__safe_last - __p);
+    const int __shift            = 8 * (8 - __remaining);
+    uint64_t __chunk             = _CUDA_VSTD::__from_chars_read8(__safe_last - 8);
+    __chunk = ((__chunk >> __shift) << __shift) | (0x3030303030303030 >> (64 - __shift));
+    if (_CUDA_VSTD::__from_chars_is_eight_digits(__chunk))
+    {
+      __acc = __acc * __pow10[__remaining] + _CUDA_VSTD::__from_chars_parse_eight_digits(__chunk);
+      __p   = __safe_last;
+    }
+  }
+  for (; __p != __safe_last && _CUDA_VSTD::__from_chars_is_digit(*__p); ++__p)
+  {
+    __acc = __acc * 10 + static_cast<uint64_t>(*__p - '0');
+  }
+  if (__p == __first)
+  {
+    return {__first, errc::invalid_argument};
+  }
+
+  bool __overflow = false;
+  if (__p != __last && _CUDA_VSTD::__from_chars_is_digit(*__p))
+  {
+    const auto __digit = static_cast<uint64_t>(*__p - '0');
+    __overflow         = __acc > (numeric_limits<uint64_t>::max() - __digit) / 10;
+    __acc              = __acc * 10 + __digit;
+    for (++__p; __p != __last && _CUDA_VSTD::__from_chars_is_digit(*__p); ++__p)
+    {
+      __overflow = true;
+    }
+  }
+  if (__overflow || __acc > __max)
+  {
+    return {__p, errc::result_out_of_range};
+  }
+  __value = __acc;
+  return {__p, errc{}};
+}
+
+template <class _Up>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr from_chars_result
+__from_chars_uint_generic(const char* __first, const char* __last, _Up& __value, _Up __max, int __base) noexcept
+{
+  const auto __ubase = static_cast<_Up>(__base);
+  const _Up __cutoff = static_cast<_Up>(__max / __ubase);
+  const int __cutlim = static_cast<int>(__max % __ubase);
+  const char* __p    = __first;
+  _Up __acc          = 0;
+  bool __overflow    = false;
+  for (; __p != __last; ++__p)
+  {
+    const int __digit = _CUDA_VSTD::__from_chars_digit_value(*__p);
+    if (__digit >= __base)
+    {
+      break;
+    }
+    if (__acc > __cutoff || (__acc == __cutoff && __digit > __cutlim))
+    {
+      __overflow = true;
+    }
+    else
+    {
+      __acc = static_cast<_Up>(__acc * __ubase + static_cast<_Up>(__digit));
+    }
+  }
+  if (__p == __first)
+  {
+    return {__first, errc::invalid_argument};
+  }
+  if (__overflow)
+  {
+    return {__p, errc::result_out_of_range};
+  }
+  __value = __acc;
+  return {__p, errc{}};
+}
+
+template <class _Up>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr from_chars_result
+__from_chars_uint(const char* __first, const char* __last, _Up& __value, _Up __max, int __base) noexcept
+{
+  if constexpr (sizeof(_Up) <= sizeof(uint64_t))
+  {
+    if (__base == 10)
+    {
+      uint64_t __acc                = 0;
+      const from_chars_result __ret = _CUDA_VSTD::__from_chars_uint64_decimal(__first, __last, __acc, __max);
+      if (__ret.ec == errc{})
+      {
+        __value = static_cast<_Up>(__acc);
+      }
+      return __ret;
+    }
+  }
+  return _CUDA_VSTD::__from_chars_uint_generic(__first, __last, __value, __max, __base);
+}
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(_CCCL_TRAIT(__cccl_is_integer, _Tp))
+_LIBCUDACXX_HIDE_FROM_ABI constexpr from_chars_result
+from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 10) noexcept
+{
+  _CCCL_ASSERT(__base >= 2 && __base <= 36, "base must be in the range [2, 36]");
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+
+  using _Up = make_unsigned_t<_Tp>;
+
+  if constexpr (_CCCL_TRAIT(is_signed, _Tp))
+  {
+    if (__first != __last && *__first == '-')
+    {
+      // The magnitude of the minimum is one more than the maximum.
+      _Up __uvalue                  = 0;
+      const from_chars_result __ret = _CUDA_VSTD::__from_chars_uint(
+        __first + 1, __last, __uvalue, static_cast<_Up>(static_cast<_Up>(numeric_limits<_Tp>::max()) + 1u), __base);
+      if (__ret.ec == errc::invalid_argument)
+      {
+        return {__first, errc::invalid_argument};
+      }
+      if (__ret.ec == errc{})
+      {
+        __value = static_cast<_Tp>(_Up{0} - __uvalue);
+      }
+      return __ret;
+    }
+  }
+
+  _Up __uvalue = 0;
+  const from_chars_result __ret =
+    _CUDA_VSTD::__from_chars_uint(__first, __last, __uvalue, static_cast<_Up>(numeric_limits<_Tp>::max()), __base);
+  if (__ret.ec == errc{})
+  {
+    __value = static_cast<_Tp>(__uvalue);
+  }
+  return __ret;
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI constexpr from_chars_result
+from_chars(const char* __first, const char* __last, char& __value, int __base = 10) noexcept
+{
+  using _Cp = conditional_t<_CCCL_TRAIT(is_signed, char), signed char, unsigned char>;
+
+  _Cp __cvalue                  = 0;
+  const from_chars_result __ret = _CUDA_VSTD::from_chars(__first, __last, __cvalue, __base);
+  if (__ret.ec == errc{})
+  {
+    __value = static_cast<char>(__cvalue);
+  }
+  return __ret;
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___CHARCONV_FROM_CHARS_H
@@ -0,0 +1,794 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+#define _LIBCUDACXX___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/from_chars.h>
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__charconv/powers_of_five.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// The parsing follows the approach of the fast_float library: up to 19 significant digits are read into an integer w,
+// so that the value is w * 10^q. When both w and 10^q are exactly representable, one floating point multiplication or
+// division rounds correctly (Clinger's fast path). Otherwise, the value is computed from the 128 most significant bits
+// of w * 5^q (Eisel-Lemire), which is always correctly rounded when w holds all the digits. When there are more digits,
+// the value is rounded from w and w + 1, and only when those differ the input is compared exactly against the halfway
+// point between the two candidates, using big integers.
+
+template <class _Tp>
+struct __from_chars_fp_traits;
+
+template <>
+struct __from_chars_fp_traits<float>
+{
+  using __storage_type = uint32_t;
+
+  static constexpr int __mantissa_bits                  = 23;
+  static constexpr int __minimum_exponent               = -127;
+  static constexpr int __infinite_power                 = 0xFF;
+  static constexpr uint32_t __infinity_bits             = 0x7F800000;
+  static constexpr int64_t __min_exponent_fast_path     = -10;
+  static constexpr int64_t __max_exponent_fast_path     = 10;
+  static constexpr uint64_t __max_mantissa_fast_path    = uint64_t{2} << 23;
+  static constexpr int64_t __min_exponent_round_to_even = -17;
+  static constexpr int64_t __max_exponent_round_to_even = 10;
+  static constexpr int64_t __smallest_power_of_ten      = -64;
+  static constexpr int64_t __largest_power_of_ten       = 38;
+  // More digits than this can't change the rounding, except by being non-zero.
+  static constexpr int __max_digits   = 114;
+  static constexpr int __bigint_limbs = 16;
+};
+
+template <>
+struct __from_chars_fp_traits<double>
+{
+  using __storage_type = uint64_t;
+
+  static constexpr int __mantissa_bits                  = 52;
+  static constexpr int __minimum_exponent               = -1023;
+  static constexpr int __infinite_power                 = 0x7FF;
+  static constexpr uint64_t __infinity_bits             = 0x7FF0000000000000;
+  static constexpr int64_t __min_exponent_fast_path     = -22;
+  static constexpr int64_t __max_exponent_fast_path     = 22;
+  static constexpr uint64_t __max_mantissa_fast_path    = uint64_t{2} << 52;
+  static constexpr int64_t __min_exponent_round_to_even = -4;
+  static constexpr int64_t __max_exponent_round_to_even = 23;
+  static constexpr int64_t __smallest_power_of_ten      = -342;
+  static constexpr int64_t __largest_power_of_ten       = 308;
+  static constexpr int __max_digits                     = 769;
+  static constexpr int __bigint_limbs                   = 90;
+};
+
+_CCCL_GLOBAL_CONSTANT double __from_chars_exact_pow10[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// The biased exponent and the mantissa without the implicit bit of a floating point value.
+struct __from_chars_adjusted_mantissa
+{
+  uint64_t __mantissa;
+  int32_t __power2;
+};
+
+// Multiplies w, whose leading bit is set, by the 128 bit approximation of 5^q. The low word of the table entry is only
+// needed when the bits below the precision we need are all ones, as adding to them could carry into the result.
+template <int _BitPrecision>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr __charconv_uint128
+__from_chars_product_approximation(int64_t __q, uint64_t __w) noexcept
+{
+  constexpr uint64_t __precision_mask = ~uint64_t{0} >> _BitPrecision;
+
+  const auto __index         = static_cast<size_t>(2 * (__q - __pow5_128_min_exponent));
+  __charconv_uint128 __first = _CUDA_VSTD::__charconv_mul_64x64(__w, __pow5_128_table[__index]);
+  if ((__first.__high & __precision_mask) == __precision_mask)
+  {
+    const __charconv_uint128 __second = _CUDA_VSTD::__charconv_mul_64x64(__w, __pow5_128_table[__index + 1]);
+    __first.__low += __second.__high;
+    if (__second.__high > __first.__low)
+    {
+      ++__first.__high;
+    }
+  }
+  return __first;
+}
+
+// Rounds w * 10^q to the nearest floating point value, with ties to even (Eisel-Lemire). The result is exact for any
+// w, see Mushtak and Lemire, "Fast number parsing without fallback".
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr __from_chars_adjusted_mantissa
+__from_chars_compute_float(int64_t __q, uint64_t __w) noexcept
+{
+  using _Traits = __from_chars_fp_traits<_Tp>;
+
+  if (__w == 0 || __q < _Traits::__smallest_power_of_ten)
+  {
+    return {0, 0};
+  }
+  if (__q > _Traits::__largest_power_of_ten)
+  {
+    return {0, _Traits::__infinite_power};
+  }
+
+  const int __lz = _CUDA_VSTD::countl_zero(__w);
+  __w <<= __lz;
+
+  // One more bit than the mantissa for the implicit bit, one for rounding and one which is lost when the product is
+  // below 2^127.
+  const __charconv_uint128 __product =
+    _CUDA_VSTD::__from_chars_product_approximation<_Traits::__mantissa_bits + 3>(__q, __w);
+  const int __upperbit = static_cast<int>(__product.__high >> 63);
+  const int __shift    = __upperbit + 64 - _Traits::__mantissa_bits - 3;
+
+  __from_chars_adjusted_mantissa __answer{};
+  __answer.__mantissa = __product.__high >> __shift;
+  // floor(log2(10^q)) + 63 is ((152170 + 65536) * q) >> 16) + 63 over the range of the table.
+  const int32_t __power = ((152170 + 65536) * static_cast<int32_t>(__q) >> 16) + 63;
+  __answer.__power2     = __power + __upperbit - __lz - _Traits::__minimum_exponent;
+
+  if (__answer.__power2 <= 0)
+  {
+    // The result is subnormal, or rounds up to the smallest normal value.
+    if (-__answer.__power2 + 1 >= 64)
+    {
+      return {0, 0};
+    }
+    __answer.__mantissa >>= -__answer.__power2 + 1;
+    __answer.__mantissa += (__answer.__mantissa & 1);
+    __answer.__mantissa >>= 1;
+    __answer.__power2 = (__answer.__mantissa < (uint64_t{1} << _Traits::__mantissa_bits)) ? 0 : 1;
+    return __answer;
+  }
+
+  // Exact halfway cases only happen when 5^q fits in 64 bits, in which case the truncated bits of the product are zero
+  // and we must round down to even rather than up.
+  if (__product.__low <= 1 && __q >= _Traits::__min_exponent_round_to_even
+      && __q <= _Traits::__max_exponent_round_to_even && (__answer.__mantissa & 3) == 1)
+  {
+    if ((__answer.__mantissa << __shift) == __product.__high)
+    {
+      __answer.__mantissa &= ~uint64_t{1};
+    }
+  }
+
+  __answer.__mantissa += (__answer.__mantissa & 1);
+  __answer.__mantissa >>= 1;
+  if (__answer.__mantissa >= (uint64_t{2} << _Traits::__mantissa_bits))
+  {
+    __answer.__mantissa = uint64_t{1} << _Traits::__mantissa_bits;
+    ++__answer.__power2;
+  }
+  __answer.__mantissa &= ~(uint64_t{1} << _Traits::__mantissa_bits);
+  if (__answer.__power2 >= _Traits::__infinite_power)
+  {
+    return {0, _Traits::__infinite_power};
+  }
+  return __answer;
+}
+
+// A fixed capacity unsigned integer, in 32 bit limbs with the least significant first.
+template <int _Limbs>
+struct __from_chars_bigint
+{
+  uint32_t __limbs[_Limbs]{};
+  int __size = 0;
+
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr void __push(uint32_t __limb) noexcept
+  {
+    _CCCL_ASSERT(__size < _Limbs, "big integer capacity exceeded");
+    __limbs[__size++] = __limb;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr void __mul_add(uint32_t __mul, uint32_t __add) noexcept
+  {
+    uint64_t __carry = __add;
+    for (int __i = 0; __i < __size; ++__i)
+    {
+      const uint64_t __v = static_cast<uint64_t>(__limbs[__i]) * __mul + __carry;
+      __limbs[__i]       = static_cast<uint32_t>(__v);
+      __carry            = __v >> 32;
+    }
+    if (__carry != 0)
+    {
+      __push(static_cast<uint32_t>(__carry));
+    }
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr void __mul_pow5(int64_t __n) noexcept
+  {
+    constexpr uint32_t __pow5[] = {
+      1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625, 1220703125};
+    for (; __n >= 13; __n -= 13)
+    {
+      __mul_add(__pow5[13], 0);
+    }
+    if (__n > 0)
+    {
+      __mul_add(__pow5[__n], 0);
+    }
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr void __shift_left(int64_t __n) noexcept
+  {
+    if (__size == 0)
+    {
+      return;
+    }
+    const int __words = static_cast<int>(__n / 32);
+    const int __bits  = static_cast<int>(__n % 32);
+    if (__bits != 0)
+    {
+      uint32_t __carry = 0;
+      for (int __i = 0; __i < __size; ++__i)
+      {
+        const uint32_t __v = __limbs[__i];
+        __limbs[__i]       = (__v << __bits) | __carry;
+        __carry            = __v >> (32 - __bits);
+      }
+      if (__carry != 0)
+      {
+        __push(__carry);
+      }
+    }
+    if (__words != 0)
+    {
+      _CCCL_ASSERT(__size + __words <= _Limbs, "big integer capacity exceeded");
+      for (int __i = __size - 1; __i >= 0; --__i)
+      {
+        __limbs[__i + __words] = __limbs[__i];
+      }
+      for (int __i = 0; __i < __words; ++__i)
+      {
+        __limbs[__i] = 0;
+      }
+      __size += __words;
+    }
+  }
+
+  [[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI friend constexpr int
+  __compare(const __from_chars_bigint& __lhs, const __from_chars_bigint& __rhs) noexcept
+  {
+    if (__lhs.__size != __rhs.__size)
+    {
+      return __lhs.__size < __rhs.__size ? -1 : 1;
+    }
+    for (int __i = __lhs.__size - 1; __i >= 0; --__i)
+    {
+      if (__lhs.__limbs[__i] != __rhs.__limbs[__i])
+      {
+        return __lhs.__limbs[__i] < __rhs.__limbs[__i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+};
+
+// The decimal significand and exponent of a number, and where its digits are for when they need to be read again.
+struct __from_chars_decimal
+{
+  uint64_t __mantissa;
+  int64_t __exponent;
+  int64_t __exp_number;
+  const char* __int_first;
+  const char* __int_last;
+  const char* __frac_first;
+  const char* __frac_last;
+  bool __too_many_digits;
+};
+
+// Accumulates decimal digits into __acc, 8 at a time while possible. __acc wraps around when there are too many.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr const char*
+__from_chars_accumulate_digits(const char* __p, const char* __last, uint64_t& __acc) noexcept
+{
+  while (__last - __p >= 8)
+  {
+    const uint64_t __chunk = _CUDA_VSTD::__from_chars_read8(__p);
+    if (!_CUDA_VSTD::__from_chars_is_eight_digits(__chunk))
+    {
+      break;
+    }
+    __acc = __acc * 100000000 + _CUDA_VSTD::__from_chars_parse_eight_digits(__chunk);
+    __p += 8;
+  }
+  for (; __p != __last && _CUDA_VSTD::__from_chars_is_digit(*__p); ++__p)
+  {
+    __acc = __acc * 10 + static_cast<uint64_t>(*__p - '0');
+  }
+  return __p;
+}
+
+// Parses the decimal pattern of strtod, without the sign, infinity and NaN, where the exponent is required for
+// chars_format::scientific and not allowed for chars_format::fixed. Returns nullptr when the pattern doesn't match.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr const char* __from_chars_parse_decimal(
+  const char* __p, const char* __last, chars_format __fmt, __from_chars_decimal& __d) noexcept
+{
+  constexpr uint64_t __min_19_digit_integer = 1000000000000000000;
+
+  uint64_t __mantissa = 0;
+  __d.__int_first     = __p;
+  __p                 = _CUDA_VSTD::__from_chars_accumulate_digits(__p, __last, __mantissa);
+  __d.__int_last      = __p;
+  __d.__frac_first    = __p;
+  __d.__frac_last     = __p;
+  int64_t __exponent  = 0;
+  if (__p != __last && *__p == '.')
+  {
+    __d.__frac_first = ++__p;
+    __p              = _CUDA_VSTD::__from_chars_accumulate_digits(__p, __last, __mantissa);
+    __d.__frac_last  = __p;
+    __exponent       = __d.__frac_first - __d.__frac_last;
+  }
+  int64_t __digit_count = (__d.__int_last - __d.__int_first) + (__d.__frac_last - __d.__frac_first);
+  if (__digit_count == 0)
+  {
+    return nullptr;
+  }
+
+  const bool __scientific = (__fmt & chars_format::scientific) == chars_format::scientific;
+  const bool __fixed      = (__fmt & chars_format::fixed) == chars_format::fixed;
+  int64_t __exp_number    = 0;
+  if (__scientific && __p != __last && (*__p == 'e' || *__p == 'E'))
+  {
+    const char* __q      = __p + 1;
+    const bool __neg_exp = __q != __last && *__q == '-';
+    if (__q != __last && (*__q == '-' || *__q == '+'))
+    {
+      ++__q;
+    }
+    if (__q != __last && _CUDA_VSTD::__from_chars_is_digit(*__q))
+    {
+      for (; __q != __last && _CUDA_VSTD::__from_chars_is_digit(*__q); ++__q)
+      {
+        // Any exponent this large overflows or underflows, whatever the digits.
+        if (__exp_number < 0x10000)
+        {
+          __exp_number = 10 * __exp_number + (*__q - '0');
+        }
+      }
+      __exp_number = __neg_exp ? -__exp_number : __exp_number;
+      __exponent += __exp_number;
+      __p = __q;
+    }
+    else if (!__fixed)
+    {
+      return nullptr;
+    }
+  }
+  else if (__scientific && !__fixed)
+  {
+    return nullptr;
+  }
+  __d.__exp_number = __exp_number;
+
+  // With more than 19 digits, only the first 19 significant ones are kept.
+  __d.__too_many_digits = false;
+  if (__digit_count > 19)
+  {
+    for (const char* __s = __d.__int_first; __s != __d.__frac_last && (*__s == '0' || *__s == '.'); ++__s)
+    {
+      __digit_count -= (*__s == '0');
+    }
+    if (__digit_count > 19)
+    {
+      __d.__too_many_digits = true;
+      __mantissa            = 0;
+      const char* __q       = __d.__int_first;
+      for (; __mantissa < __min_19_digit_integer && __q != __d.__int_last; ++__q)
+      {
+        __mantissa = __mantissa * 10 + static_cast<uint64_t>(*__q - '0');
+      }
+      if (__mantissa >= __min_19_digit_integer)
+      {
+        __exponent = (__d.__int_last - __q) + __exp_number;
+      }
+      else
+      {
+        for (__q = __d.__frac_first; __mantissa < __min_19_digit_integer && __q != __d.__frac_last; ++__q)
+        {
+          __mantissa = __mantissa * 10 + static_cast<uint64_t>(*__q - '0');
+        }
+        __exponent = (__d.__frac_first - __q) + __exp_number;
+      }
+    }
+  }
+  __d.__mantissa = __mantissa;
+  __d.__exponent = __exponent;
+  return __p;
+}
+
+// Chooses between the floating point value __bits and the next one up, by comparing the digits exactly against the
+// halfway point between them.
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr typename __from_chars_fp_traits<_Tp>::__storage_type
+__from_chars_round_exact(const __from_chars_decimal& __d,
+                         typename __from_chars_fp_traits<_Tp>::__storage_type __bits) noexcept
+{
+  using _Traits  = __from_chars_fp_traits<_Tp>;
+  using _Storage = typename _Traits::__storage_type;
+  using _Bigint  = __from_chars_bigint<_Traits::__bigint_limbs>;
+
+  constexpr uint32_t __pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+  // The digits as an integer, the first __max_digits significant ones, and whether any of the others is non-zero.
+  _Bigint __lhs{};
+  int __count      = 0;
+  int64_t __rest   = 0;
+  bool __sticky    = false;
+  uint32_t __chunk = 0;
+  int __chunk_size = 0;
+  for (const char* __p = __d.__int_first; __p != __d.__frac_last; ++__p)
+  {
+    if (__p == __d.__int_last)
+    {
+      __p = __d.__frac_first;
+      if (__p == __d.__frac_last)
+      {
+        break;
+      }
+    }
+    const auto __digit = static_cast<uint32_t>(*__p - '0');
+    if (__count == 0 && __digit == 0)
+    {
+      continue;
+    }
+    if (__count == _Traits::__max_digits)
+    {
+      ++__rest;
+      __sticky |= __digit != 0;
+      continue;
+    }
+    ++__count;
+    __chunk = __chunk * 10 + __digit;
+    if (++__chunk_size == 9)
+    {
+      __lhs.__mul_add(__pow10[9], __chunk);
+      __chunk      = 0;
+      __chunk_size = 0;
+    }
+  }
+  if (__chunk_size != 0)
+  {
+    __lhs.__mul_add(__pow10[__chunk_size], __chunk);
+  }
+  const int64_t __exp10 = __d.__exp_number - (__d.__frac_last - __d.__frac_first) + __rest;
+
+  // The halfway point is (2 * m + 1) * 2^(e - 1) when __bits is m * 2^e.
+  constexpr int __bias      = -_Traits::__minimum_exponent;
+  const int __biased_exp    = static_cast<int>(__bits >> _Traits::__mantissa_bits);
+  uint64_t __m              = __bits & ((_Storage{1} << _Traits::__mantissa_bits) - 1);
+  int64_t __exp2            = 1 - __bias - _Traits::__mantissa_bits;
+  if (__biased_exp != 0)
+  {
+    __m |= uint64_t{1} << _Traits::__mantissa_bits;
+    __exp2 = __biased_exp - __bias - _Traits::__mantissa_bits;
+  }
+  const uint64_t __halfway = 2 * __m + 1;
+  _Bigint __rhs{};
+  __rhs.__push(static_cast<uint32_t>(__halfway));
+  if ((__halfway >> 32) != 0)
+  {
+    __rhs.__push(static_cast<uint32_t>(__halfway >> 32));
+  }
+  __exp2 -= 1;
+
+  // Compare digits * 5^exp10 * 2^exp10 with halfway * 2^exp2.
+  if (__exp10 >= 0)
+  {
+    __lhs.__mul_pow5(__exp10);
+  }
+  else
+  {
+    __rhs.__mul_pow5(-__exp10);
+  }
+  if (__exp10 >= __exp2)
+  {
+    __lhs.__shift_left(__exp10 - __exp2);
+  }
+  else
+  {
+    __rhs.__shift_left(__exp2 - __exp10);
+  }
+
+  const int __cmp = __compare(__lhs, __rhs);
+  if (__cmp > 0 || (__cmp == 0 && (__sticky || (__bits & 1) != 0)))
+  {
+    return __bits + 1;
+  }
+  return __bits;
+}
+
+// Rounds __m * 2^__exp2, plus something smaller than one unit of __m when __sticky is set, to the nearest floating
+// point value with ties to even. Returns the bits of the magnitude, which are those of infinity on overflow.
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr typename __from_chars_fp_traits<_Tp>::__storage_type
+__from_chars_round_binary(uint64_t __m, int64_t __exp2, bool __sticky) noexcept
+{
+  using _Traits  = __from_chars_fp_traits<_Tp>;
+  using _Storage = typename _Traits::__storage_type;
+
+  constexpr _Storage __infinity_bits = _Traits::__infinity_bits;
+
+  const int __lz = _CUDA_VSTD::countl_zero(__m);
+  __m <<= __lz;
+  // The exponent of the leading bit, biased.
+  const int64_t __biased_exp = __exp2 + 63 - __lz - _Traits::__minimum_exponent;
+  if (__biased_exp >= _Traits::__infinite_power)
+  {
+    return __infinity_bits;
+  }
+  if (__biased_exp < -_Traits::__mantissa_bits)
+  {
+    return 0;
+  }
+
+  int __shift     = 63 - _Traits::__mantissa_bits;
+  uint64_t __base = 0;
+  if (__biased_exp >= 1)
+  {
+    // The implicit bit of the mantissa increments the exponent by one.
+    __base = static_cast<uint64_t>(__biased_exp - 1) << _Traits::__mantissa_bits;
+  }
+  else
+  {
+    __shift += static_cast<int>(1 - __biased_exp);
+  }
+  const uint64_t __kept = __shift < 64 ? __m >> __shift : 0;
+  const uint64_t __rem  = __shift < 64 ? __m & ((uint64_t{1} << __shift) - 1) : __m;
+  const uint64_t __half = uint64_t{1} << (__shift - 1);
+  const bool __round_up = __rem > __half || (__rem == __half && (__sticky || (__kept & 1) != 0));
+  const uint64_t __bits = __base + __kept + __round_up;
+  return __bits >= __infinity_bits ? __infinity_bits : static_cast<_Storage>(__bits);
+}
+
+// Parses the hexadecimal pattern of strtod without the 0x prefix, and returns nullptr when it doesn't match.
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr const char* __from_chars_parse_hex(
+  const char* __p,
+  const char* __last,
+  typename __from_chars_fp_traits<_Tp>::__storage_type& __bits,
+  bool& __nonzero) noexcept
+{
+  uint64_t __m          = 0;
+  int64_t __exp2        = 0;
+  int __significant     = 0;
+  int64_t __digit_count = 0;
+  bool __sticky         = false;
+  bool __fraction       = false;
+  for (; __p != __last; ++__p)
+  {
+    if (*__p == '.' && !__fraction)
+    {
+      __fraction = true;
+      continue;
+    }
+    const int __digit = _CUDA_VSTD::__from_chars_digit_value(*__p);
+    if (__digit >= 16)
+    {
+      break;
+    }
+    ++__digit_count;
+    if (__m == 0 && __digit == 0)
+    {
+      __exp2 -= __fraction ? 4 : 0;
+    }
+    else if (__significant < 16)
+    {
+      __m = __m * 16 + static_cast<uint64_t>(__digit);
+      ++__significant;
+      __exp2 -= __fraction ? 4 : 0;
+    }
+    else
+    {
+      __exp2 += __fraction ? 0 : 4;
+      __sticky |= __digit != 0;
+    }
+  }
+  if (__digit_count == 0)
+  {
+    return nullptr;
+  }
+
+  if (__p != __last && (*__p == 'p' || *__p == 'P'))
+  {
+    const char* __q      = __p + 1;
+    const bool __neg_exp = __q != __last && *__q == '-';
+    if (__q != __last && (*__q == '-' || *__q == '+'))
+    {
+      ++__q;
+    }
+    if (__q != __last && _CUDA_VSTD::__from_chars_is_digit(*__q))
+    {
+      int64_t __exp_number = 0;
+      for (; __q != __last && _CUDA_VSTD::__from_chars_is_digit(*__q); ++__q)
+      {
+        if (__exp_number < 0x100000)
+        {
+          __exp_number = 10 * __exp_number + (*__q - '0');
+        }
+      }
+      __exp2 += __neg_exp ? -__exp_number : __exp_number;
+      __p = __q;
+    }
+  }
+
+  __nonzero = __m != 0;
+  __bits    = __nonzero ? _CUDA_VSTD::__from_chars_round_binary<_Tp>(__m, __exp2, __sticky) : 0;
+  return __p;
+}
+
+// Compares the characters starting at __p with the lower case __word, ignoring case.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr bool
+__from_chars_starts_with(const char* __p, const char* __last, const char* __word) noexcept
+{
+  for (; *__word != '\0'; ++__p, ++__word)
+  {
+    if (__p == __last || (*__p != *__word && *__p != *__word - 'a' + 'A'))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Parses inf, infinity, nan and nan(n-char-sequence), ignoring case, and returns nullptr for anything else.
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr const char* __from_chars_parse_inf_nan(
+  const char* __p, const char* __last, typename __from_chars_fp_traits<_Tp>::__storage_type& __bits) noexcept
+{
+  using _Traits  = __from_chars_fp_traits<_Tp>;
+  using _Storage = typename _Traits::__storage_type;
+
+  constexpr _Storage __infinity_bits = _Traits::__infinity_bits;
+
+  if (_CUDA_VSTD::__from_chars_starts_with(__p, __last, "inf"))
+  {
+    __bits = __infinity_bits;
+    __p += 3;
+    return _CUDA_VSTD::__from_chars_starts_with(__p, __last, "inity") ? __p + 5 : __p;
+  }
+  if (_CUDA_VSTD::__from_chars_starts_with(__p, __last, "nan"))
+  {
+    __bits = __infinity_bits | (_Storage{1} << (_Traits::__mantissa_bits - 1));
+    __p += 3;
+    if (__p != __last && *__p == '(')
+    {
+      const char* __q = __p + 1;
+      while (__q != __last && (_CUDA_VSTD::__from_chars_digit_value(*__q) < 36 || *__q == '_'))
+      {
+        ++__q;
+      }
+      if (__q != __last && *__q == ')')
+      {
+        __p = __q + 1;
+      }
+    }
+    return __p;
+  }
+  return nullptr;
+}
+
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_CONSTEXPR_BIT_CAST from_chars_result
+__from_chars_floating_point(const char* __first, const char* __last, _Tp& __value, chars_format __fmt) noexcept
+{
+  using _Traits  = __from_chars_fp_traits<_Tp>;
+  using _Storage = typename _Traits::__storage_type;
+
+  constexpr _Storage __infinity_bits = _Traits::__infinity_bits;
+  constexpr auto __sign_bit          = static_cast<_Storage>(_Storage{1} << (sizeof(_Storage) * 8 - 1));
+
+  const char* __p  = __first;
+  const bool __neg = __p != __last && *__p == '-';
+  __p += __neg;
+
+  _Storage __bits   = 0;
+  const char* __end = _CUDA_VSTD::__from_chars_parse_inf_nan<_Tp>(__p, __last, __bits);
+  if (__end != nullptr)
+  {
+    __value = _CUDA_VSTD::bit_cast<_Tp>(static_cast<_Storage>(__bits | (__neg ? __sign_bit : 0)));
+    return {__end, errc{}};
+  }
+
+  bool __nonzero = false;
+  if (__fmt == chars_format::hex)
+  {
+    __end = _CUDA_VSTD::__from_chars_parse_hex<_Tp>(__p, __last, __bits, __nonzero);
+    if (__end == nullptr)
+    {
+      return {__first, errc::invalid_argument};
+    }
+  }
+  else
+  {
+    __from_chars_decimal __d{};
+    __end = _CUDA_VSTD::__from_chars_parse_decimal(__p, __last, __fmt, __d);
+    if (__end == nullptr)
+    {
+      return {__first, errc::invalid_argument};
+    }
+
+    if (!__d.__too_many_digits && __d.__exponent >= _Traits::__min_exponent_fast_path
+        && __d.__exponent <= _Traits::__max_exponent_fast_path && __d.__mantissa <= _Traits::__max_mantissa_fast_path)
+    {
+      // Both the mantissa and the power of ten are exact, so a single operation rounds correctly.
+      _Tp __result = static_cast<_Tp>(__d.__mantissa);
+      if (__d.__exponent < 0)
+      {
+        __result /= static_cast<_Tp>(__from_chars_exact_pow10[-__d.__exponent]);
+      }
+      else
+      {
+        __result *= static_cast<_Tp>(__from_chars_exact_pow10[__d.__exponent]);
+      }
+      __value = __neg ? -__result : __result;
+      return {__end, errc{}};
+    }
+
+    __from_chars_adjusted_mantissa __am = _CUDA_VSTD::__from_chars_compute_float<_Tp>(__d.__exponent, __d.__mantissa);
+    __bits = static_cast<_Storage>((uint64_t{static_cast<uint32_t>(__am.__power2)} << _Traits::__mantissa_bits)
+                                   | __am.__mantissa);
+    if (__d.__too_many_digits)
+    {
+      // The digits are between w and w + 1, which round either to the same value or to two adjacent ones.
+      const __from_chars_adjusted_mantissa __am_up =
+        _CUDA_VSTD::__from_chars_compute_float<_Tp>(__d.__exponent, __d.__mantissa + 1);
+      if (__am.__power2 != __am_up.__power2 || __am.__mantissa != __am_up.__mantissa)
+      {
+        __bits = _CUDA_VSTD::__from_chars_round_exact<_Tp>(__d, __bits);
+      }
+    }
+    __nonzero = __d.__mantissa != 0;
+  }
+
+  // Like strtod, values which overflow or underflow to zero are out of range, but subnormal ones are not.
+  if (__bits == __infinity_bits || (__bits == 0 && __nonzero))
+  {
+    return {__end, errc::result_out_of_range};
+  }
+  __value = _CUDA_VSTD::bit_cast<_Tp>(static_cast<_Storage>(__bits | (__neg ? __sign_bit : 0)));
+  return {__end, errc{}};
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_CONSTEXPR_BIT_CAST from_chars_result from_chars(
+  const char* __first, const char* __last, float& __value, chars_format __fmt = chars_format::general) noexcept
+{
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+  return _CUDA_VSTD::__from_chars_floating_point(__first, __last, __value, __fmt);
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_CONSTEXPR_BIT_CAST from_chars_result from_chars(
+  const char* __first, const char* __last, double& __value, chars_format __fmt = chars_format::general) noexcept
+{
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+  return _CUDA_VSTD::__from_chars_floating_point(__first, __last, __value, __fmt);
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___CHARCONV_FROM_CHARS_FLOATING_POINT_H
@@ -21,6 +21,8 @@
 #endif // no system header
 
 #include <cuda/__cmath/uabs.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/integral.h>
 #include <cuda/std/__charconv/to_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
@@ -30,6 +32,7 @@
 #include <cuda/std/__type_traits/is_signed.h>
 #include <cuda/std/__type_traits/make_unsigned.h>
 #include <cuda/std/cstdint>
+#include <cuda/std/limits>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -92,6 +95,138 @@ _LIBCUDACXX_HIDE_FROM_ABI constexpr void __to_chars_int_generic(char* __last, _T
   } while (__value != 0);
 }
 
+// The two decimal digits of each number in [0, 100).
+_CCCL_GLOBAL_CONSTANT char __to_chars_digit_pairs[] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+_CCCL_GLOBAL_CONSTANT uint64_t __to_chars_pow10_u64[] = {
+  1ull,
+  10ull,
+  100ull,
+  1000ull,
+  10000ull,
+  100000ull,
+  1000000ull,
+  10000000ull,
+  100000000ull,
+  1000000000ull,
+  10000000000ull,
+  100000000000ull,
+  1000000000000ull,
+  10000000000000ull,
+  100000000000000ull,
+  1000000000000000ull,
+  10000000000000000ull,
+  100000000000000000ull,
+  1000000000000000000ull,
+  10000000000000000000ull};
+
+// The number of decimal digits of __v. floor(log10(2^n)) is (n * 1233) >> 12 for n <= 64, which is either the number of
+// digits or one less than it. Zero is handled as one, which has the same width.
+template <class _Up>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr int __to_chars_decimal_width(_Up __v) noexcept
+{
+  int __r = 0;
+  if constexpr (sizeof(_Up) > sizeof(uint64_t))
+  {
+    while (__v > _Up{numeric_limits<uint64_t>::max()})
+    {
+      __v /= _Up{__to_chars_pow10_u64[19]};
+      __r += 19;
+    }
+  }
+  const auto __v64 = static_cast<uint64_t>(__v);
+  const int __t    = (_CUDA_VSTD::bit_width(__v64 | 1) * 1233) >> 12;
+  return __r + __t + ((__v64 | 1) >= __to_chars_pow10_u64[__t]);
+}
+
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __to_chars_write_pair(char* __first, uint32_t __pair) noexcept
+{
+  __first[0] = __to_chars_digit_pairs[2 * __pair];
+  __first[1] = __to_chars_digit_pairs[2 * __pair + 1];
+}
+
+// Writes __v < 10^8 as exactly 8 digits ending at __last.
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __to_chars_eight_digits(char* __last, uint32_t __v) noexcept
+{
+  _CCCL_PRAGMA_UNROLL_FULL()
+  for (int __i = 0; __i < 4; ++__i)
+  {
+    __last -= 2;
+    _CUDA_VSTD::__to_chars_write_pair(__last, __v % 100);
+    __v /= 100;
+  }
+}
+
+// Writes the decimal digits of __value ending at __last, two at a time. Constant divisors compile to a multiplication
+// and a shift, and 32 bit ones are the cheapest, so wider values are first split into chunks of 8 or 19 digits.
+template <class _Up>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __to_chars_int_decimal(char* __last, _Up __value) noexcept
+{
+  if constexpr (sizeof(_Up) > sizeof(uint64_t))
+  {
+    while (__value > _Up{numeric_limits<uint64_t>::max()})
+    {
+      auto __low = static_cast<uint64_t>(__value % _Up{__to_chars_pow10_u64[19]});
+      __value /= _Up{__to_chars_pow10_u64[19]};
+      for (int __i = 0; __i < 2; ++__i)
+      {
+        _CUDA_VSTD::__to_chars_eight_digits(__last, static_cast<uint32_t>(__low % 100000000));
+        __low /= 100000000;
+        __last -= 8;
+      }
+      _CUDA_VSTD::__to_chars_write_pair(__last - 2, static_cast<uint32_t>(__low % 100));
+      *(__last - 3) = static_cast<char>('0' + __low / 100);
+      __last -= 3;
+    }
+    _CUDA_VSTD::__to_chars_int_decimal(__last, static_cast<uint64_t>(__value));
+  }
+  else if constexpr (sizeof(_Up) == sizeof(uint64_t))
+  {
+    while (__value > _Up{numeric_limits<uint32_t>::max()})
+    {
+      _CUDA_VSTD::__to_chars_eight_digits(__last, static_cast<uint32_t>(__value % 100000000));
+      __value /= 100000000;
+      __last -= 8;
+    }
+    _CUDA_VSTD::__to_chars_int_decimal(__last, static_cast<uint32_t>(__value));
+  }
+  else
+  {
+    auto __v = static_cast<uint32_t>(__value);
+    while (__v >= 100)
+    {
+      __last -= 2;
+      _CUDA_VSTD::__to_chars_write_pair(__last, __v % 100);
+      __v /= 100;
+    }
+    if (__v >= 10)
+    {
+      _CUDA_VSTD::__to_chars_write_pair(__last - 2, __v);
+    }
+    else
+    {
+      *--__last = static_cast<char>('0' + __v);
+    }
+  }
+}
+
+// Bases which are powers of two only need shifts and masks.
+template <class _Up>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __to_chars_int_pow2(char* __last, _Up __value, int __log2_base) noexcept
+{
+  const auto __mask = static_cast<_Up>((_Up{1} << __log2_base) - 1);
+  do
+  {
+    *--__last = "0123456789abcdefghijklmnopqrstuv"[static_cast<int>(__value & __mask)];
+    __value >>= __log2_base;
+  } while (__value != 0);
+}
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(_CCCL_TRAIT(__cccl_is_integer, _Tp))
 [[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr to_chars_result
@@ -111,7 +246,22 @@ to_chars(char* __first, char* __last, _Tp __value, int __base = 10) noexcept
   else
   {
     const ptrdiff_t __cap = __last - __first;
-    const int __n         = _CUDA_VSTD::__to_chars_int_width(__value, __base);
+    const bool __is_pow2  = (__base & (__base - 1)) == 0;
+    const int __log2_base = _CUDA_VSTD::countr_zero(static_cast<unsigned>(__base));
+
+    int __n = 0;
+    if (__base == 10)
+    {
+      __n = _CUDA_VSTD::__to_chars_decimal_width(__value);
+    }
+    else if (__is_pow2)
+    {
+      __n = (_CUDA_VSTD::bit_width(__value) + __log2_base - 1) / __log2_base + (__value == 0);
+    }
+    else
+    {
+      __n = _CUDA_VSTD::__to_chars_int_width(__value, __base);
+    }
 
     if (__n > __cap)
     {
@@ -120,7 +270,18 @@ to_chars(char* __first, char* __last, _Tp __value, int __base = 10) noexcept
 
     char* __new_last = __first + __n;
 
-    _CUDA_VSTD::__to_chars_int_generic(__new_last, __value, __base);
+    if (__base == 10)
+    {
+      _CUDA_VSTD::__to_chars_int_decimal(__new_last, __value);
+    }
+    else if (__is_pow2)
+    {
+      _CUDA_VSTD::__to_chars_int_pow2(__new_last, __value, __log2_base);
+    }
+    else
+    {
+      _CUDA_VSTD::__to_chars_int_generic(__new_last, __value, __base);
+    }
 
     return {__new_last, errc{}};
   }
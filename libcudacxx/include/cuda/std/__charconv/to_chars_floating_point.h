@@ -0,0 +1,696 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CHARCONV_TO_CHARS_FLOATING_POINT_H
+#define _LIBCUDACXX___CHARCONV_TO_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/powers_of_five.h>
+#include <cuda/std/__charconv/to_chars.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// The shortest decimal representation which reads back to the same value is computed with the Dragonbox algorithm, see
+// Jeon, "Dragonbox: A New Floating-Point Binary-to-Decimal Conversion Algorithm". The value is multiplied by an
+// approximation of 10^k, taken from the table of powers of five shared with from_chars, so that the interval of
+// decimals which round to it spans exactly one multiple of 10^kappa in most cases, and the few remaining cases are
+// decided from the parity and integrality of the product.
+
+template <class _Tp>
+struct __to_chars_fp_traits;
+
+template <>
+struct __to_chars_fp_traits<float>
+{
+  using __storage_type = uint32_t;
+
+  static constexpr int __mantissa_bits  = 23;
+  static constexpr int __exponent_bits  = 8;
+  static constexpr int __exponent_bias  = -127;
+  static constexpr int __min_exponent   = -126;
+  static constexpr int __kappa          = 1;
+  static constexpr uint32_t __big_div   = 100;
+  static constexpr uint32_t __small_div = 10;
+  // The range of binary exponents where the round trip of the shorter interval case has a tie.
+  static constexpr int __shorter_interval_tie = -35;
+  // Decimal exponents up to this one have an exact power of ten, and the largest exactly representable integer.
+  static constexpr int __max_exact_pow10        = 10;
+  static constexpr uint64_t __max_exact_integer = (uint64_t{1} << 24) - 1;
+  static constexpr int __hex_digits             = 6;
+};
+
+template <>
+struct __to_chars_fp_traits<double>
+{
+  using __storage_type = uint64_t;
+
+  static constexpr int __mantissa_bits          = 52;
+  static constexpr int __exponent_bits          = 11;
+  static constexpr int __exponent_bias          = -1023;
+  static constexpr int __min_exponent           = -1022;
+  static constexpr int __kappa                  = 2;
+  static constexpr uint32_t __big_div           = 1000;
+  static constexpr uint32_t __small_div         = 100;
+  static constexpr int __shorter_interval_tie   = -77;
+  static constexpr int __max_exact_pow10        = 22;
+  static constexpr uint64_t __max_exact_integer = (uint64_t{1} << 53) - 1;
+  static constexpr int __hex_digits             = 13;
+};
+
+// floor(e * log10(2)), floor(k * log2(10)) and floor(e * log10(2) - log10(4 / 3)) over the exponents we need.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr int __to_chars_floor_log10_pow2(int __e) noexcept
+{
+  return (__e * 315653) >> 20;
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr int __to_chars_floor_log2_pow10(int __k) noexcept
+{
+  return (__k * 1741647) >> 19;
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr int __to_chars_floor_log10_pow2_minus_log10_4_over_3(int __e) noexcept
+{
+  return (__e * 631305 - 261663) >> 21;
+}
+
+// The 10^k multipliers are 5^k rounded up to 128 bits for double and to 64 bits for float. The shared table is exact
+// up to 5^55 and rounded up below 5^0, so only the truncated entries above 5^55 need to be incremented.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr __charconv_uint128 __to_chars_cache(double, int __k) noexcept
+{
+  const auto __index         = static_cast<size_t>(2 * (__k - __pow5_128_min_exponent));
+  __charconv_uint128 __cache = {__pow5_128_table[__index], __pow5_128_table[__index + 1]};
+  if (__k > 55)
+  {
+    ++__cache.__low;
+    __cache.__high += __cache.__low == 0;
+  }
+  return __cache;
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr uint64_t __to_chars_cache(float, int __k) noexcept
+{
+  const auto __index = static_cast<size_t>(2 * (__k - __pow5_128_min_exponent));
+  return __pow5_128_table[__index] + (__pow5_128_table[__index + 1] != 0);
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr uint64_t __to_chars_cache_high(__charconv_uint128 __cache) noexcept
+{
+  return __cache.__high;
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr uint64_t __to_chars_cache_high(uint64_t __cache) noexcept
+{
+  return __cache;
+}
+
+// The integer part of u * 10^k * 2^beta, and whether it has no fractional part.
+template <class _Up>
+struct __to_chars_mul_result
+{
+  _Up __integer_part;
+  bool __is_integer;
+};
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr __to_chars_mul_result<uint64_t>
+__to_chars_compute_mul(uint64_t __u, __charconv_uint128 __cache) noexcept
+{
+  __charconv_uint128 __r    = _CUDA_VSTD::__charconv_mul_64x64(__u, __cache.__high);
+  const uint64_t __carry_in = _CUDA_VSTD::__charconv_mul_64x64(__u, __cache.__low).__high;
+  __r.__low += __carry_in;
+  __r.__high += __r.__low < __carry_in;
+  return {__r.__high, __r.__low == 0};
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr __to_chars_mul_result<uint32_t>
+__to_chars_compute_mul(uint32_t __u, uint64_t __cache) noexcept
+{
+  const uint64_t __r = (__u * (__cache >> 32)) + ((__u * (__cache & 0xFFFFFFFF)) >> 32);
+  return {static_cast<uint32_t>(__r >> 32), static_cast<uint32_t>(__r) == 0};
+}
+
+// The parity of the integer part of two_f * 10^k * 2^beta, and whether it has no fractional part.
+struct __to_chars_parity_result
+{
+  bool __parity;
+  bool __is_integer;
+};
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr __to_chars_parity_result
+__to_chars_compute_mul_parity(uint64_t __two_f, __charconv_uint128 __cache, int __beta) noexcept
+{
+  const __charconv_uint128 __low_product = _CUDA_VSTD::__charconv_mul_64x64(__two_f, __cache.__low);
+  const uint64_t __high                  = __two_f * __cache.__high + __low_product.__high;
+  return {((__high >> (64 - __beta)) & 1) != 0,
+          ((__high << __beta) | (__low_product.__low >> (64 - __beta))) == 0};
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr __to_chars_parity_result
+__to_chars_compute_mul_parity(uint32_t __two_f, uint64_t __cache, int __beta) noexcept
+{
+  const uint64_t __r = __two_f * __cache;
+  return {((__r >> (64 - __beta)) & 1) != 0, static_cast<uint32_t>(__r >> (32 - __beta)) == 0};
+}
+
+// The value is __significand * 10^__exponent.
+template <class _Up>
+struct __to_chars_decimal_fp
+{
+  _Up __significand;
+  int __exponent;
+};
+
+template <class _Tp>
+using __to_chars_decimal_fp_for = __to_chars_decimal_fp<typename __to_chars_fp_traits<_Tp>::__storage_type>;
+
+template <class _Up>
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __to_chars_remove_trailing_zeros(__to_chars_decimal_fp<_Up>& __d) noexcept
+{
+  while (__d.__significand % 100 == 0)
+  {
+    __d.__significand /= 100;
+    __d.__exponent += 2;
+  }
+  if (__d.__significand % 10 == 0)
+  {
+    __d.__significand /= 10;
+    ++__d.__exponent;
+  }
+}
+
+// The shortest decimal in the interval of a power of two, whose lower neighbor is twice as close as the upper one.
+// Both ends are included, as the mantissa is even.
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr __to_chars_decimal_fp_for<_Tp>
+__to_chars_shorter_interval(int __e) noexcept
+{
+  using _Traits = __to_chars_fp_traits<_Tp>;
+  using _Up     = typename _Traits::__storage_type;
+
+  const int __minus_k    = _CUDA_VSTD::__to_chars_floor_log10_pow2_minus_log10_4_over_3(__e);
+  const int __beta       = __e + _CUDA_VSTD::__to_chars_floor_log2_pow10(-__minus_k);
+  const uint64_t __cache = _CUDA_VSTD::__to_chars_cache_high(_CUDA_VSTD::__to_chars_cache(_Tp{}, -__minus_k));
+  const int __shift      = 64 - _Traits::__mantissa_bits - 1 - __beta;
+  auto __xi              = static_cast<_Up>((__cache - (__cache >> (_Traits::__mantissa_bits + 2))) >> __shift);
+  const auto __zi        = static_cast<_Up>((__cache + (__cache >> (_Traits::__mantissa_bits + 1))) >> __shift);
+
+  // The left end point is an integer only for these exponents.
+  if (__e < 2 || __e > 3)
+  {
+    ++__xi;
+  }
+
+  __to_chars_decimal_fp<_Up> __ret{static_cast<_Up>(__zi / 10), __minus_k + 1};
+  if (__ret.__significand * 10 >= __xi)
+  {
+    _CUDA_VSTD::__to_chars_remove_trailing_zeros(__ret);
+    return __ret;
+  }
+
+  // Otherwise the shortest decimal has one more digit and is the one closest to the value.
+  __ret.__significand = static_cast<_Up>(((__cache >> (__shift - 1)) + 1) / 2);
+  __ret.__exponent    = __minus_k;
+  if ((__ret.__significand % 2) != 0 && __e == _Traits::__shorter_interval_tie)
+  {
+    --__ret.__significand;
+  }
+  else if (__ret.__significand < __xi)
+  {
+    ++__ret.__significand;
+  }
+  return __ret;
+}
+
+// Computes the shortest decimal which rounds to the finite, positive value with the given exponent and mantissa
+// fields. Among those, the closest one to the value is chosen, with ties to even.
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr __to_chars_decimal_fp_for<_Tp>
+__to_chars_dragonbox(typename __to_chars_fp_traits<_Tp>::__storage_type __mantissa, int __exponent_field) noexcept
+{
+  using _Traits = __to_chars_fp_traits<_Tp>;
+  using _Up     = typename _Traits::__storage_type;
+
+  constexpr int __kappa          = _Traits::__kappa;
+  constexpr uint32_t __big_div   = _Traits::__big_div;
+  constexpr uint32_t __small_div = _Traits::__small_div;
+
+  auto __two_fc = static_cast<_Up>(__mantissa << 1);
+  int __e       = 0;
+  if (__exponent_field != 0)
+  {
+    __e = __exponent_field + _Traits::__exponent_bias - _Traits::__mantissa_bits;
+    if (__two_fc == 0)
+    {
+      return _CUDA_VSTD::__to_chars_shorter_interval<_Tp>(__e);
+    }
+    __two_fc |= _Up{1} << (_Traits::__mantissa_bits + 1);
+  }
+  else
+  {
+    __e = _Traits::__min_exponent - _Traits::__mantissa_bits;
+  }
+  const bool __include_end_points = (__mantissa % 2) == 0;
+
+  const int __minus_k = _CUDA_VSTD::__to_chars_floor_log10_pow2(__e) - __kappa;
+  const auto __cache  = _CUDA_VSTD::__to_chars_cache(_Tp{}, -__minus_k);
+  const int __beta    = __e + _CUDA_VSTD::__to_chars_floor_log2_pow10(-__minus_k);
+  const auto __deltai = static_cast<uint32_t>(_CUDA_VSTD::__to_chars_cache_high(__cache) >> (63 - __beta));
+  const auto __z      = _CUDA_VSTD::__to_chars_compute_mul(static_cast<_Up>((__two_fc | 1) << __beta), __cache);
+
+  // Try the larger divisor first: the interval contains a multiple of 10^(kappa + 1) when the remainder of its upper
+  // end is below its width.
+  __to_chars_decimal_fp<_Up> __ret{static_cast<_Up>(__z.__integer_part / __big_div), __minus_k + __kappa + 1};
+  auto __r = static_cast<uint32_t>(__z.__integer_part - __big_div * __ret.__significand);
+
+  bool __small_divisor = false;
+  if (__r < __deltai)
+  {
+    // The upper end is excluded when the mantissa is odd.
+    if (__r == 0 && __z.__is_integer && !__include_end_points)
+    {
+      --__ret.__significand;
+      __r             = __big_div;
+      __small_divisor = true;
+    }
+  }
+  else if (__r > __deltai)
+  {
+    __small_divisor = true;
+  }
+  else
+  {
+    // The remainder is exactly the width, so the lower end decides.
+    const __to_chars_parity_result __x =
+      _CUDA_VSTD::__to_chars_compute_mul_parity(static_cast<_Up>(__two_fc - 1), __cache, __beta);
+    __small_divisor = !(__x.__parity || (__x.__is_integer && __include_end_points));
+  }
+
+  if (!__small_divisor)
+  {
+    _CUDA_VSTD::__to_chars_remove_trailing_zeros(__ret);
+    return __ret;
+  }
+
+  // Otherwise, there is one more digit, and the result is the multiple of 10^kappa closest to the value.
+  __ret.__significand *= 10;
+  __ret.__exponent = __minus_k + __kappa;
+
+  uint32_t __dist            = __r - (__deltai / 2) + (__small_div / 2);
+  const bool __approx_parity = ((__dist ^ (__small_div / 2)) & 1) != 0;
+  const bool __divisible     = (__dist % __small_div) == 0;
+  __dist /= __small_div;
+  __ret.__significand += __dist;
+
+  if (__divisible)
+  {
+    // The value is either at the computed decimal or just below it, which the parity of the product tells apart. When
+    // it is exactly halfway between two decimals, round to even.
+    const __to_chars_parity_result __y = _CUDA_VSTD::__to_chars_compute_mul_parity(__two_fc, __cache, __beta);
+    if (__y.__parity != __approx_parity)
+    {
+      --__ret.__significand;
+    }
+    else if (__y.__is_integer && (__ret.__significand % 2) != 0)
+    {
+      --__ret.__significand;
+    }
+  }
+  return __ret;
+}
+
+// Writes __v < 10^9 as exactly 9 digits ending at __last.
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __to_chars_nine_digits(char* __last, uint32_t __v) noexcept
+{
+  _CUDA_VSTD::__to_chars_eight_digits(__last, __v % 100000000);
+  *(__last - 9) = static_cast<char>('0' + __v / 100000000);
+}
+
+// Writes mantissa * 2^__exp2 exactly, for the values whose shortest decimal representation has trailing zeros which are
+// not the ones of the value.
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr to_chars_result
+__to_chars_large_integer(char* __first, char* __last, uint64_t __mantissa, int __exp2) noexcept
+{
+  using _Traits = __to_chars_fp_traits<_Tp>;
+
+  // The value has at most 2^(max exponent + 1) bits, and a 9 digit chunk per 29.9 of them.
+  constexpr int __max_limbs  = (-_Traits::__exponent_bias + 1) / 32 + 2;
+  constexpr int __max_chunks = (__max_limbs * 32) / 29 + 1;
+
+  uint32_t __limbs[__max_limbs] = {};
+  const int __word_shift        = __exp2 / 32;
+  const int __bit_shift         = __exp2 % 32;
+  __limbs[__word_shift]         = static_cast<uint32_t>(__mantissa << __bit_shift);
+  __limbs[__word_shift + 1]     = static_cast<uint32_t>(__mantissa >> (32 - __bit_shift));
+  __limbs[__word_shift + 2]     = static_cast<uint32_t>((__mantissa >> 32) >> (32 - __bit_shift));
+  int __size                    = __word_shift + 3;
+
+  // Divide by 10^9 from the most significant limb, and collect the remainders as 9 digit chunks.
+  uint32_t __chunks[__max_chunks] = {};
+  int __nchunks                   = 0;
+  while (__size > 0)
+  {
+    uint64_t __rem = 0;
+    for (int __i = __size - 1; __i >= 0; --__i)
+    {
+      const uint64_t __cur = (__rem << 32) | __limbs[__i];
+      __limbs[__i]         = static_cast<uint32_t>(__cur / 1000000000);
+      __rem                = __cur % 1000000000;
+    }
+    __chunks[__nchunks++] = static_cast<uint32_t>(__rem);
+    while (__size > 0 && __limbs[__size - 1] == 0)
+    {
+      --__size;
+    }
+  }
+
+  const int __top_width = _CUDA_VSTD::__to_chars_decimal_width(__chunks[__nchunks - 1]);
+  const ptrdiff_t __len = __top_width + 9 * (__nchunks - 1);
+  if (__len > __last - __first)
+  {
+    return {__last, errc::value_too_large};
+  }
+  char* __p = __first + __top_width;
+  _CUDA_VSTD::__to_chars_int_decimal(__p, __chunks[__nchunks - 1]);
+  for (int __i = __nchunks - 2; __i >= 0; --__i)
+  {
+    __p += 9;
+    _CUDA_VSTD::__to_chars_nine_digits(__p, __chunks[__i]);
+  }
+  return {__p, errc{}};
+}
+
+// Fixed notation of __d.__significand * 10^__d.__exponent, which has __olength digits.
+template <class _Tp, class _Up>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr to_chars_result __to_chars_fixed(
+  char* __first,
+  char* __last,
+  __to_chars_decimal_fp<_Up> __d,
+  int __olength,
+  typename __to_chars_fp_traits<_Tp>::__storage_type __mantissa,
+  int __exponent_field) noexcept
+{
+  using _Traits = __to_chars_fp_traits<_Tp>;
+
+  const ptrdiff_t __cap = __last - __first;
+  if (__d.__exponent >= 0)
+  {
+    // The digits followed by zeros are the value only when they are exactly representable. Otherwise, as with printf,
+    // the exact integer is written, which has as many characters and is closer to the value.
+    bool __exact = __d.__exponent <= _Traits::__max_exact_pow10;
+    if (__exact && __d.__exponent > 0)
+    {
+      uint64_t __odd_part = __d.__significand >> _CUDA_VSTD::countr_zero(__d.__significand);
+      int __i             = 0;
+      for (; __i < __d.__exponent && __odd_part <= _Traits::__max_exact_integer / 5; ++__i)
+      {
+        __odd_part *= 5;
+      }
+      __exact = __i == __d.__exponent;
+    }
+    if (!__exact)
+    {
+      const uint64_t __m = __mantissa | (uint64_t{1} << _Traits::__mantissa_bits);
+      return _CUDA_VSTD::__to_chars_large_integer<_Tp>(
+        __first, __last, __m, __exponent_field + _Traits::__exponent_bias - _Traits::__mantissa_bits);
+    }
+
+    const int __len = __olength + __d.__exponent;
+    if (__len > __cap)
+    {
+      return {__last, errc::value_too_large};
+    }
+    _CUDA_VSTD::__to_chars_int_decimal(__first + __olength, __d.__significand);
+    for (char* __p = __first + __olength; __p != __first + __len; ++__p)
+    {
+      *__p = '0';
+    }
+    return {__first + __len, errc{}};
+  }
+
+  const int __int_digits = __olength + __d.__exponent;
+  if (__int_digits > 0)
+  {
+    // The decimal point is between the digits: write them and move the integer ones one character to the left.
+    if (__olength + 1 > __cap)
+    {
+      return {__last, errc::value_too_large};
+    }
+    _CUDA_VSTD::__to_chars_int_decimal(__first + __olength + 1, __d.__significand);
+    for (int __i = 0; __i < __int_digits; ++__i)
+    {
+      __first[__i] = __first[__i + 1];
+    }
+    __first[__int_digits] = '.';
+    return {__first + __olength + 1, errc{}};
+  }
+
+  const int __len = 2 - __d.__exponent;
+  if (__len > __cap)
+  {
+    return {__last, errc::value_too_large};
+  }
+  for (char* __p = __first; __p != __first + __len - __olength; ++__p)
+  {
+    *__p = '0';
+  }
+  __first[1] = '.';
+  _CUDA_VSTD::__to_chars_int_decimal(__first + __len, __d.__significand);
+  return {__first + __len, errc{}};
+}
+
+// Writes the exponent of the scientific and hexadecimal notations, with its sign and at least __min_digits digits.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr char*
+__to_chars_exponent(char* __p, int __exp, int __min_digits) noexcept
+{
+  *__p++           = __exp < 0 ? '-' : '+';
+  const auto __abs = static_cast<uint32_t>(__exp < 0 ? -__exp : __exp);
+  const int __n    = _CUDA_VSTD::__to_chars_decimal_width(__abs);
+  const int __w    = __n < __min_digits ? __min_digits : __n;
+  for (int __i = 0; __i < __w - __n; ++__i)
+  {
+    *__p++ = '0';
+  }
+  _CUDA_VSTD::__to_chars_int_decimal(__p + __n, __abs);
+  return __p + __n;
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr int __to_chars_scientific_length(int __olength, int __exp10) noexcept
+{
+  return __olength + (__olength > 1) + 2 + ((__exp10 <= -100 || __exp10 >= 100) ? 3 : 2);
+}
+
+template <class _Up>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr to_chars_result
+__to_chars_scientific(char* __first, char* __last, __to_chars_decimal_fp<_Up> __d, int __olength) noexcept
+{
+  const int __exp10 = __d.__exponent + __olength - 1;
+  if (_CUDA_VSTD::__to_chars_scientific_length(__olength, __exp10) > __last - __first)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  // Write the digits one character to the right, then move the first one in front of the decimal point.
+  _CUDA_VSTD::__to_chars_int_decimal(__first + __olength + 1, __d.__significand);
+  __first[0] = __first[1];
+  char* __p  = __first + 1;
+  if (__olength > 1)
+  {
+    __first[1] = '.';
+    __p        = __first + __olength + 1;
+  }
+  *__p++ = 'e';
+  return {_CUDA_VSTD::__to_chars_exponent(__p, __exp10, 2), errc{}};
+}
+
+// Hexadecimal notation without the 0x prefix and with the trailing zeros of the mantissa removed, like printf's %a.
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr to_chars_result __to_chars_hex(
+  char* __first,
+  char* __last,
+  typename __to_chars_fp_traits<_Tp>::__storage_type __mantissa,
+  int __exponent_field) noexcept
+{
+  using _Traits = __to_chars_fp_traits<_Tp>;
+
+  int __exp2 = 0;
+  if (__exponent_field != 0)
+  {
+    __exp2 = __exponent_field + _Traits::__exponent_bias;
+  }
+  else if (__mantissa != 0)
+  {
+    __exp2 = _Traits::__min_exponent;
+  }
+
+  // Align the mantissa on a whole number of hexadecimal digits, and drop the trailing zero ones.
+  const auto __aligned = static_cast<uint64_t>(__mantissa) << (4 * _Traits::__hex_digits - _Traits::__mantissa_bits);
+  const int __ndigits  = __aligned == 0 ? 0 : _Traits::__hex_digits - _CUDA_VSTD::countr_zero(__aligned) / 4;
+  const uint64_t __m   = __aligned >> (4 * (_Traits::__hex_digits - __ndigits));
+
+  // The leading digit, the point and the other digits, then p, the sign and the exponent.
+  const auto __abs_exp2 = static_cast<uint32_t>(__exp2 < 0 ? -__exp2 : __exp2);
+  const int __len =
+    1 + (__ndigits > 0 ? __ndigits + 1 : 0) + 2 + _CUDA_VSTD::__to_chars_decimal_width(__abs_exp2);
+  if (__len > __last - __first)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  char* __p = __first;
+  *__p++    = __exponent_field != 0 ? '1' : '0';
+  if (__ndigits > 0)
+  {
+    *__p++ = '.';
+    for (int __i = __ndigits - 1; __i >= 0; --__i)
+    {
+      *__p++ = "0123456789abcdef"[(__m >> (4 * __i)) & 0xF];
+    }
+  }
+  *__p++ = 'p';
+  return {_CUDA_VSTD::__to_chars_exponent(__p, __exp2, 1), errc{}};
+}
+
+// __fmt is either one of the chars_format values, or empty for the overload without a format, which picks the shorter
+// of fixed and scientific notation.
+template <class _Tp>
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_CONSTEXPR_BIT_CAST to_chars_result
+__to_chars_floating_point(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
+{
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+
+  using _Traits  = __to_chars_fp_traits<_Tp>;
+  using _Storage = typename _Traits::__storage_type;
+
+  constexpr int __sign_shift    = sizeof(_Storage) * 8 - 1;
+  constexpr auto __max_exponent = (1 << _Traits::__exponent_bits) - 1;
+
+  const auto __bits          = _CUDA_VSTD::bit_cast<_Storage>(__value);
+  const auto __mantissa      = static_cast<_Storage>(__bits & ((_Storage{1} << _Traits::__mantissa_bits) - 1));
+  const int __exponent_field = static_cast<int>((__bits >> _Traits::__mantissa_bits) & __max_exponent);
+
+  if ((__bits >> __sign_shift) != 0)
+  {
+    if (__first == __last)
+    {
+      return {__last, errc::value_too_large};
+    }
+    *__first++ = '-';
+  }
+
+  if (__exponent_field == __max_exponent)
+  {
+    if (__last - __first < 3)
+    {
+      return {__last, errc::value_too_large};
+    }
+    const char* __str = __mantissa == 0 ? "inf" : "nan";
+    for (int __i = 0; __i < 3; ++__i)
+    {
+      __first[__i] = __str[__i];
+    }
+    return {__first + 3, errc{}};
+  }
+
+  if (__fmt == chars_format::hex)
+  {
+    return _CUDA_VSTD::__to_chars_hex<_Tp>(__first, __last, __mantissa, __exponent_field);
+  }
+
+  __to_chars_decimal_fp<_Storage> __d{0, 0};
+  if (__exponent_field != 0 || __mantissa != 0)
+  {
+    __d = _CUDA_VSTD::__to_chars_dragonbox<_Tp>(__mantissa, __exponent_field);
+  }
+  const int __olength = _CUDA_VSTD::__to_chars_decimal_width(__d.__significand);
+  const int __exp10   = __d.__exponent + __olength - 1;
+
+  bool __use_fixed = __fmt == chars_format::fixed;
+  if (__fmt == chars_format{})
+  {
+    // The shorter of the two notations, and fixed on ties.
+    int __fixed_length = 0;
+    if (__d.__exponent >= 0)
+    {
+      __fixed_length = __olength + __d.__exponent;
+    }
+    else if (__olength + __d.__exponent > 0)
+    {
+      __fixed_length = __olength + 1;
+    }
+    else
+    {
+      __fixed_length = 2 - __d.__exponent;
+    }
+    __use_fixed = __fixed_length <= _CUDA_VSTD::__to_chars_scientific_length(__olength, __exp10);
+  }
+  else if (__fmt == chars_format::general)
+  {
+    // Like printf's %g with the default precision of 6.
+    __use_fixed = __exp10 >= -4 && __exp10 < 6;
+  }
+
+  if (__use_fixed)
+  {
+    return _CUDA_VSTD::__to_chars_fixed<_Tp>(__first, __last, __d, __olength, __mantissa, __exponent_field);
+  }
+  return _CUDA_VSTD::__to_chars_scientific(__first, __last, __d, __olength);
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_CONSTEXPR_BIT_CAST to_chars_result
+to_chars(char* __first, char* __last, float __value) noexcept
+{
+  return _CUDA_VSTD::__to_chars_floating_point(__first, __last, __value, chars_format{});
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_CONSTEXPR_BIT_CAST to_chars_result
+to_chars(char* __first, char* __last, double __value) noexcept
+{
+  return _CUDA_VSTD::__to_chars_floating_point(__first, __last, __value, chars_format{});
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_CONSTEXPR_BIT_CAST to_chars_result
+to_chars(char* __first, char* __last, float __value, chars_format __fmt) noexcept
+{
+  _CCCL_ASSERT(__fmt == chars_format::scientific || __fmt == chars_format::fixed || __fmt == chars_format::hex
+                 || __fmt == chars_format::general,
+               "invalid chars_format");
+  return _CUDA_VSTD::__to_chars_floating_point(__first, __last, __value, __fmt);
+}
+
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_CONSTEXPR_BIT_CAST to_chars_result
+to_chars(char* __first, char* __last, double __value, chars_format __fmt) noexcept
+{
+  _CCCL_ASSERT(__fmt == chars_format::scientific || __fmt == chars_format::fixed || __fmt == chars_format::hex
+                 || __fmt == chars_format::general,
+               "invalid chars_format");
+  return _CUDA_VSTD::__to_chars_floating_point(__first, __last, __value, __fmt);
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___CHARCONV_TO_CHARS_FLOATING_POINT_H
@@ -0,0 +1,380 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___FUNCTIONAL_HASH_BYTES_H
+#define _LIBCUDACXX___FUNCTIONAL_HASH_BYTES_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/__utility/swap.h>
+#include <cuda/std/climits>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+template <class _Size>
+_LIBCUDACXX_HIDE_FROM_ABI _Size __loadword(const void* __p)
+{
+  _Size __r;
+  _CUDA_VSTD::memcpy(&__r, __p, sizeof(__r));
+  return __r;
+}
+
+// We use murmur2 when size_t is 32 bits, and cityhash64 when size_t
+// is 64 bits.  This is because cityhash64 uses 64bit x 64bit
+// multiplication, which can be very slow on 32-bit systems.
+template <class _Size, size_t = sizeof(_Size) * CHAR_BIT>
+struct __murmur2_or_cityhash;
+
+template <class _Size>
+struct __murmur2_or_cityhash<_Size, 32>
+{
+  _LIBCUDACXX_HIDE_FROM_ABI _Size operator()(const void* __key, _Size __len) _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW;
+};
+
+// murmur2
+template <class _Size>
+_LIBCUDACXX_HIDE_FROM_ABI _Size __murmur2_or_cityhash<_Size, 32>::operator()(const void* __key, _Size __len)
+{
+  const _Size __m             = 0x5bd1e995;
+  const _Size __r             = 24;
+  _Size __h                   = __len;
+  const unsigned char* __data = static_cast<const unsigned char*>(__key);
+  for (; __len >= 4; __data += 4, __len -= 4)
+  {
+    _Size __k = __loadword<_Size>(__data);
+    __k *= __m;
+    __k ^= __k >> __r;
+    __k *= __m;
+    __h *= __m;
+    __h ^= __k;
+  }
+  switch (__len)
+  {
+    case 3:
+      __h ^= static_cast<_Size>(__data[2] << 16);
+      [[fallthrough]];
+    case 2:
+      __h ^= static_cast<_Size>(__data[1] << 8);
+      [[fallthrough]];
+    case 1:
+      __h ^= __data[0];
+      __h *= __m;
+  }
+  __h ^= __h >> 13;
+  __h *= __m;
+  __h ^= __h >> 15;
+  return __h;
+}
+
+template <class _Size>
+struct __murmur2_or_cityhash<_Size, 64>
+{
+  _LIBCUDACXX_HIDE_FROM_ABI _Size operator()(const void* __key, _Size __len) _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW;
+
+private:
+  // Some primes between 2^63 and 2^64.
+  static const _Size __k0 = 0xc3a5c85c97cb3127ULL;
+  static const _Size __k1 = 0xb492b66fbe98f273ULL;
+  static const _Size __k2 = 0x9ae16a3b2f90404fULL;
+  static const _Size __k3 = 0xc949d7c7509e6557ULL;
+
+  _LIBCUDACXX_HIDE_FROM_ABI static _Size __rotate(_Size __val, int __shift)
+  {
+    return __shift == 0 ? __val : ((__val >> __shift) | (__val << (64 - __shift)));
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI static _Size __rotate_by_at_least_1(_Size __val, int __shift)
+  {
+    return (__val >> __shift) | (__val << (64 - __shift));
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI static _Size __shift_mix(_Size __val)
+  {
+    return __val ^ (__val >> 47);
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI static _Size __hash_len_16(_Size __u, _Size __v) _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW
+  {
+    const _Size __mul = 0x9ddfea08eb382d69ULL;
+    _Size __a         = (__u ^ __v) * __mul;
+    __a ^= (__a >> 47);
+    _Size __b = (__v ^ __a) * __mul;
+    __b ^= (__b >> 47);
+    __b *= __mul;
+    return __b;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI static _Size
+  __hash_len_0_to_16(const char* __s, _Size __len) _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW
+  {
+    if (__len > 8)
+    {
+      const _Size __a = __loadword<_Size>(__s);
+      const _Size __b = __loadword<_Size>(__s + __len - 8);
+      return __hash_len_16(__a, __rotate_by_at_least_1(__b + __len, __len)) ^ __b;
+    }
+    if (__len >= 4)
+    {
+      const uint32_t __a = __loadword<uint32_t>(__s);
+      const uint32_t __b = __loadword<uint32_t>(__s + __len - 4);
+      return __hash_len_16(__len + (static_cast<_Size>(__a) << 3), __b);
+    }
+    if (__len > 0)
+    {
+      const unsigned char __a = static_cast<unsigned char>(__s[0]);
+      const unsigned char __b = static_cast<unsigned char>(__s[__len >> 1]);
+      const unsigned char __c = static_cast<unsigned char>(__s[__len - 1]);
+      const uint32_t __y      = static_cast<uint32_t>(__a) + (static_cast<uint32_t>(__b) << 8);
+      const uint32_t __z      = __len + (static_cast<uint32_t>(__c) << 2);
+      return __shift_mix(__y * __k2 ^ __z * __k3) * __k2;
+    }
+    return __k2;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI static _Size
+  __hash_len_17_to_32(const char* __s, _Size __len) _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW
+  {
+    const _Size __a = __loadword<_Size>(__s) * __k1;
+    const _Size __b = __loadword<_Size>(__s + 8);
+    const _Size __c = __loadword<_Size>(__s + __len - 8) * __k2;
+    const _Size __d = __loadword<_Size>(__s + __len - 16) * __k0;
+    return __hash_len_16(__rotate(__a - __b, 43) + __rotate(__c, 30) + __d,
+                         __a + __rotate(__b ^ __k3, 20) - __c + __len);
+  }
+
+  // Return a 16-byte hash for 48 bytes.  Quick and dirty.
+  // Callers do best to use "random-looking" values for a and b.
+  _LIBCUDACXX_HIDE_FROM_ABI static pair<_Size, _Size>
+  __weak_hash_len_32_with_seeds(_Size __w, _Size __x, _Size __y, _Size __z, _Size __a, _Size __b)
+    _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW
+  {
+    __a += __w;
+    __b             = __rotate(__b + __a + __z, 21);
+    const _Size __c = __a;
+    __a += __x;
+    __a += __y;
+    __b += __rotate(__a, 44);
+    return pair<_Size, _Size>(__a + __z, __b + __c);
+  }
+
+  // Return a 16-byte hash for s[0] ... s[31], a, and b.  Quick and dirty.
+  _LIBCUDACXX_HIDE_FROM_ABI static pair<_Size, _Size>
+  __weak_hash_len_32_with_seeds(const char* __s, _Size __a, _Size __b) _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW
+  {
+    return __weak_hash_len_32_with_seeds(
+      __loadword<_Size>(__s),
+      __loadword<_Size>(__s + 8),
+      __loadword<_Size>(__s + 16),
+      __loadword<_Size>(__s + 24),
+      __a,
+      __b);
+  }
+
+  // Return an 8-byte hash for 33 to 64 bytes.
+  _LIBCUDACXX_HIDE_FROM_ABI static _Size
+  __hash_len_33_to_64(const char* __s, size_t __len) _CCCL_NO_SANITIZE_UNSIGNED_OVERFLOW
+  {
+    _Size __z = __loadword<_Size>(__s + 24);
+    _Size __a = __loadword<_Size>(__s) + (__len + __loadword<_Size>(__s + __len - 16)) * __k0;
+    _Size __b = __rotate(__a + __z, 52);
+    _Size __c = __rotate(__a, 37);
+    __a += __loadword<_Size>(__s + 8);
+    __c += __rotate(__a, 7);
+    __a += __loadword<_Size>(__s + 16);
+    _Size __vf = __a + __z;
+    _Size __vs = __b + __rotate(__a, 31) + __c;
+    __a        = __loadword<_Size>(__s + 16) + __loadword<_Size>(__s + __len - 32);
+    __z += __loadword<_Size>(__s + __len - 8);
+    __b = __rotate(__a + __z, 52);
+    __c = __rotate(__a, 37);
+    __a += __loadword<_Size>(__s + __len - 24);
+    __c += __rotate(__a, 7);
+    __a += __loadword<_Size>(__s + __len - 16);
+    _Size __wf = __a + __z;
+    _Size __ws = __b + __rotate(__a, 31) + __c;
+    _Size __r  = __shift_mix((__vf + __ws) * __k2 + (__wf + __vs) * __k0);
+    return __shift_mix(__r * __k0 + __vs) * __k2;
+  }
+};
+
+// cityhash64
+template <class _Size>
+_LIBCUDACXX_HIDE_FROM_ABI _Size __murmur2_or_cityhash<_Size, 64>::operator()(const void* __key, _Size __len)
+{
+  const char* __s = static_cast<const char*>(__key);
+  if (__len <= 32)
+  {
+    if (__len <= 16)
+    {
+      return __hash_len_0_to_16(__s, __len);
+    }
+    else
+    {
+      return __hash_len_17_to_32(__s, __len);
+    }
+  }
+  else if (__len <= 64)
+  {
+    return __hash_len_33_to_64(__s, __len);
+  }
+
+  // For strings over 64 bytes we hash the end first, and then as we
+  // loop we keep 56 bytes of state: v, w, x, y, and z.
+  _Size __x = __loadword<_Size>(__s + __len - 40);
+  _Size __y = __loadword<_Size>(__s + __len - 16) + __loadword<_Size>(__s + __len - 56);
+  _Size __z = __hash_len_16(__loadword<_Size>(__s + __len - 48) + __len, __loadword<_Size>(__s + __len - 24));
+  pair<_Size, _Size> __v = __weak_hash_len_32_with_seeds(__s + __len - 64, __len, __z);
+  pair<_Size, _Size> __w = __weak_hash_len_32_with_seeds(__s + __len - 32, __y + __k1, __x);
+  __x                    = __x * __k1 + __loadword<_Size>(__s);
+
+  // Decrease len to the nearest multiple of 64, and operate on 64-byte chunks.
+  __len = (__len - 1) & ~static_cast<_Size>(63);
+  do
+  {
+    __x = __rotate(__x + __y + __v.first + __loadword<_Size>(__s + 8), 37) * __k1;
+    __y = __rotate(__y + __v.second + __loadword<_Size>(__s + 48), 42) * __k1;
+    __x ^= __w.second;
+    __y += __v.first + __loadword<_Size>(__s + 40);
+    __z = __rotate(__z + __w.first, 33) * __k1;
+    __v = __weak_hash_len_32_with_seeds(__s, __v.second * __k1, __x + __w.first);
+    __w = __weak_hash_len_32_with_seeds(__s + 32, __z + __w.second, __y + __loadword<_Size>(__s + 16));
+    _CUDA_VSTD::swap(__z, __x);
+    __s += 64;
+    __len -= 64;
+  } while (__len != 0);
+  return __hash_len_16(__hash_len_16(__v.first, __w.first) + __shift_mix(__y) * __k1 + __z,
+                       __hash_len_16(__v.second, __w.second) + __x);
+}
+
+// __hash_bytes is the hash of cuda::hash_bytes. Its results may change between releases.
+
+// The default secret of wyhash.
+_CCCL_GLOBAL_CONSTANT uint64_t __hash_k0 = 0x2d358dccaa6c78a5ull;
+_CCCL_GLOBAL_CONSTANT uint64_t __hash_k1 = 0x8bb84b93962eacc9ull;
+_CCCL_GLOBAL_CONSTANT uint64_t __hash_k2 = 0x4b33a62ed433d4a3ull;
+_CCCL_GLOBAL_CONSTANT uint64_t __hash_k3 = 0x4d5a2da51de1aa47ull;
+
+// Replaces __a and __b by the low and high halves of their 128-bit product.
+_LIBCUDACXX_HIDE_FROM_ABI constexpr void __hash_mum(uint64_t& __a, uint64_t& __b) noexcept
+{
+#if _CCCL_HAS_INT128()
+  const __uint128_t __r = static_cast<__uint128_t>(__a) * __b;
+  __a                   = static_cast<uint64_t>(__r);
+  __b                   = static_cast<uint64_t>(__r >> 64);
+#else // ^^^ _CCCL_HAS_INT128() ^^^ / vvv !_CCCL_HAS_INT128() vvv
+  const uint64_t __a_lo = static_cast<uint32_t>(__a);
+  const uint64_t __a_hi = __a >> 32;
+  const uint64_t __b_lo = static_cast<uint32_t>(__b);
+  const uint64_t __b_hi = __b >> 32;
+  const uint64_t __p0   = __a_lo * __b_lo;
+  const uint64_t __p1   = __a_lo * __b_hi;
+  const uint64_t __p2   = __a_hi * __b_lo;
+  const uint64_t __p3   = __a_hi * __b_hi;
+  const uint64_t __mid  = (__p0 >> 32) + static_cast<uint32_t>(__p1) + static_cast<uint32_t>(__p2);
+  __a                   = (__mid << 32) | static_cast<uint32_t>(__p0);
+  __b                   = __p3 + (__p1 >> 32) + (__p2 >> 32) + (__mid >> 32);
+#endif // !_CCCL_HAS_INT128()
+}
+
+// Folds the 128-bit product of __a and __b into 64 bits, the mixing step of wyhash.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI constexpr uint64_t __hash_mix(uint64_t __a, uint64_t __b) noexcept
+{
+  _CUDA_VSTD::__hash_mum(__a, __b);
+  return __a ^ __b;
+}
+
+// Consumes the inputs of more than 16 bytes, 48 bytes at a time by three independent lanes so that their
+// multiplications overlap, then 16 bytes at a time, and loads their last 16 bytes into __a and __b.
+_LIBCUDACXX_HIDE_FROM_ABI uint64_t
+__hash_bytes_long(const unsigned char* __p, size_t __len, uint64_t __seed, uint64_t& __a, uint64_t& __b) noexcept
+{
+  if (__len >= 48)
+  {
+    uint64_t __seed1 = __seed;
+    uint64_t __seed2 = __seed;
+    do
+    {
+      __seed  = _CUDA_VSTD::__hash_mix(
+        _CUDA_VSTD::__loadword<uint64_t>(__p) ^ __hash_k1, _CUDA_VSTD::__loadword<uint64_t>(__p + 8) ^ __seed);
+      __seed1 = _CUDA_VSTD::__hash_mix(
+        _CUDA_VSTD::__loadword<uint64_t>(__p + 16) ^ __hash_k2, _CUDA_VSTD::__loadword<uint64_t>(__p + 24) ^ __seed1);
+      __seed2 = _CUDA_VSTD::__hash_mix(
+        _CUDA_VSTD::__loadword<uint64_t>(__p + 32) ^ __hash_k3, _CUDA_VSTD::__loadword<uint64_t>(__p + 40) ^ __seed2);
+      __p += 48;
+      __len -= 48;
+    } while (__len >= 48);
+    __seed ^= __seed1 ^ __seed2;
+  }
+  while (__len > 16)
+  {
+    __seed = _CUDA_VSTD::__hash_mix(
+      _CUDA_VSTD::__loadword<uint64_t>(__p) ^ __hash_k1, _CUDA_VSTD::__loadword<uint64_t>(__p + 8) ^ __seed);
+    __p += 16;
+    __len -= 16;
+  }
+  // The last 16 bytes, which may overlap with the ones already hashed.
+  __a = _CUDA_VSTD::__loadword<uint64_t>(__p + __len - 16);
+  __b = _CUDA_VSTD::__loadword<uint64_t>(__p + __len - 8);
+  return __seed;
+}
+
+// Hashes the byte range [__key, __key + __len), following the design of wyhash. Inputs of up to 16 bytes are hashed
+// inline with two multiplications.
+[[nodiscard]] _LIBCUDACXX_HIDE_FROM_ABI uint64_t
+__hash_bytes(const void* __key, size_t __len, uint64_t __seed = 0) noexcept
+{
+  const unsigned char* __p = static_cast<const unsigned char*>(__key);
+  __seed ^= _CUDA_VSTD::__hash_mix(__seed ^ __hash_k0, __hash_k1);
+  uint64_t __a = 0;
+  uint64_t __b = 0;
+  if (__len <= 16)
+  {
+    if (__len >= 4)
+    {
+      const size_t __step = (__len >> 3) << 2;
+      // Two possibly overlapping reads from each end.
+      const uint64_t __a_low = _CUDA_VSTD::__loadword<uint32_t>(__p + __step);
+      const uint64_t __b_low = _CUDA_VSTD::__loadword<uint32_t>(__p + __len - 4 - __step);
+      __a                    = (uint64_t{_CUDA_VSTD::__loadword<uint32_t>(__p)} << 32) | __a_low;
+      __b                    = (uint64_t{_CUDA_VSTD::__loadword<uint32_t>(__p + __len - 4)} << 32) | __b_low;
+    }
+    else if (__len > 0)
+    {
+      __a = (static_cast<uint64_t>(__p[0]) << 16) | (static_cast<uint64_t>(__p[__len >> 1]) << 8) | __p[__len - 1];
+    }
+  }
+  else
+  {
+    __seed = _CUDA_VSTD::__hash_bytes_long(__p, __len, __seed, __a, __b);
+  }
+  __a ^= __hash_k1;
+  __b ^= __seed;
+  _CUDA_VSTD::__hash_mum(__a, __b);
+  return _CUDA_VSTD::__hash_mix(__a ^ __hash_k0 ^ __len, __b ^ __hash_k1);
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX___FUNCTIONAL_HASH_BYTES_H
@@ -135,6 +135,29 @@ _LIBCUDACXX_HIDE_FROM_ABI void __cccl_thread_sleep_for(_CUDA_VSTD::chrono::nanos
     ;
 }
 
+// Platform wait
+#  if defined(__linux__)
+#    define _LIBCUDACXX_HAS_PLATFORM_WAIT
+
+using __cccl_platform_wait_t = int;
+
+// Blocks while the word at __addr holds __val, until it's woken up by __cccl_platform_wake, or the timeout expires.
+// May return spuriously.
+_LIBCUDACXX_HIDE_FROM_ABI void __cccl_platform_wait(__cccl_platform_wait_t const volatile* __addr,
+                                                    __cccl_platform_wait_t __val,
+                                                    _CUDA_VSTD::chrono::nanoseconds __timeout)
+{
+  const auto __ts = __cccl_to_timespec(__timeout);
+  syscall(SYS_futex, __addr, FUTEX_WAIT_PRIVATE, __val, &__ts, nullptr, 0);
+}
+
+// Wakes up one, or all, of the threads blocked in __cccl_platform_wait on __addr.
+_LIBCUDACXX_HIDE_FROM_ABI void __cccl_platform_wake(__cccl_platform_wait_t const volatile* __addr, bool __all)
+{
+  syscall(SYS_futex, __addr, FUTEX_WAKE_PRIVATE, __all ? INT_MAX : 1, nullptr, nullptr, 0);
+}
+#  endif // __linux__
+
 _LIBCUDACXX_END_NAMESPACE_STD
 
 #  include <cuda/std/__cccl/epilogue.h>
@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+#include <cuda/barrier>
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <thread>
+#  include <vector>
+
+struct count_phases
+{
+  int* phases;
+
+  void operator()() noexcept
+  {
+    ++*phases;
+  }
+};
+
+template <cuda::thread_scope Sco>
+void test_arrive_and_wait(int thread_count)
+{
+  constexpr int iterations = 100;
+
+  int phases = 0;
+  cuda::tree_barrier<Sco, count_phases> b(thread_count, count_phases{&phases});
+  cuda::std::atomic<int> arrived(0);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back([&] {
+      for (int i = 0; i < iterations; ++i)
+      {
+        arrived.fetch_add(1, cuda::std::memory_order_relaxed);
+        b.arrive_and_wait();
+        // every thread arrived in this phase before any of them is released
+        assert(arrived.load(cuda::std::memory_order_relaxed) >= (i + 1) * thread_count);
+        assert(phases == 2 * i + 1);
+        b.arrive_and_wait();
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  assert(phases == 2 * iterations);
+}
+
+template <cuda::thread_scope Sco>
+void test_arrive_update()
+{
+  // a single thread arrives for all the expected arrivals of a phase at once, spanning several leaves
+  cuda::tree_barrier<Sco> b(11);
+  for (int i = 0; i < 3; ++i)
+  {
+    auto token = b.arrive(11);
+    b.wait(std::move(token));
+  }
+
+  auto token = b.arrive(5);
+  std::thread other([&] {
+    (void) b.arrive(6);
+  });
+  b.wait(std::move(token));
+  other.join();
+}
+
+template <cuda::thread_scope Sco>
+void test_arrive_and_drop(int thread_count)
+{
+  cuda::tree_barrier<Sco> b(thread_count);
+
+  // thread t takes part in the first t + 1 phases
+  std::vector<std::thread> threads;
+  for (int t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < t; ++i)
+      {
+        b.arrive_and_wait();
+      }
+      b.arrive_and_drop();
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+template <cuda::thread_scope Sco>
+void test()
+{
+  for (int thread_count : {1, 2, 3, 4, 5, 8, 17, 33})
+  {
+    test_arrive_and_wait<Sco>(thread_count);
+    test_arrive_and_drop<Sco>(thread_count);
+  }
+  test_arrive_update<Sco>();
+
+  static_assert(cuda::tree_barrier<Sco>::max() > 0, "");
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test<cuda::thread_scope_system>(); test<cuda::thread_scope_device>();
+                test<cuda::thread_scope_block>();))
+
+  return 0;
+}
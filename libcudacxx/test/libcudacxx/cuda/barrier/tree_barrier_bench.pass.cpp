@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// REQUIRES: benchmarks
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// Compares the latency of arrive_and_wait on cuda::std::barrier and cuda::tree_barrier, for thread counts up to the
+// number of hardware threads.
+
+#include <cuda/barrier>
+#include <cuda/std/barrier>
+
+#include "host_benchmark.h"
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <cstdio>
+#  include <thread>
+#  include <vector>
+
+template <class Barrier>
+double arrive_and_wait_latency(unsigned thread_count, int iterations)
+{
+  Barrier b(thread_count);
+
+  std::vector<std::thread> threads;
+  const stopwatch watch;
+  for (unsigned t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back([&] {
+      for (int i = 0; i < iterations; ++i)
+      {
+        b.arrive_and_wait();
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  return watch.seconds() * 1e9 / iterations;
+}
+
+void bench()
+{
+  constexpr int iterations = 1000;
+
+  const unsigned max_threads = std::thread::hardware_concurrency() > 2 ? std::thread::hardware_concurrency() : 2;
+
+  std::printf("%8s %24s %24s\n", "threads", "cuda::std::barrier (ns)", "cuda::tree_barrier (ns)");
+  for (unsigned thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+  {
+    const double flat = arrive_and_wait_latency<cuda::std::barrier<>>(thread_count, iterations);
+    const double tree =
+      arrive_and_wait_latency<cuda::tree_barrier<cuda::thread_scope_system>>(thread_count, iterations);
+    std::printf("%8u %24.0f %24.0f\n", thread_count, flat, tree);
+  }
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench();))
+
+  return 0;
+}
@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/functional>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+static_assert(cuda::std::is_same<decltype(cuda::hash_bytes(nullptr, 0)), cuda::std::uint64_t>::value, "");
+static_assert(noexcept(cuda::hash_bytes(nullptr, 0, 0)), "");
+
+struct Expected
+{
+  cuda::std::size_t len;
+  cuda::std::uint64_t unseeded;
+  cuda::std::uint64_t seeded;
+};
+
+__host__ __device__ void test()
+{
+  unsigned char buff[129]{};
+  for (int i = 0; i < 128; ++i)
+  {
+    buff[i] = static_cast<unsigned char>(i * 7 + 3);
+  }
+
+  // Covers the short inputs, the 16 byte steps and the 48 byte steps.
+  const Expected expected[] = {
+    {0, 0x93228a4de0eec5a2ull, 0x2ac44db3deb05300ull},
+    {3, 0x9d6f309864716719ull, 0x46a41dbbd242df1dull},
+    {8, 0xb8b8b0101a774b8bull, 0x06c926744a72969eull},
+    {16, 0x43271ea04489ebc4ull, 0x29906ada33c2a4d4ull},
+    {17, 0xa55c3367b6b9a71cull, 0xc268e644266e012dull},
+    {48, 0x222b83ab258c1121ull, 0x01d62ca9f8c6fd2eull},
+    {49, 0x5e3a1f603be7896aull, 0x49cf407aaaa92274ull},
+    {100, 0x798994485b60baf4ull, 0x52a6310a2cfeb228ull},
+  };
+  for (const auto& e : expected)
+  {
+    assert(cuda::hash_bytes(buff, e.len) == e.unseeded);
+    assert(cuda::hash_bytes(buff, e.len, 42) == e.seeded);
+  }
+
+  // The hash doesn't depend on the alignment of the input.
+  unsigned char shifted[129]{};
+  for (int i = 0; i < 128; ++i)
+  {
+    shifted[i + 1] = buff[i];
+  }
+  for (cuda::std::size_t len = 0; len <= 128; ++len)
+  {
+    assert(cuda::hash_bytes(shifted + 1, len) == cuda::hash_bytes(buff, len));
+  }
+
+  // Flipping any bit changes the hash.
+  const cuda::std::size_t lengths[] = {1, 3, 4, 15, 16, 17, 47, 48, 49, 97};
+  for (cuda::std::size_t len : lengths)
+  {
+    const cuda::std::uint64_t h = cuda::hash_bytes(buff, len);
+    for (cuda::std::size_t bit = 0; bit < 8 * len; ++bit)
+    {
+      buff[bit / 8] ^= static_cast<unsigned char>(1 << (bit % 8));
+      assert(cuda::hash_bytes(buff, len) != h);
+      buff[bit / 8] ^= static_cast<unsigned char>(1 << (bit % 8));
+    }
+  }
+}
+
+int main(int, char**)
+{
+  test();
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// REQUIRES: benchmarks
+
+// Compares the throughput of cuda::hash_bytes with the one of __murmur2_or_cityhash, on single integers and on byte
+// ranges of various lengths.
+
+#include <cuda/functional>
+#include <cuda/std/__functional/hash_bytes.h>
+
+#include "host_benchmark.h"
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <cstdint>
+#  include <cstdio>
+#  include <random>
+#  include <vector>
+
+template <class Fn>
+double million_per_second(std::size_t count, int iterations, Fn fn)
+{
+  std::uint64_t checksum = 0;
+  const stopwatch watch;
+  for (int i = 0; i < iterations; ++i)
+  {
+    for (std::size_t j = 0; j < count; ++j)
+    {
+      checksum += fn(j);
+    }
+  }
+  const double seconds = watch.seconds();
+  DoNotOptimize(checksum);
+  return static_cast<double>(count) * iterations / seconds / 1e6;
+}
+
+void bench_integers()
+{
+  constexpr std::size_t count = 1 << 16;
+  std::mt19937_64 gen(42);
+  std::vector<std::uint64_t> values(count);
+  for (auto& value : values)
+  {
+    value = gen();
+  }
+
+  const double ours = million_per_second(count, 200, [&](std::size_t j) {
+    return cuda::hash_bytes(&values[j], sizeof(std::uint64_t));
+  });
+  const double city = million_per_second(count, 200, [&](std::size_t j) {
+    return cuda::std::__murmur2_or_cityhash<std::size_t>()(&values[j], sizeof(std::uint64_t));
+  });
+  std::printf("%-24s %12.1f M/s %12.1f M/s\n", "uint64_t", ours, city);
+}
+
+void bench_bytes(std::size_t len)
+{
+  // The ranges start at every offset of a buffer, which makes most of them unaligned.
+  const std::size_t count = len <= 64 ? 1 << 16 : (1 << 22) / len;
+  std::mt19937_64 gen(42);
+  std::vector<unsigned char> buff(count + len);
+  for (auto& c : buff)
+  {
+    c = static_cast<unsigned char>(gen());
+  }
+
+  const int iterations = 20;
+  const double ours    = million_per_second(count, iterations, [&](std::size_t j) {
+    return cuda::hash_bytes(buff.data() + j, len);
+  });
+  const double city    = million_per_second(count, iterations, [&](std::size_t j) {
+    return cuda::std::__murmur2_or_cityhash<std::size_t>()(buff.data() + j, len);
+  });
+  std::printf("%-5zu bytes %18.1f MB/s %11.1f MB/s\n", len, ours * len, city * len);
+}
+
+void bench()
+{
+  std::printf("%-24s %16s %16s\n", "input", "hash_bytes", "cityhash");
+
+  bench_integers();
+  for (std::size_t len : {4, 8, 16, 24, 32, 64, 256, 1024, 65536})
+  {
+    bench_bytes(len);
+  }
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench();))
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// Atomics which aren't lock-free, hammered by several host threads. Without a CUDA compiler, they use the striped lock
+// table, and the 16 byte compare and swap where the platform has one; with a CUDA compiler, the embedded locks.
+
+#if !defined(__CUDACC__) && !defined(_NVHPC_CUDA)
+#  define LIBCUDACXX_ENABLE_STRIPED_ATOMIC_LOCKS
+#endif // !__CUDACC__ && !_NVHPC_CUDA
+
+#include <cuda/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <thread>
+#  include <vector>
+
+// A counter spread over the first bytes, and their complement in the others, so that a torn value is detected.
+template <cuda::std::size_t N, cuda::std::size_t Align = 1>
+struct alignas(Align) counter
+{
+  unsigned char bytes[N];
+
+  counter() = default;
+  explicit counter(cuda::std::uint64_t value)
+  {
+    for (cuda::std::size_t i = 0; i < N; ++i)
+    {
+      bytes[i] =
+        i < counted ? static_cast<unsigned char>(value >> (8 * i)) : static_cast<unsigned char>(~bytes[i - counted]);
+    }
+  }
+
+  static constexpr cuda::std::size_t counted = N < 8 ? N / 2 + 1 : 4;
+
+  cuda::std::uint64_t value() const
+  {
+    cuda::std::uint64_t value = 0;
+    for (cuda::std::size_t i = 0; i < counted; ++i)
+    {
+      value |= cuda::std::uint64_t(bytes[i]) << (8 * i);
+    }
+    return value;
+  }
+
+  bool consistent() const
+  {
+    for (cuda::std::size_t i = counted; i < N; ++i)
+    {
+      if (bytes[i] != static_cast<unsigned char>(~bytes[i - counted]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  friend bool operator==(const counter& lhs, const counter& rhs)
+  {
+    for (cuda::std::size_t i = 0; i < N; ++i)
+    {
+      if (lhs.bytes[i] != rhs.bytes[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+constexpr int threads    = 4;
+constexpr int increments = 20000;
+// Neighboring atomics, which take their locks from the same table.
+constexpr int neighbors = 8;
+
+template <class T, cuda::thread_scope Sco>
+void test_counter()
+{
+#  if defined(_LIBCUDACXX_ATOMIC_STRIPED_LOCKS)
+  static_assert(sizeof(cuda::atomic<T, Sco>) == sizeof(T), "");
+#  endif // _LIBCUDACXX_ATOMIC_STRIPED_LOCKS
+
+  static cuda::atomic<T, Sco> atomics[neighbors];
+  for (auto& a : atomics)
+  {
+    a.store(T(0));
+  }
+
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; ++t)
+  {
+    pool.emplace_back([t] {
+      for (int i = 0; i < increments; ++i)
+      {
+        auto& a    = atomics[(i + t) % neighbors];
+        T expected = a.load();
+        assert(expected.consistent());
+        // Half of the threads use the strong compare and swap, the other half the weak one.
+        while (t % 2 == 0 ? !a.compare_exchange_strong(expected, T(expected.value() + 1))
+                          : !a.compare_exchange_weak(expected, T(expected.value() + 1)))
+        {
+          assert(expected.consistent());
+        }
+      }
+    });
+  }
+  // Reads the atomics while they're updated.
+  pool.emplace_back([] {
+    for (int i = 0; i < increments; ++i)
+    {
+      assert(atomics[i % neighbors].load().consistent());
+    }
+  });
+  for (auto& thread : pool)
+  {
+    thread.join();
+  }
+
+  cuda::std::uint64_t total = 0;
+  for (auto& a : atomics)
+  {
+    const T value = a.load();
+    assert(value.consistent());
+    total += value.value();
+  }
+  assert(total == cuda::std::uint64_t(threads) * increments);
+}
+
+template <cuda::thread_scope Sco>
+void test()
+{
+  test_counter<counter<5>, Sco>();
+  test_counter<counter<12>, Sco>();
+  test_counter<counter<12, 4>, Sco>();
+  test_counter<counter<16>, Sco>();
+  test_counter<counter<16, 8>, Sco>();
+  test_counter<counter<24, 8>, Sco>();
+}
+
+void test_all()
+{
+  test<cuda::thread_scope_system>();
+  test<cuda::thread_scope_device>();
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test_all();))
+
+  return 0;
+}
@@ -0,0 +1,215 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// Host threads blocking in wait and woken up by notify_one and notify_all, on atomics which are waited on directly and
+// on atomics which are waited on through the shared contention states.
+
+#include <cuda/atomic>
+#include <cuda/std/cassert>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <chrono>
+#  include <thread>
+#  include <vector>
+
+// Larger than the largest lock-free atomics of most platforms, and waited on through a contention state.
+struct big
+{
+  long long x;
+  long long y;
+
+  big() = default;
+  big(int v)
+      : x(v)
+      , y(-v)
+  {}
+
+  friend bool operator==(const big& lhs, const big& rhs)
+  {
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+  }
+  friend bool operator!=(const big& lhs, const big& rhs)
+  {
+    return !(lhs == rhs);
+  }
+};
+
+constexpr int rounds = 500;
+
+// Every few rounds, the other thread is given the time to stop polling and block in the kernel.
+void pause(int round)
+{
+  if (round % 10 == 0)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+// Waits until a holds expected.
+template <class A, class T>
+void wait_for(const A& a, T expected)
+{
+  T current = a.load();
+  while (current != expected)
+  {
+    a.wait(current);
+    current = a.load();
+  }
+}
+
+// Two threads take turns to increment a, each waiting for the other's increment.
+template <class A, class T>
+void ping_pong(A& a)
+{
+  std::thread odd([&] {
+    for (int i = 0; i < rounds; ++i)
+    {
+      wait_for(a, T(2 * i + 1));
+      pause(i);
+      a.store(T(2 * i + 2));
+      a.notify_one();
+    }
+  });
+  for (int i = 0; i < rounds; ++i)
+  {
+    wait_for(a, T(2 * i));
+    pause(i + 5);
+    a.store(T(2 * i + 1));
+    a.notify_one();
+  }
+  odd.join();
+  assert(a.load() == T(2 * rounds));
+}
+
+template <class T, cuda::thread_scope Sco>
+void test_ping_pong()
+{
+  cuda::atomic<T, Sco> a(T(0));
+  ping_pong<cuda::atomic<T, Sco>, T>(a);
+
+  if constexpr (sizeof(T) <= sizeof(long long))
+  {
+    T storage(0);
+    cuda::atomic_ref<T, Sco> ref(storage);
+    ping_pong<cuda::atomic_ref<T, Sco>, T>(ref);
+  }
+}
+
+// Pairs of threads play at the same time on atomics which share a contention state, so that notifications wake up
+// threads which wait on another atomic.
+template <class T, cuda::thread_scope Sco>
+void test_shared_states()
+{
+  constexpr int pairs = 4;
+  constexpr int count = 4096;
+
+  static cuda::atomic<T, Sco> atomics[count];
+  std::vector<cuda::atomic<T, Sco>*> colliding;
+  for (auto& a : atomics)
+  {
+#  if defined(_LIBCUDACXX_HAS_PLATFORM_WAIT)
+    if (cuda::std::__atomic_contention_state_of(&a) != cuda::std::__atomic_contention_state_of(&atomics[0]))
+    {
+      continue;
+    }
+#  endif // _LIBCUDACXX_HAS_PLATFORM_WAIT
+    colliding.push_back(&a);
+    if (colliding.size() == pairs)
+    {
+      break;
+    }
+  }
+  assert(colliding.size() == pairs);
+
+  std::vector<std::thread> threads;
+  for (auto* a : colliding)
+  {
+    threads.emplace_back([a] {
+      ping_pong<cuda::atomic<T, Sco>, T>(*a);
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+// notify_all wakes up every waiter.
+template <class T, cuda::thread_scope Sco>
+void test_notify_all()
+{
+  constexpr int waiters = 8;
+
+  cuda::atomic<T, Sco> a(T(0));
+  cuda::atomic<int, Sco> ready(0);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < waiters; ++t)
+  {
+    threads.emplace_back([&] {
+      ready.fetch_add(1);
+      a.wait(T(0));
+      assert(a.load() == T(1));
+    });
+  }
+  while (ready.load() != waiters)
+  {
+    std::this_thread::yield();
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  a.store(T(1));
+  a.notify_all();
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+template <class T, cuda::thread_scope Sco>
+void test_type()
+{
+  test_ping_pong<T, Sco>();
+  test_notify_all<T, Sco>();
+}
+
+template <cuda::thread_scope Sco>
+void test()
+{
+  test_type<char, Sco>();
+  test_type<short, Sco>();
+  test_type<int, Sco>();
+  test_type<long long, Sco>();
+  test_type<big, Sco>();
+  test_shared_states<int, Sco>();
+  test_shared_states<long long, Sco>();
+}
+
+void test_all()
+{
+  const auto start = std::chrono::steady_clock::now();
+  test<cuda::thread_scope_system>();
+  test<cuda::thread_scope_device>();
+  // A lost notification leaves the waiter blocked until the timeout of its wait, 2 seconds outside of the system
+  // scope, so a notify which wakes nobody would take hours here.
+  assert(std::chrono::steady_clock::now() - start < std::chrono::seconds(60));
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test_all();))
+
+  return 0;
+}
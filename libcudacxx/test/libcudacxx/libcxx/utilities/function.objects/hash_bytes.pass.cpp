@@ -0,0 +1,32 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/__functional/hash_bytes.h>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+
+#include "test_macros.h"
+
+__host__ __device__ void test_murmur2_or_cityhash()
+{
+  const char buff[] = "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz0123456789";
+  cuda::std::__murmur2_or_cityhash<cuda::std::size_t> hasher;
+  for (cuda::std::size_t len = 0; len < sizeof(buff); ++len)
+  {
+    assert(hasher(buff, len) != hasher(buff + 1, len) || len == 0);
+  }
+}
+
+int main(int, char**)
+{
+  test_murmur2_or_cityhash();
+
+  return 0;
+}
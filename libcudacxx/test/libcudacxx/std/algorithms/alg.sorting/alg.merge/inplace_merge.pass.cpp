@@ -0,0 +1,118 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<BidirectionalIterator Iter>
+//   requires ShuffleIterator<Iter>
+//         && LessThanComparable<Iter::value_type>
+//   constexpr void  // constexpr in C++26
+//   inplace_merge(Iter first, Iter middle, Iter last);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "../sortable_helpers.h"
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+constexpr int N = 300;
+
+// The sortable types only compare the tens, so each of the 30 keys is given to 10 elements whose units count their
+// occurrences. The first m occurrences of each key go to the first range, and the others to the second one, so that
+// the values are in order once merged stably.
+template <class T, class Iter>
+__host__ __device__ constexpr void test_one(int m)
+{
+  T large[N] = {};
+  int first  = 0;
+  int second = m * (N / 10);
+  for (int key = 0; key < N / 10; ++key)
+  {
+    for (int occurrence = 0; occurrence < 10; ++occurrence)
+    {
+      large[occurrence < m ? first++ : second++] = T(key * 10 + occurrence);
+    }
+  }
+  cuda::std::inplace_merge(Iter(large), Iter(large + m * (N / 10)), Iter(large + N));
+  for (int i = 0; i < N; ++i)
+  {
+    assert(large[i].value == i);
+  }
+}
+
+template <class T, class Iter>
+__host__ __device__ constexpr void test()
+{
+  {
+    T work[] = {1, 3, 5, 7, 9, 0, 2, 4, 6, 8};
+    for (int m = 0; m <= 10; ++m)
+    {
+      int orig[10] = {1, 3, 5, 7, 9, 0, 2, 4, 6, 8};
+      cuda::std::sort(work, work + m);
+      cuda::std::sort(work + m, work + 10);
+      cuda::std::inplace_merge(Iter(work), Iter(work + m), Iter(work + 10));
+      assert(cuda::std::is_sorted(work, work + 10));
+      assert(cuda::std::is_permutation(work, work + 10, orig));
+      for (int i = 0; i < 10; ++i)
+      {
+        work[i] = T(orig[i]);
+      }
+    }
+  }
+  {
+    T work[N] = {};
+    for (int i = 0; i < N; ++i)
+    {
+      work[i] = T(i % (N / 3) * 3 + i / (N / 3));
+    }
+    // [0, 3, 6, ..., 1, 4, 7, ..., 2, 5, 8, ...]
+    cuda::std::inplace_merge(Iter(work), Iter(work + N / 3), Iter(work + 2 * N / 3));
+    cuda::std::inplace_merge(Iter(work), Iter(work + 2 * N / 3), Iter(work + N));
+    for (int i = 0; i < N; ++i)
+    {
+      assert(work[i] == T(i));
+    }
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  int i = 42;
+  cuda::std::inplace_merge(&i, &i, &i); // no-op
+  assert(i == 42);
+
+  test<int, bidirectional_iterator<int*>>();
+  test<int, random_access_iterator<int*>>();
+  test<int, int*>();
+
+  test<MoveOnly, bidirectional_iterator<MoveOnly*>>();
+  test<MoveOnly, MoveOnly*>();
+
+  for (int m = 0; m <= 10; ++m)
+  {
+    test_one<TrivialSortable, bidirectional_iterator<TrivialSortable*>>(m);
+    test_one<TrivialSortable, TrivialSortable*>(m);
+    test_one<NonTrivialSortable, NonTrivialSortable*>(m);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<BidirectionalIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter>
+//         && CopyConstructible<Compare>
+//   constexpr void  // constexpr in C++26
+//   inplace_merge(Iter first, Iter middle, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "../sortable_helpers.h"
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+constexpr int N = 300;
+
+struct CompareTens
+{
+  __host__ __device__ constexpr bool operator()(int a, int b) const
+  {
+    return a / 10 < b / 10;
+  }
+};
+
+template <class T>
+__host__ __device__ constexpr int value_of(const T& t)
+{
+  return t.value;
+}
+
+__host__ __device__ constexpr int value_of(int t)
+{
+  return t;
+}
+
+// The comparators only compare the tens, so each of the 30 keys is given to 10 elements whose units count their
+// occurrences. The first m occurrences of each key go to the first range, and the others to the second one, so that
+// the values are in order once merged stably.
+template <class T, class Iter, class Compare>
+__host__ __device__ constexpr void test_one(int m, Compare comp)
+{
+  T large[N] = {};
+  int first  = 0;
+  int second = m * (N / 10);
+  for (int key = 0; key < N / 10; ++key)
+  {
+    for (int occurrence = 0; occurrence < 10; ++occurrence)
+    {
+      large[occurrence < m ? first++ : second++] = T(key * 10 + occurrence);
+    }
+  }
+  cuda::std::inplace_merge(Iter(large), Iter(large + m * (N / 10)), Iter(large + N), comp);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(value_of(large[i]) == i);
+  }
+}
+
+template <class T, class Iter>
+__host__ __device__ constexpr void test()
+{
+  {
+    T work[] = {1, 3, 5, 7, 9, 0, 2, 4, 6, 8};
+    for (int m = 0; m <= 10; ++m)
+    {
+      int orig[10] = {1, 3, 5, 7, 9, 0, 2, 4, 6, 8};
+      cuda::std::sort(work, work + m, cuda::std::greater<T>());
+      cuda::std::sort(work + m, work + 10, cuda::std::greater<T>());
+      cuda::std::inplace_merge(Iter(work), Iter(work + m), Iter(work + 10), cuda::std::greater<T>());
+      assert(cuda::std::is_sorted(work, work + 10, cuda::std::greater<T>()));
+      assert(cuda::std::is_permutation(work, work + 10, orig));
+      for (int i = 0; i < 10; ++i)
+      {
+        work[i] = T(orig[i]);
+      }
+    }
+  }
+  {
+    T work[N] = {};
+    for (int i = 0; i < N; ++i)
+    {
+      work[i] = T(N - 1 - (i % (N / 3) * 3 + i / (N / 3)));
+    }
+    cuda::std::inplace_merge(Iter(work), Iter(work + N / 3), Iter(work + 2 * N / 3), cuda::std::greater<T>());
+    cuda::std::inplace_merge(Iter(work), Iter(work + 2 * N / 3), Iter(work + N), cuda::std::greater<T>());
+    for (int i = 0; i < N; ++i)
+    {
+      assert(work[i] == T(N - 1 - i));
+    }
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  int i = 42;
+  cuda::std::inplace_merge(&i, &i, &i, cuda::std::greater<int>()); // no-op
+  assert(i == 42);
+
+  test<int, bidirectional_iterator<int*>>();
+  test<int, random_access_iterator<int*>>();
+  test<int, int*>();
+
+  test<MoveOnly, bidirectional_iterator<MoveOnly*>>();
+  test<MoveOnly, MoveOnly*>();
+
+  for (int m = 0; m <= 10; ++m)
+  {
+    test_one<int, bidirectional_iterator<int*>>(m, CompareTens());
+    test_one<int, int*>(m, CompareTens());
+    test_one<TrivialSortableWithComp, TrivialSortableWithComp*>(m, TrivialSortableWithComp::Comparator());
+    test_one<NonTrivialSortableWithComp, NonTrivialSortableWithComp*>(m, NonTrivialSortableWithComp::Comparator());
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter>
+//   requires ShuffleIterator<Iter> && LessThanComparable<Iter::value_type>
+//   constexpr void  // constexpr in C++20
+//   nth_element(Iter first, Iter nth, Iter last);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+constexpr int N = 300;
+
+// Inputs which are long enough to be partitioned, with the patterns the partitioning has to cope with.
+__host__ __device__ constexpr int input(int pattern, int i)
+{
+  switch (pattern)
+  {
+    case 0:
+      return (i * 7 + 13) % N;
+    case 1:
+      return i;
+    case 2:
+      return N - 1 - i;
+    case 3:
+      return i % 3;
+    default:
+      return 42;
+  }
+}
+
+__host__ __device__ constexpr int sorted(int pattern, int i)
+{
+  switch (pattern)
+  {
+    case 3:
+      return i / (N / 3);
+    case 4:
+      return 42;
+    default:
+      return i;
+  }
+}
+
+template <class T, class Iter>
+__host__ __device__ constexpr void test()
+{
+  int orig[15]     = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  int expected[15] = {1, 1, 2, 3, 3, 4, 5, 5, 5, 6, 7, 8, 9, 9, 9};
+  T work[15]       = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  for (int m = 0; m <= 15; ++m)
+  {
+    cuda::std::nth_element(Iter(work), Iter(work + m), Iter(work + 15));
+    assert(cuda::std::is_permutation(work, work + 15, orig));
+    if (m < 15)
+    {
+      assert(work[m] == T(expected[m]));
+      for (int i = 0; i < 15; ++i)
+      {
+        assert(i < m ? !(work[m] < work[i]) : !(work[i] < work[m]));
+      }
+    }
+    cuda::std::copy(orig, orig + 15, work);
+  }
+
+  for (int pattern = 0; pattern < 5; ++pattern)
+  {
+    for (int m : {0, N / 3, N / 2, N - 1})
+    {
+      T large[N] = {};
+      for (int i = 0; i < N; ++i)
+      {
+        large[i] = T(input(pattern, i));
+      }
+      cuda::std::nth_element(Iter(large), Iter(large + m), Iter(large + N));
+      assert(large[m] == T(sorted(pattern, m)));
+      for (int i = 0; i < N; ++i)
+      {
+        assert(i < m ? !(large[m] < large[i]) : !(large[i] < large[m]));
+      }
+    }
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  int i = 42;
+  cuda::std::nth_element(&i, &i, &i); // no-op
+  assert(i == 42);
+
+  test<int, random_access_iterator<int*>>();
+  test<int, int*>();
+
+  test<MoveOnly, random_access_iterator<MoveOnly*>>();
+  test<MoveOnly, MoveOnly*>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
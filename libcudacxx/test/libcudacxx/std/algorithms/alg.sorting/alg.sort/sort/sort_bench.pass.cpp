@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// REQUIRES: benchmarks
+
+// Compares the time per element of sort, stable_sort and nth_element with the heap sort done by
+// partial_sort(first, last, last), on random and on sorted integers.
+
+#include <cuda/std/__algorithm_>
+
+#include "host_benchmark.h"
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <cstdio>
+#  include <random>
+#  include <vector>
+
+template <class Fn>
+double time_per_element(const std::vector<int>& input, int iterations, Fn fn)
+{
+  std::vector<int> work(input.size());
+  double seconds = 0;
+  for (int i = 0; i < iterations; ++i)
+  {
+    work = input;
+    const stopwatch watch;
+    fn(work.data(), work.data() + work.size());
+    DoNotOptimize(work.data());
+    seconds += watch.seconds();
+  }
+  return seconds * 1e9 / iterations / static_cast<double>(input.size());
+}
+
+void bench(const char* name, std::vector<int> (*make_input)(std::size_t))
+{
+  std::printf("%s\n%10s %14s %14s %14s %14s\n", name, "size", "partial_sort", "sort", "stable_sort", "nth_element");
+  for (std::size_t size = 1000; size <= 1000000; size *= 10)
+  {
+    const std::vector<int> input = make_input(size);
+    const int iterations         = static_cast<int>(10000000 / size);
+
+    const double heap = time_per_element(input, iterations, [](int* first, int* last) {
+      cuda::std::partial_sort(first, last, last);
+    });
+    const double sort = time_per_element(input, iterations, [](int* first, int* last) {
+      cuda::std::sort(first, last);
+    });
+    const double stable = time_per_element(input, iterations, [](int* first, int* last) {
+      cuda::std::stable_sort(first, last);
+    });
+    const double nth = time_per_element(input, iterations, [](int* first, int* last) {
+      cuda::std::nth_element(first, first + (last - first) / 2, last);
+    });
+    std::printf("%10zu %11.2f ns %11.2f ns %11.2f ns %11.2f ns\n", size, heap, sort, stable, nth);
+  }
+}
+
+std::vector<int> random_input(std::size_t size)
+{
+  std::mt19937 gen(42);
+  std::vector<int> input(size);
+  for (int& i : input)
+  {
+    i = static_cast<int>(gen());
+  }
+  return input;
+}
+
+std::vector<int> sorted_input(std::size_t size)
+{
+  std::vector<int> input(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    input[i] = static_cast<int>(i);
+  }
+  return input;
+}
+
+void bench()
+{
+  bench("random", random_input);
+  bench("sorted", sorted_input);
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench();))
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter>
+//         && CopyConstructible<Compare>
+//   constexpr void  // constexpr in C++20
+//   sort(Iter first, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+constexpr int N = 300;
+
+struct ReverseLess
+{
+  template <class T>
+  __host__ __device__ constexpr bool operator()(const T& a, const T& b) const
+  {
+    return b < a;
+  }
+};
+
+// Inputs which are long enough to be partitioned, with the patterns the partitioning has to cope with.
+__host__ __device__ constexpr int input(int pattern, int i)
+{
+  switch (pattern)
+  {
+    case 0:
+      return (i * 7 + 13) % N;
+    case 1:
+      return i;
+    case 2:
+      return N - 1 - i;
+    case 3:
+      return i % 3;
+    case 4:
+      return 42;
+    default:
+      return i < N / 2 ? i : N - 1 - i;
+  }
+}
+
+__host__ __device__ constexpr int sorted(int pattern, int i)
+{
+  switch (pattern)
+  {
+    case 3:
+      return i / (N / 3);
+    case 4:
+      return 42;
+    case 5:
+      return i / 2;
+    default:
+      return i;
+  }
+}
+
+template <class T, class Iter>
+__host__ __device__ constexpr void test()
+{
+  int orig[15] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  T work[15]   = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  for (int n = 0; n < 15; ++n)
+  {
+    cuda::std::sort(Iter(work), Iter(work + n), cuda::std::greater<T>());
+    assert(cuda::std::is_sorted(work, work + n, cuda::std::greater<T>()));
+    assert(cuda::std::is_permutation(work, work + n, orig));
+    cuda::std::copy(orig, orig + 15, work);
+  }
+
+  for (int pattern = 0; pattern < 6; ++pattern)
+  {
+    T large[N] = {};
+    for (int i = 0; i < N; ++i)
+    {
+      large[i] = T(input(pattern, i));
+    }
+    cuda::std::sort(Iter(large), Iter(large + N), cuda::std::greater<T>());
+    for (int i = 0; i < N; ++i)
+    {
+      assert(large[i] == T(sorted(pattern, N - 1 - i)));
+    }
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  int i = 42;
+  cuda::std::sort(&i, &i, cuda::std::greater<int>()); // no-op
+  assert(i == 42);
+
+  test<int, random_access_iterator<int*>>();
+  test<int, int*>();
+  test<long long, long long*>();
+
+  test<MoveOnly, random_access_iterator<MoveOnly*>>();
+  test<MoveOnly, MoveOnly*>();
+
+  {
+    int large[N] = {};
+    for (int j = 0; j < N; ++j)
+    {
+      large[j] = input(0, j);
+    }
+    cuda::std::sort(large, large + N, ReverseLess());
+    for (int j = 0; j < N; ++j)
+    {
+      assert(large[j] == N - 1 - j);
+    }
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
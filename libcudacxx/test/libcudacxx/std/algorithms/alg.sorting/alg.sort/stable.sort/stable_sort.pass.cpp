@@ -0,0 +1,133 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter>
+//   requires ShuffleIterator<Iter> && LessThanComparable<Iter::value_type>
+//   constexpr void  // constexpr in C++26
+//   stable_sort(Iter first, Iter last);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+
+#include "../../sortable_helpers.h"
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <vector>
+#endif // !__CUDA_ARCH__
+
+constexpr int N = 300;
+
+template <class T, class Iter>
+__host__ __device__ constexpr void test()
+{
+  int orig[15] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  T work[15]   = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  for (int n = 0; n < 15; ++n)
+  {
+    cuda::std::stable_sort(Iter(work), Iter(work + n));
+    assert(cuda::std::is_sorted(work, work + n));
+    assert(cuda::std::is_permutation(work, work + n, orig));
+    cuda::std::copy(orig, orig + 15, work);
+  }
+
+  {
+    T large[N] = {};
+    for (int i = 0; i < N; ++i)
+    {
+      large[i] = T((i * 7 + 13) % N);
+    }
+    cuda::std::stable_sort(Iter(large), Iter(large + N));
+    for (int i = 0; i < N; ++i)
+    {
+      assert(large[i] == T(i));
+    }
+  }
+}
+
+// The sortable types only compare the tens, so each of the 30 keys is given to 10 elements whose units count their
+// occurrences. Once sorted stably, the values are in order.
+template <class T, class Iter>
+__host__ __device__ constexpr void test_stability()
+{
+  T large[N] = {};
+  for (int i = 0; i < N; ++i)
+  {
+    large[i] = T((i * 7 + 13) % (N / 10) * 10 + i / (N / 10));
+  }
+  cuda::std::stable_sort(Iter(large), Iter(large + N));
+  for (int i = 0; i < N; ++i)
+  {
+    assert(large[i].value == i);
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  int i = 42;
+  cuda::std::stable_sort(&i, &i); // no-op
+  assert(i == 42);
+
+  test<int, random_access_iterator<int*>>();
+  test<int, int*>();
+
+  test<MoveOnly, random_access_iterator<MoveOnly*>>();
+  test<MoveOnly, MoveOnly*>();
+
+  test_stability<TrivialSortable, random_access_iterator<TrivialSortable*>>();
+  test_stability<TrivialSortable, TrivialSortable*>();
+  test_stability<NonTrivialSortable, NonTrivialSortable*>();
+
+  return true;
+}
+
+#ifndef __CUDA_ARCH__
+// Random inputs too large for the stack, which go through every step of the algorithm.
+void test_large()
+{
+  constexpr int n     = 1 << 18;
+  constexpr int range = 1000;
+  std::vector<int> work(n);
+  int counts[range]        = {};
+  unsigned long long state = 42;
+  for (int& i : work)
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    i     = static_cast<int>((state >> 33) % range);
+    ++counts[i];
+  }
+  cuda::std::stable_sort(work.data(), work.data() + n);
+  assert(cuda::std::is_sorted(work.data(), work.data() + n));
+  for (int i : work)
+  {
+    --counts[i];
+  }
+  for (int count : counts)
+  {
+    assert(count == 0);
+  }
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  test();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  NV_IF_TARGET(NV_IS_HOST, (test_large();))
+
+  return 0;
+}
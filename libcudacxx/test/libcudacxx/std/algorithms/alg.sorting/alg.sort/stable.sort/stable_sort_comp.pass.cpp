@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <algorithm>
+
+// template<RandomAccessIterator Iter, StrictWeakOrder<auto, Iter::value_type> Compare>
+//   requires ShuffleIterator<Iter>
+//         && CopyConstructible<Compare>
+//   constexpr void  // constexpr in C++26
+//   stable_sort(Iter first, Iter last, Compare comp);
+
+#include <cuda/std/__algorithm_>
+#include <cuda/std/cassert>
+#include <cuda/std/functional>
+
+#include "../../sortable_helpers.h"
+#include "MoveOnly.h"
+#include "test_iterators.h"
+#include "test_macros.h"
+
+constexpr int N = 300;
+
+struct CompareTens
+{
+  __host__ __device__ constexpr bool operator()(int a, int b) const
+  {
+    return a / 10 < b / 10;
+  }
+};
+
+template <class T>
+__host__ __device__ constexpr int value_of(const T& t)
+{
+  return t.value;
+}
+
+__host__ __device__ constexpr int value_of(int t)
+{
+  return t;
+}
+
+template <class T, class Iter>
+__host__ __device__ constexpr void test()
+{
+  int orig[15] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  T work[15]   = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9};
+  for (int n = 0; n < 15; ++n)
+  {
+    cuda::std::stable_sort(Iter(work), Iter(work + n), cuda::std::greater<T>());
+    assert(cuda::std::is_sorted(work, work + n, cuda::std::greater<T>()));
+    assert(cuda::std::is_permutation(work, work + n, orig));
+    cuda::std::copy(orig, orig + 15, work);
+  }
+
+  {
+    T large[N] = {};
+    for (int i = 0; i < N; ++i)
+    {
+      large[i] = T((i * 7 + 13) % N);
+    }
+    cuda::std::stable_sort(Iter(large), Iter(large + N), cuda::std::greater<T>());
+    for (int i = 0; i < N; ++i)
+    {
+      assert(large[i] == T(N - 1 - i));
+    }
+  }
+}
+
+// The comparators only compare the tens, so each of the 30 keys is given to 10 elements whose units count their
+// occurrences. Once sorted stably, the values are in order.
+template <class T, class Iter, class Compare>
+__host__ __device__ constexpr void test_stability(Compare comp)
+{
+  T large[N] = {};
+  for (int i = 0; i < N; ++i)
+  {
+    large[i] = T((i * 7 + 13) % (N / 10) * 10 + i / (N / 10));
+  }
+  cuda::std::stable_sort(Iter(large), Iter(large + N), comp);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(value_of(large[i]) == i);
+  }
+}
+
+__host__ __device__ constexpr bool test()
+{
+  int i = 42;
+  cuda::std::stable_sort(&i, &i, cuda::std::greater<int>()); // no-op
+  assert(i == 42);
+
+  test<int, random_access_iterator<int*>>();
+  test<int, int*>();
+
+  test<MoveOnly, random_access_iterator<MoveOnly*>>();
+  test<MoveOnly, MoveOnly*>();
+
+  test_stability<int, random_access_iterator<int*>>(CompareTens());
+  test_stability<int, int*>(CompareTens());
+  test_stability<TrivialSortableWithComp, TrivialSortableWithComp*>(TrivialSortableWithComp::Comparator());
+  test_stability<NonTrivialSortableWithComp, NonTrivialSortableWithComp*>(NonTrivialSortableWithComp::Comparator());
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if defined(_CCCL_BUILTIN_IS_CONSTANT_EVALUATED)
+  static_assert(test(), "");
+#endif // _CCCL_BUILTIN_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
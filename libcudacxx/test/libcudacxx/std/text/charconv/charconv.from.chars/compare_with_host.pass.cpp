@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// from_chars gives the same results as the one of the host standard library, on random integers and on random
+// floating point values printed with all their digits, with a few of them, or with more than needed.
+
+#include <cuda/std/__charconv_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstring>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <charconv>
+#  include <cstdio>
+#  include <random>
+#  include <string>
+
+#  if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+
+constexpr int count = 20000;
+
+template <class T>
+void compare(const std::string& str)
+{
+  const char* first = str.data();
+  const char* last  = str.data() + str.size();
+
+  T ours{};
+  T host{};
+  const auto ours_result = cuda::std::from_chars(first, last, ours);
+  const auto host_result = std::from_chars(first, last, host);
+  assert(ours_result.ec == cuda::std::errc{});
+  assert(ours_result.ptr == host_result.ptr);
+  assert(cuda::std::memcmp(&ours, &host, sizeof(T)) == 0);
+}
+
+void test_integral()
+{
+  std::mt19937_64 gen(42);
+  for (int i = 0; i < count; ++i)
+  {
+    const unsigned long long bits = gen() >> (gen() % 64);
+    compare<unsigned long long>(std::to_string(bits));
+    compare<unsigned long long>(std::to_string(bits | (1ull << 63)));
+    compare<int>(std::to_string(static_cast<int>(bits)));
+  }
+}
+
+std::string print(const char* format, int digits, double value)
+{
+  char buff[64];
+  std::snprintf(buff, sizeof(buff), format, digits, value);
+  return buff;
+}
+
+void test_floating_point()
+{
+  std::mt19937_64 gen(42);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  for (int i = 0; i < count; ++i)
+  {
+    const double value = dist(gen);
+    compare<double>(print("%.*e", 16, value));
+    compare<double>(print("%.*g", 6, value));
+    compare<double>(print("%.*f", 3, value));
+    compare<double>(print("%.*e", 29, value));
+    compare<float>(print("%.*e", 8, value));
+  }
+}
+
+void test_all()
+{
+  test_integral();
+  test_floating_point();
+}
+#  else // ^^^ __cpp_lib_to_chars ^^^ / vvv !__cpp_lib_to_chars vvv
+void test_all() {}
+#  endif // !__cpp_lib_to_chars
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test_all();))
+
+  return 0;
+}
@@ -0,0 +1,249 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/__charconv_>
+#include <cuda/std/bit>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+template <class T>
+struct TestItem
+{
+  const char* str;
+  T value;
+  cuda::std::ptrdiff_t len; // number of characters parsed, -1 for the whole string
+  cuda::std::errc ec = cuda::std::errc{};
+};
+
+template <class T>
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void
+test_item(const TestItem<T>& item, cuda::std::chars_format fmt = cuda::std::chars_format::general)
+{
+  using Storage =
+    cuda::std::conditional_t<sizeof(T) == sizeof(cuda::std::uint32_t), cuda::std::uint32_t, cuda::std::uint64_t>;
+
+  const auto str_len = static_cast<cuda::std::ptrdiff_t>(cuda::std::strlen(item.str));
+  const auto len     = (item.len < 0) ? str_len : item.len;
+
+  T value           = T{42};
+  const auto result = cuda::std::from_chars(item.str, item.str + str_len, value, fmt);
+  assert(result.ec == item.ec);
+  assert(result.ptr == item.str + len);
+  if (item.ec == cuda::std::errc{})
+  {
+    if (value != value)
+    {
+      assert(item.value != item.value);
+    }
+    else
+    {
+      // Compare the representations, so that zeros of different signs don't compare equal.
+      assert(cuda::std::bit_cast<Storage>(value) == cuda::std::bit_cast<Storage>(item.value));
+    }
+  }
+  else
+  {
+    assert(value == T{42});
+  }
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_double()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<double&>(),
+                                       cuda::std::chars_format{}))>);
+
+  constexpr double inf = cuda::std::numeric_limits<double>::infinity();
+  constexpr double nan = cuda::std::numeric_limits<double>::quiet_NaN();
+
+  const TestItem<double> general[] = {
+    // Simple values, which use the fast path
+    {"0", 0.0, -1},
+    {"-0", -0.0, -1},
+    {"1", 1.0, -1},
+    {"-1.5", -1.5, -1},
+    {"1.", 1.0, -1},
+    {".25", 0.25, -1},
+    {"123.456e3", 123456.0, -1},
+    {"1E+2", 100.0, -1},
+    {"9007199254740992", 9007199254740992.0, -1},
+    // Values which need Eisel-Lemire
+    {"1e23", 1e23, -1},
+    {"8.5e-1", 0x1.b333333333333p-1, -1},
+    {"0.1", 0x1.999999999999ap-4, -1},
+    {"3.141592653589793238462643383279", 0x1.921fb54442d18p+1, -1},
+    {"9007199254740993", 9007199254740992.0, -1},
+    {"9007199254740995", 9007199254740996.0, -1},
+    {"1.7976931348623157e308", 0x1.fffffffffffffp+1023, -1},
+    {"2.2250738585072014e-308", 0x1p-1022, -1},
+    {"2.2250738585072011e-308", 0x0.fffffffffffffp-1022, -1},
+    {"4.9406564584124654e-324", 0x0.0000000000001p-1022, -1},
+    // Too many digits for a 64 bit mantissa, which are rounded exactly
+    {"9007199254740993.00000000000000000000000001", 9007199254740994.0, -1},
+    {"9007199254740992.99999999999999999999999999", 9007199254740992.0, -1},
+    {"1.00000000000000011102230246251565404236316680908203125", 1.0, -1},
+    {"1.000000000000000111022302462515654042363166809082031251", 0x1.0000000000001p0, -1},
+    {"1.00000000000000033306690738754696212708950042724609375", 0x1.0000000000002p0, -1},
+    {"2.4703282292062327208828439643411068618252990130716238221279284125033775363e-324", 0.0, -1,
+     cuda::std::errc::result_out_of_range},
+    {"2.4703282292062327208828439643411068618252990130716238221279284125033775364e-324", 0x0.0000000000001p-1022, -1},
+    {"2.4703282292062327208828439643411068618252990130716238221279284125033775363e-323", 0x0.0000000000005p-1022, -1},
+    {"000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001", 1.0, -1},
+    {"0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001e90", 1.0, -1},
+    // Out of range
+    {"1e309", 0.0, -1, cuda::std::errc::result_out_of_range},
+    {"-1.7976931348623159e308", 0.0, -1, cuda::std::errc::result_out_of_range},
+    {"1e-400", 0.0, -1, cuda::std::errc::result_out_of_range},
+    {"0e999999999999999999999", 0.0, -1},
+    // Infinities and NaNs
+    {"inf", inf, -1},
+    {"-INF", -inf, -1},
+    {"infinity", inf, -1},
+    {"infinit", inf, 3},
+    {"nan", nan, -1},
+    {"-NaN", -nan, -1},
+    {"nan(payload_123)", nan, -1},
+    {"nan(payload", nan, 3},
+    // The pattern ends at the first character which doesn't match
+    {"1.5.5", 1.5, 3},
+    {"1e", 1.0, 1},
+    {"1e+", 1.0, 1},
+    {"1e5x", 1e5, 3},
+    {"12p3", 12.0, 2},
+    // Invalid patterns
+    {"", 0.0, 0, cuda::std::errc::invalid_argument},
+    {"-", 0.0, 0, cuda::std::errc::invalid_argument},
+    {".", 0.0, 0, cuda::std::errc::invalid_argument},
+    {"+1", 0.0, 0, cuda::std::errc::invalid_argument},
+    {" 1", 0.0, 0, cuda::std::errc::invalid_argument},
+    {"e5", 0.0, 0, cuda::std::errc::invalid_argument},
+    {"-.e5", 0.0, 0, cuda::std::errc::invalid_argument},
+    {"in", 0.0, 0, cuda::std::errc::invalid_argument},
+  };
+  for (const auto& item : general)
+  {
+    test_item(item);
+  }
+
+  const TestItem<double> scientific[] = {
+    {"1.5e3", 1500.0, -1},
+    {"1.5E-3", 0.0015, -1},
+    {"1.5", 0.0, 0, cuda::std::errc::invalid_argument},
+    {"1.5e", 0.0, 0, cuda::std::errc::invalid_argument},
+  };
+  for (const auto& item : scientific)
+  {
+    test_item(item, cuda::std::chars_format::scientific);
+  }
+
+  const TestItem<double> fixed[] = {
+    {"1.5e3", 1.5, 3},
+    {"-12.25", -12.25, -1},
+  };
+  for (const auto& item : fixed)
+  {
+    test_item(item, cuda::std::chars_format::fixed);
+  }
+
+  const TestItem<double> hex[] = {
+    {"1", 1.0, -1},
+    {"1.8p1", 3.0, -1},
+    {"-A.8P-1", -5.25, -1},
+    {"0.001p+12", 1.0, -1},
+    {"1p-1074", 0x1p-1074, -1},
+    {"1p-1075", 0.0, -1, cuda::std::errc::result_out_of_range},
+    {"1.0000000000001p-1075", 0x1p-1074, -1},
+    {"1.fffffffffffffp1023", 0x1.fffffffffffffp+1023, -1},
+    {"1.fffffffffffff8p1023", 0.0, -1, cuda::std::errc::result_out_of_range},
+    {"1.000000000000080000000000001", 0x1.0000000000001p0, -1},
+    {"1.00000000000008", 1.0, -1},
+    {"1.00000000000018", 0x1.0000000000002p0, -1},
+    {"0p99999", 0.0, -1},
+    {"1p", 1.0, 1},
+    {"0x1p3", 0.0, 1},
+    {"p1", 0.0, 0, cuda::std::errc::invalid_argument},
+    {"-inf", -inf, -1},
+  };
+  for (const auto& item : hex)
+  {
+    test_item(item, cuda::std::chars_format::hex);
+  }
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_float()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<float&>(),
+                                       cuda::std::chars_format{}))>);
+
+  constexpr float inf = cuda::std::numeric_limits<float>::infinity();
+
+  const TestItem<float> general[] = {
+    {"0", 0.0f, -1},
+    {"-0.0", -0.0f, -1},
+    {"1.25", 1.25f, -1},
+    {"16777217", 16777216.0f, -1},
+    {"0.1", 0x1.99999ap-4f, -1},
+    {"7.038531e-26", 0x1.5c87fap-84f, -1},
+    {"3.4028234664e38", 0x1.fffffep+127f, -1},
+    {"3.4028236e38", 0.0f, -1, cuda::std::errc::result_out_of_range},
+    {"1.17549435e-38", 0x1p-126f, -1},
+    {"1.4e-45", 0x1p-149f, -1},
+    {"7.006492321624085354618647916449580656401e-46", 0.0f, -1, cuda::std::errc::result_out_of_range},
+    {"7.006492321624085354618647916449580656402e-46", 0x1p-149f, -1},
+    {"1.00000005960464477539062500000000000000000000001", 0x1.000002p0f, -1},
+    {"1.000000059604644775390625", 1.0f, -1},
+    {"-Infinity", -inf, -1},
+  };
+  for (const auto& item : general)
+  {
+    test_item(item);
+  }
+
+  const TestItem<float> hex[] = {
+    {"1.000001p0", 1.0f, -1},
+    {"1.0000010001p0", 0x1.000002p0f, -1},
+    {"1.fffffep127", 0x1.fffffep+127f, -1},
+    {"1.ffffffp127", 0.0f, -1, cuda::std::errc::result_out_of_range},
+    {"1p-149", 0x1p-149f, -1},
+  };
+  for (const auto& item : hex)
+  {
+    test_item(item, cuda::std::chars_format::hex);
+  }
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST bool test()
+{
+  test_double();
+  test_float();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if defined(_CCCL_BUILTIN_BIT_CAST)
+  static_assert(test());
+#endif // _CCCL_BUILTIN_BIT_CAST
+  return 0;
+}
@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// REQUIRES: benchmarks
+
+// Compares the throughput of from_chars with the one of the host standard library, on random integers and on random
+// floating point values printed with all their digits or with a few of them.
+
+#include <cuda/std/__charconv_>
+
+#include "host_benchmark.h"
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <charconv>
+#  include <cstdio>
+#  include <cstdlib>
+#  include <random>
+#  include <string>
+#  include <vector>
+
+// The inputs are stored one after the other, separated by spaces, as a parser would see them.
+struct Input
+{
+  std::string text;
+  std::vector<std::size_t> offsets;
+};
+
+template <class Fn>
+double megabytes_per_second(const Input& input, int iterations, Fn fn)
+{
+  double checksum = 0;
+  const stopwatch watch;
+  for (int i = 0; i < iterations; ++i)
+  {
+    for (std::size_t j = 0; j + 1 < input.offsets.size(); ++j)
+    {
+      checksum += fn(input.text.data() + input.offsets[j], input.text.data() + input.offsets[j + 1] - 1);
+    }
+  }
+  const double seconds = watch.seconds();
+  DoNotOptimize(checksum);
+  return static_cast<double>(input.text.size()) * iterations / seconds / 1e6;
+}
+
+template <class Make>
+Input make_input(std::size_t count, Make make)
+{
+  std::mt19937_64 gen(42);
+  Input input;
+  input.offsets.push_back(0);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    input.text += make(gen);
+    input.text += ' ';
+    input.offsets.push_back(input.text.size());
+  }
+  return input;
+}
+
+template <class T>
+void bench_integral(const char* name, const Input& input)
+{
+  const double ours = megabytes_per_second(input, 20, [](const char* first, const char* last) {
+    T value{};
+    cuda::std::from_chars(first, last, value);
+    return static_cast<double>(value);
+  });
+  const double host = megabytes_per_second(input, 20, [](const char* first, const char* last) {
+    T value{};
+    std::from_chars(first, last, value);
+    return static_cast<double>(value);
+  });
+  std::printf("%-28s %10.1f MB/s %10.1f MB/s\n", name, ours, host);
+}
+
+template <class T>
+void bench_floating_point(const char* name, const Input& input)
+{
+  const double ours = megabytes_per_second(input, 20, [](const char* first, const char* last) {
+    T value{};
+    cuda::std::from_chars(first, last, value);
+    return static_cast<double>(value);
+  });
+#  if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  const double host = megabytes_per_second(input, 20, [](const char* first, const char* last) {
+    T value{};
+    std::from_chars(first, last, value);
+    return static_cast<double>(value);
+  });
+#  else // ^^^ __cpp_lib_to_chars ^^^ / vvv !__cpp_lib_to_chars vvv
+  // The inputs are followed by a space, where strtod stops.
+  const double host = megabytes_per_second(input, 20, [](const char* first, const char*) {
+    return static_cast<double>(std::strtod(first, nullptr));
+  });
+#  endif // !__cpp_lib_to_chars
+  std::printf("%-28s %10.1f MB/s %10.1f MB/s\n", name, ours, host);
+}
+
+void bench()
+{
+  constexpr std::size_t count = 200000;
+
+  std::printf("%-28s %15s %15s\n", "input", "cuda::std", "std");
+
+  bench_integral<unsigned long long>("uint64_t, 1 to 20 digits", make_input(count, [](std::mt19937_64& gen) {
+                                       return std::to_string(gen() >> (gen() % 64));
+                                     }));
+  bench_integral<unsigned long long>("uint64_t, 20 digits", make_input(count, [](std::mt19937_64& gen) {
+                                       return std::to_string(gen() | (1ull << 63));
+                                     }));
+  bench_integral<int>("int32_t", make_input(count, [](std::mt19937_64& gen) {
+                        return std::to_string(static_cast<int>(gen()));
+                      }));
+
+  const auto printed = [](const char* format, int digits) {
+    return [=](std::mt19937_64& gen) {
+      std::uniform_real_distribution<double> dist(-1e6, 1e6);
+      char buff[64];
+      std::snprintf(buff, sizeof(buff), format, digits, dist(gen));
+      return std::string(buff);
+    };
+  };
+  bench_floating_point<double>("double, 17 digits", make_input(count, printed("%.*e", 16)));
+  bench_floating_point<double>("double, 6 digits", make_input(count, printed("%.*g", 6)));
+  bench_floating_point<double>("double, 3 decimals", make_input(count, printed("%.*f", 3)));
+  bench_floating_point<double>("double, 30 digits", make_input(count, printed("%.*e", 29)));
+  bench_floating_point<float>("float, 9 digits", make_input(count, printed("%.*e", 8)));
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench();))
+
+  return 0;
+}
@@ -0,0 +1,286 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/__charconv_>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include "test_macros.h"
+
+constexpr int first_base = 2;
+constexpr int last_base  = 36;
+
+// Parses what to_chars printed for value, followed by a character which is not a digit in any base.
+template <class T>
+__host__ __device__ constexpr void test_round_trip(T value, int base)
+{
+  char buff[150]{};
+  const auto printed = cuda::std::to_chars(buff, buff + sizeof(buff) - 1, value, base);
+  assert(printed.ec == cuda::std::errc{});
+  *printed.ptr = '!';
+
+  T result{};
+  const auto parsed = cuda::std::from_chars(buff, printed.ptr + 1, result, base);
+  assert(parsed.ec == cuda::std::errc{});
+  assert(parsed.ptr == printed.ptr);
+  assert(result == value);
+
+  // Leading zeros don't change the value.
+  char padded[170]{};
+  char* out     = padded;
+  const char* p = buff;
+  if (*p == '-')
+  {
+    *out++ = *p++;
+  }
+  for (int i = 0; i < 19; ++i)
+  {
+    *out++ = '0';
+  }
+  while (p != printed.ptr)
+  {
+    *out++ = *p++;
+  }
+  const char* padded_last  = out;
+  result                   = T{};
+  const auto parsed_padded = cuda::std::from_chars(padded, padded_last, result, base);
+  assert(parsed_padded.ec == cuda::std::errc{});
+  assert(parsed_padded.ptr == padded_last);
+  assert(result == value);
+}
+
+// One more than the maximum is out of range, and all of its digits are consumed.
+template <class T>
+__host__ __device__ constexpr void test_out_of_range(int base)
+{
+  using U = cuda::std::make_unsigned_t<T>;
+
+  char buff[150]{};
+  U limit     = static_cast<U>(cuda::std::numeric_limits<T>::max());
+  auto printed = cuda::std::to_chars(buff, buff + sizeof(buff), limit, base);
+  // Increment the last digit, with carry.
+  const char last_digit = (base <= 10) ? static_cast<char>('0' + base - 1) : static_cast<char>('a' + base - 11);
+  for (char* p = printed.ptr - 1;; --p)
+  {
+    if (p < buff)
+    {
+      for (char* q = printed.ptr; q != buff; --q)
+      {
+        *q = *(q - 1);
+      }
+      buff[0] = '1';
+      ++printed.ptr;
+      break;
+    }
+    if (*p != last_digit)
+    {
+      *p = (*p == '9') ? 'a' : static_cast<char>(*p + 1);
+      break;
+    }
+    *p = '0';
+  }
+
+  T result          = T{42};
+  const auto parsed = cuda::std::from_chars(buff, printed.ptr, result, base);
+  assert(parsed.ec == cuda::std::errc::result_out_of_range);
+  assert(parsed.ptr == printed.ptr);
+  assert(result == T{42});
+}
+
+template <class T>
+__host__ __device__ constexpr void test_type(int base)
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<T&>(),
+                                       int{}))>);
+
+  constexpr T min = cuda::std::numeric_limits<T>::min();
+  constexpr T max = cuda::std::numeric_limits<T>::max();
+
+  test_round_trip<T>(T{0}, base);
+  test_round_trip<T>(T{1}, base);
+  test_round_trip<T>(T{35}, base);
+  test_round_trip<T>(T{127}, base);
+  test_round_trip<T>(max, base);
+  test_round_trip<T>(static_cast<T>(max - 1), base);
+  test_round_trip<T>(static_cast<T>(max / 3), base);
+  test_round_trip<T>(min, base);
+  test_round_trip<T>(static_cast<T>(min + 1), base);
+  if constexpr (cuda::std::is_signed_v<T>)
+  {
+    test_round_trip<T>(T{-1}, base);
+    test_round_trip<T>(T{-128}, base);
+    test_round_trip<T>(static_cast<T>(min / 7), base);
+  }
+  test_out_of_range<T>(base);
+}
+
+template <class T>
+__host__ __device__ constexpr void test_errors()
+{
+  T value = T{42};
+
+  // Empty input, and inputs which don't start with a digit
+  for (const char* str : {"", "-", "+1", " 1", "x1", "--1", "-+1"})
+  {
+    const auto len    = cuda::std::strlen(str);
+    const auto result = cuda::std::from_chars(str, str + len, value);
+    assert(result.ec == cuda::std::errc::invalid_argument);
+    assert(result.ptr == str);
+    assert(value == T{42});
+  }
+
+  // Unsigned types don't accept a sign
+  {
+    const char str[]  = "-1";
+    const auto result = cuda::std::from_chars(str, str + 2, value);
+    if constexpr (cuda::std::is_signed_v<T>)
+    {
+      assert(result.ec == cuda::std::errc{});
+      assert(result.ptr == str + 2);
+      assert(value == T(-1));
+    }
+    else
+    {
+      assert(result.ec == cuda::std::errc::invalid_argument);
+      assert(result.ptr == str);
+      assert(value == T{42});
+    }
+  }
+
+  // Parsing stops at the first character which is not a digit in the base
+  {
+    const char str[]  = "0x1f";
+    const auto result = cuda::std::from_chars(str, str + 4, value);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == str + 1);
+    assert(value == T{0});
+  }
+  {
+    const char str[]  = "1Fz";
+    const auto result = cuda::std::from_chars(str, str + 3, value, 16);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == str + 2);
+    assert(value == T{31});
+  }
+  {
+    const char str[]  = "12345678a";
+    value             = T{42};
+    const auto result = cuda::std::from_chars(str, str + 9, value);
+    if constexpr (sizeof(T) == 1)
+    {
+      assert(result.ec == cuda::std::errc::result_out_of_range);
+      assert(value == T{42});
+    }
+    else
+    {
+      assert(result.ec == cuda::std::errc{});
+      assert(value == static_cast<T>(12345678));
+    }
+    assert(result.ptr == str + 8);
+  }
+
+  // A very long number is out of range, but consumes all the digits
+  {
+    const char str[]  = "000000000000000000000000000000000000000000000000000000000000000000000000000001";
+    const auto len    = sizeof(str) - 1;
+    const auto result = cuda::std::from_chars(str, str + len, value);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == str + len);
+    assert(value == T{1});
+  }
+  {
+    const char str[]  = "100000000000000000000000000000000000000000000000000000000000000000000000000000.";
+    const auto len    = sizeof(str) - 2;
+    value             = T{42};
+    const auto result = cuda::std::from_chars(str, str + len + 1, value);
+    assert(result.ec == cuda::std::errc::result_out_of_range);
+    assert(result.ptr == str + len);
+    assert(value == T{42});
+  }
+}
+
+__host__ __device__ constexpr void test_types(int base)
+{
+  test_type<signed char>(base);
+  test_type<signed short>(base);
+  test_type<signed int>(base);
+  test_type<signed long>(base);
+  test_type<signed long long>(base);
+#if _CCCL_HAS_INT128()
+  test_type<__int128_t>(base);
+#endif // _CCCL_HAS_INT128()
+
+  test_type<unsigned char>(base);
+  test_type<unsigned short>(base);
+  test_type<unsigned int>(base);
+  test_type<unsigned long>(base);
+  test_type<unsigned long long>(base);
+#if _CCCL_HAS_INT128()
+  test_type<__uint128_t>(base);
+#endif // _CCCL_HAS_INT128()
+}
+
+__host__ __device__ constexpr void test_char()
+{
+  char value{};
+  const char str[]  = "101";
+  const auto result = cuda::std::from_chars(str, str + 3, value, 2);
+  assert(result.ec == cuda::std::errc{});
+  assert(result.ptr == str + 3);
+  assert(value == 5);
+}
+
+__host__ __device__ constexpr bool test()
+{
+  for (int base = first_base; base <= last_base; ++base)
+  {
+    test_types(base);
+  }
+
+  test_errors<signed char>();
+  test_errors<int>();
+  test_errors<long long>();
+  test_errors<unsigned char>();
+  test_errors<unsigned int>();
+  test_errors<unsigned long long>();
+#if _CCCL_HAS_INT128()
+  test_errors<__int128_t>();
+  test_errors<__uint128_t>();
+#endif // _CCCL_HAS_INT128()
+  test_char();
+
+  return true;
+}
+
+__host__ __device__ constexpr bool test_constexpr()
+{
+  test_types(10);
+  test_types(16);
+  test_errors<int>();
+  test_errors<unsigned long long>();
+  test_char();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test_constexpr());
+  return 0;
+}
@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// to_chars gives the same results as the one of the host standard library, on random integers of various widths and
+// on random floating point values.
+
+#include <cuda/std/__charconv_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstring>
+
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <charconv>
+#  include <random>
+
+#  if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+
+constexpr int count = 20000;
+
+// The base of the integer overloads, or the format of the floating point ones.
+int host_arg(int base)
+{
+  return base;
+}
+
+std::chars_format host_arg(cuda::std::chars_format fmt)
+{
+  return static_cast<std::chars_format>(fmt);
+}
+
+template <class T, class... Fmt>
+void compare(T value, Fmt... fmt)
+{
+  char ours[512];
+  char host[512];
+  const auto ours_result = cuda::std::to_chars(ours, ours + sizeof(ours), value, fmt...);
+  const auto host_result = std::to_chars(host, host + sizeof(host), value, host_arg(fmt)...);
+  assert(ours_result.ec == cuda::std::errc{});
+  assert(ours_result.ptr - ours == host_result.ptr - host);
+  assert(cuda::std::memcmp(ours, host, static_cast<cuda::std::size_t>(host_result.ptr - host)) == 0);
+}
+
+void test_integral()
+{
+  std::mt19937_64 gen(42);
+  for (int i = 0; i < count; ++i)
+  {
+    const unsigned long long bits = gen() >> (gen() % 64);
+    compare(bits);
+    compare(bits, 16);
+    compare(bits | (1ull << 63));
+    compare(static_cast<int>(bits));
+    compare(static_cast<long long>(bits), 7);
+  }
+}
+
+void test_floating_point()
+{
+  std::mt19937_64 gen(42);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  for (int i = 0; i < count; ++i)
+  {
+    const double value = dist(gen);
+    compare(value);
+    compare(value, cuda::std::chars_format::scientific);
+    compare(value, cuda::std::chars_format::fixed);
+    compare(value, cuda::std::chars_format::hex);
+    compare(static_cast<float>(value));
+
+    // Any finite bit pattern.
+    double any = 0;
+    do
+    {
+      const auto bits = gen();
+      cuda::std::memcpy(&any, &bits, sizeof(any));
+    } while (any != any || any - any != 0);
+    compare(any);
+    compare(any, cuda::std::chars_format::scientific);
+  }
+}
+
+void test_all()
+{
+  test_integral();
+  test_floating_point();
+}
+#  else // ^^^ __cpp_lib_to_chars ^^^ / vvv !__cpp_lib_to_chars vvv
+void test_all() {}
+#  endif // !__cpp_lib_to_chars
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test_all();))
+
+  return 0;
+}
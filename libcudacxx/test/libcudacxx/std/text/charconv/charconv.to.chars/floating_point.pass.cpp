@@ -0,0 +1,174 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/__charconv_>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+template <class T>
+struct TestItem
+{
+  T value;
+  const char* plain;
+  const char* general;
+  const char* scientific;
+  const char* fixed;
+  const char* hex;
+};
+
+__host__ __device__ constexpr bool equal(const char* first, const char* last, const char* expected)
+{
+  for (; first != last; ++first, ++expected)
+  {
+    if (*expected == '\0' || *first != *expected)
+    {
+      return false;
+    }
+  }
+  return *expected == '\0';
+}
+
+template <class T, class... Fmt>
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_format(T value, const char* expected, Fmt... fmt)
+{
+  static_assert(cuda::std::is_same_v<cuda::std::to_chars_result,
+                                     decltype(cuda::std::to_chars(
+                                       cuda::std::declval<char*>(), cuda::std::declval<char*>(), value, fmt...))>);
+
+  char buff[400]{};
+  const auto len = static_cast<cuda::std::ptrdiff_t>(cuda::std::strlen(expected));
+
+  const auto result = cuda::std::to_chars(buff, buff + sizeof(buff), value, fmt...);
+  assert(result.ec == cuda::std::errc{});
+  assert(result.ptr == buff + len);
+  assert(equal(buff, result.ptr, expected));
+
+  // One character less than needed doesn't fit.
+  const auto too_small = cuda::std::to_chars(buff, buff + len - 1, value, fmt...);
+  assert(too_small.ec == cuda::std::errc::value_too_large);
+  assert(too_small.ptr == buff + len - 1);
+}
+
+template <class T>
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_item(const TestItem<T>& item)
+{
+  test_format(item.value, item.plain);
+  test_format(item.value, item.general, cuda::std::chars_format::general);
+  test_format(item.value, item.scientific, cuda::std::chars_format::scientific);
+  test_format(item.value, item.fixed, cuda::std::chars_format::fixed);
+  test_format(item.value, item.hex, cuda::std::chars_format::hex);
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_double()
+{
+  constexpr double inf = cuda::std::numeric_limits<double>::infinity();
+  constexpr double nan = cuda::std::numeric_limits<double>::quiet_NaN();
+
+  const TestItem<double> items[] = {
+    {0.0, "0", "0", "0e+00", "0", "0p+0"},
+    {-0.0, "-0", "-0", "-0e+00", "-0", "-0p+0"},
+    {1.0, "1", "1", "1e+00", "1", "1p+0"},
+    {-1.5, "-1.5", "-1.5", "-1.5e+00", "-1.5", "-1.8p+0"},
+    {0.1, "0.1", "0.1", "1e-01", "0.1", "1.999999999999ap-4"},
+    {100.0, "100", "100", "1e+02", "100", "1.9p+6"},
+    {123456.0, "123456", "123456", "1.23456e+05", "123456", "1.e24p+16"},
+    {1234567.0, "1234567", "1.234567e+06", "1.234567e+06", "1234567", "1.2d687p+20"},
+    {1e6, "1e+06", "1e+06", "1e+06", "1000000", "1.e848p+19"},
+    {1e-4, "1e-04", "0.0001", "1e-04", "0.0001", "1.a36e2eb1c432dp-14"},
+    {1.5e-5, "1.5e-05", "1.5e-05", "1.5e-05", "0.000015", "1.f75104d551d69p-17"},
+    {0.0001234, "0.0001234", "0.0001234", "1.234e-04", "0.0001234", "1.02c9dedbc309dp-13"},
+    {3.141592653589793, "3.141592653589793", "3.141592653589793", "3.141592653589793e+00", "3.141592653589793",
+     "1.921fb54442d18p+1"},
+    {1e22, "1e+22", "1e+22", "1e+22", "10000000000000000000000", "1.0f0cf064dd592p+73"},
+    // The shortest representations of these have trailing zeros which are not the ones of the value.
+    {1e23, "1e+23", "1e+23", "1e+23", "99999999999999991611392", "1.52d02c7e14af6p+76"},
+    {123456789012345683968.0, "123456789012345683968", "1.2345678901234568e+20", "1.2345678901234568e+20",
+     "123456789012345683968", "1.ac53a7e04bcdap+66"},
+    {1.7976931348623157e308, "1.7976931348623157e+308", "1.7976931348623157e+308", "1.7976931348623157e+308",
+     "17976931348623157081452742373170435679807056752584499659891747680315726078002853876058955863276687817154045895351"
+     "43824642343213268894641827684675467035375169860499105765512820762454900903893289440758685084551339423045832369032"
+     "22948165808559332123348274797826204144723168738177180919299881250404026184124858368",
+     "1.fffffffffffffp+1023"},
+    // Powers of two, whose interval is smaller below them than above them
+    {2.0, "2", "2", "2e+00", "2", "1p+1"},
+    {9007199254740992.0, "9007199254740992", "9.007199254740992e+15", "9.007199254740992e+15", "9007199254740992",
+     "1p+53"},
+    {0x1p-1022, "2.2250738585072014e-308", "2.2250738585072014e-308", "2.2250738585072014e-308",
+     "0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000000000000000000000022250738585072014",
+     "1p-1022"},
+    // Subnormals
+    {0x0.0000000000001p-1022, "5e-324", "5e-324", "5e-324",
+     "0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000005",
+     "0.0000000000001p-1022"},
+    {0x0.fffffffffffffp-1022, "2.225073858507201e-308", "2.225073858507201e-308", "2.225073858507201e-308",
+     "0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+     "000000000000000000000000000000000000000000000000000000000000000000000000000000000002225073858507201",
+     "0.fffffffffffffp-1022"},
+    // Infinities and NaNs
+    {inf, "inf", "inf", "inf", "inf", "inf"},
+    {-inf, "-inf", "-inf", "-inf", "-inf", "-inf"},
+    {nan, "nan", "nan", "nan", "nan", "nan"},
+    {-nan, "-nan", "-nan", "-nan", "-nan", "-nan"},
+  };
+  for (const auto& item : items)
+  {
+    test_item(item);
+  }
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST void test_float()
+{
+  constexpr float inf = cuda::std::numeric_limits<float>::infinity();
+
+  const TestItem<float> items[] = {
+    {0.0f, "0", "0", "0e+00", "0", "0p+0"},
+    {1.0f, "1", "1", "1e+00", "1", "1p+0"},
+    {0.1f, "0.1", "0.1", "1e-01", "0.1", "1.99999ap-4"},
+    {-2.5f, "-2.5", "-2.5", "-2.5e+00", "-2.5", "-1.4p+1"},
+    {1e6f, "1e+06", "1e+06", "1e+06", "1000000", "1.e848p+19"},
+    {16777216.0f, "16777216", "1.6777216e+07", "1.6777216e+07", "16777216", "1p+24"},
+    {3.4028235e38f, "3.4028235e+38", "3.4028235e+38", "3.4028235e+38", "340282346638528859811704183484516925440",
+     "1.fffffep+127"},
+    {1.17549435e-38f, "1.1754944e-38", "1.1754944e-38", "1.1754944e-38",
+     "0.000000000000000000000000000000000000011754944", "1p-126"},
+    {1e-45f, "1e-45", "1e-45", "1e-45", "0.000000000000000000000000000000000000000000001", "0.000002p-126"},
+    {-inf, "-inf", "-inf", "-inf", "-inf", "-inf"},
+  };
+  for (const auto& item : items)
+  {
+    test_item(item);
+  }
+}
+
+__host__ __device__ _LIBCUDACXX_CONSTEXPR_BIT_CAST bool test()
+{
+  test_double();
+  test_float();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if defined(_CCCL_BUILTIN_BIT_CAST)
+  static_assert(test());
+#endif // _CCCL_BUILTIN_BIT_CAST
+  return 0;
+}
@@ -0,0 +1,133 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// REQUIRES: benchmarks
+
+// Compares the throughput of to_chars with the one of the host standard library, on random integers of various widths
+// and on random floating point values.
+
+#include <cuda/std/__charconv_>
+
+#include "host_benchmark.h"
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <charconv>
+#  include <cstdio>
+#  include <cstring>
+#  include <random>
+#  include <vector>
+
+template <class T, class Fn>
+double million_per_second(const std::vector<T>& values, int iterations, Fn fn)
+{
+  std::size_t checksum = 0;
+  char buff[512];
+  const stopwatch watch;
+  for (int i = 0; i < iterations; ++i)
+  {
+    for (const T& value : values)
+    {
+      char* const last = fn(buff, buff + sizeof(buff), value);
+      checksum += static_cast<std::size_t>(last - buff) + static_cast<unsigned char>(buff[0]);
+    }
+  }
+  const double seconds = watch.seconds();
+  DoNotOptimize(checksum);
+  return static_cast<double>(values.size()) * iterations / seconds / 1e6;
+}
+
+template <class T, class Make>
+std::vector<T> make_values(std::size_t count, Make make)
+{
+  std::mt19937_64 gen(42);
+  std::vector<T> values(count);
+  for (auto& value : values)
+  {
+    value = make(gen);
+  }
+  return values;
+}
+
+// The base of the integer overloads, or the format of the floating point ones.
+int host_arg(int base)
+{
+  return base;
+}
+
+std::chars_format host_arg(cuda::std::chars_format fmt)
+{
+  return static_cast<std::chars_format>(fmt);
+}
+
+template <class T, class... Fmt>
+void bench_one(const char* name, const std::vector<T>& values, Fmt... fmt)
+{
+  const double ours = million_per_second(values, 10, [=](char* first, char* last, T value) {
+    return cuda::std::to_chars(first, last, value, fmt...).ptr;
+  });
+  const double host = million_per_second(values, 10, [=](char* first, char* last, T value) {
+    return std::to_chars(first, last, value, host_arg(fmt)...).ptr;
+  });
+  std::printf("%-28s %12.1f M/s %12.1f M/s\n", name, ours, host);
+}
+
+void bench()
+{
+  constexpr std::size_t count = 200000;
+
+  std::printf("%-28s %16s %16s\n", "input", "cuda::std", "std");
+
+  const auto uint64_any = make_values<unsigned long long>(count, [](std::mt19937_64& gen) {
+    return gen() >> (gen() % 64);
+  });
+  bench_one("uint64_t, 1 to 20 digits", uint64_any);
+  bench_one("uint64_t, base 16", uint64_any, 16);
+  bench_one("uint64_t, 20 digits", make_values<unsigned long long>(count, [](std::mt19937_64& gen) {
+              return gen() | (1ull << 63);
+            }));
+  bench_one("int32_t", make_values<int>(count, [](std::mt19937_64& gen) {
+              return static_cast<int>(gen());
+            }));
+
+#  if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  const auto doubles = make_values<double>(count, [](std::mt19937_64& gen) {
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    return dist(gen);
+  });
+  const auto any_double = make_values<double>(count, [](std::mt19937_64& gen) {
+    double value = 0;
+    do
+    {
+      const auto bits = gen();
+      std::memcpy(&value, &bits, sizeof(value));
+    } while (value != value || value - value != 0);
+    return value;
+  });
+  const auto floats = make_values<float>(count, [](std::mt19937_64& gen) {
+    std::uniform_real_distribution<float> dist(-1e6f, 1e6f);
+    return dist(gen);
+  });
+  bench_one("double, shortest", doubles);
+  bench_one("double, any bits, shortest", any_double);
+  bench_one("double, scientific", doubles, cuda::std::chars_format::scientific);
+  bench_one("double, fixed", doubles, cuda::std::chars_format::fixed);
+  bench_one("double, hex", doubles, cuda::std::chars_format::hex);
+  bench_one("float, shortest", floats);
+#  endif // __cpp_lib_to_chars
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench();))
+
+  return 0;
+}
@@ -0,0 +1,105 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// size_t _Find_first() const noexcept; // extension
+// size_t _Find_next(size_t prev) const noexcept; // extension
+
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/type_traits>
+
+#include "../bitset_test_cases.h"
+#include "test_macros.h"
+
+TEST_NV_DIAG_SUPPRESS(186)
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr void check_find(const cuda::std::bitset<N>& v)
+{
+  static_assert(cuda::std::is_same<cuda::std::size_t, decltype(v._Find_first())>::value, "");
+  static_assert(cuda::std::is_same<cuda::std::size_t, decltype(v._Find_next(0))>::value, "");
+  static_assert(noexcept(v._Find_first()), "");
+  static_assert(noexcept(v._Find_next(0)), "");
+
+  // Visits the set bits in order, then returns size().
+  cuda::std::size_t expected = 0;
+  while (expected != N && !v[expected])
+  {
+    ++expected;
+  }
+  cuda::std::size_t found = v._Find_first();
+  assert(found == expected);
+  while (found != N)
+  {
+    do
+    {
+      ++expected;
+    } while (expected != N && !v[expected]);
+    found = v._Find_next(found);
+    assert(found == expected);
+  }
+  assert(v._Find_next(N) == N);
+  assert(v._Find_next(static_cast<cuda::std::size_t>(-1)) == N);
+}
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr void test_find()
+{
+  auto const& cases = get_test_cases(cuda::std::integral_constant<int, N>());
+  for (cuda::std::size_t c = 0; c != cases.size(); ++c)
+  {
+    const cuda::std::bitset<N> v(cases[c]);
+    check_find(v);
+    check_find(~v);
+  }
+}
+
+template <cuda::std::size_t N>
+__host__ __device__ void test_find_large()
+{
+  cuda::std::bitset<N> v;
+  check_find(v);
+  for (cuda::std::size_t i = 3; i < N; i += i / 2 + 29)
+  {
+    v.set(i);
+  }
+  v.set(N - 1);
+  check_find(v);
+  check_find(~v);
+  check_find(v << 37);
+  check_find(v >> 64);
+  assert(v._Find_next(N - 2) == N - 1);
+}
+
+__host__ __device__ constexpr bool test()
+{
+  test_find<0>();
+  test_find<1>();
+  test_find<31>();
+  test_find<32>();
+  test_find<33>();
+  test_find<63>();
+  test_find<64>();
+  test_find<65>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  test_find<1000>(); // not in constexpr because of constexpr evaluation step limits
+  test_find_large<4096>();
+  test_find_large<65536>();
+  static_assert(test(), "");
+
+  return 0;
+}
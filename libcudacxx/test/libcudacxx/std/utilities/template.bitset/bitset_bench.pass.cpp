@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// REQUIRES: benchmarks
+
+// Compares the throughput of the bulk operations of bitset with the ones of the host standard library, on sparse and
+// dense bitsets of the sizes used as filters.
+
+#include <cuda/std/bitset>
+
+#include "host_benchmark.h"
+#include "test_macros.h"
+
+#ifndef __CUDA_ARCH__
+#  include <bitset>
+#  include <cstdio>
+#  include <random>
+
+template <class Fn>
+double million_words_per_second(std::size_t bits, int iterations, Fn fn)
+{
+  std::size_t checksum = 0;
+  const stopwatch watch;
+  for (int i = 0; i < iterations; ++i)
+  {
+    checksum += fn(i);
+  }
+  const double seconds = watch.seconds();
+  DoNotOptimize(checksum);
+  return static_cast<double>(bits / 64) * iterations / seconds / 1e6;
+}
+
+template <class Bitset>
+std::size_t visit_set_bits(const Bitset& bs)
+{
+  std::size_t sum = 0;
+  for (std::size_t i = bs._Find_first(); i != bs.size(); i = bs._Find_next(i))
+  {
+    sum += i;
+  }
+  return sum;
+}
+
+template <std::size_t N>
+void bench_size(const char* density, unsigned one_in)
+{
+  // Large bitsets don't fit on the stack of every platform.
+  static cuda::std::bitset<N> ours[2];
+  static std::bitset<N> host[2];
+  std::mt19937_64 gen(42);
+  for (int j = 0; j < 2; ++j)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      const bool bit = gen() % one_in == 0;
+      ours[j][i]     = bit;
+      host[j][i]     = bit;
+    }
+  }
+
+  const int iterations = static_cast<int>(2000000 / (N / 64));
+  const auto report    = [&](const char* op, double ours_rate, double host_rate) {
+    std::printf("%6zu bits, %-7s %-14s %12.1f Mw/s %12.1f Mw/s\n", N, density, op, ours_rate, host_rate);
+  };
+
+  report("count",
+         million_words_per_second(N, iterations, [&](int) {
+           ours[0].flip(0);
+           return ours[0].count();
+         }),
+         million_words_per_second(N, iterations, [&](int) {
+           host[0].flip(0);
+           return host[0].count();
+         }));
+  report("find first/next",
+         million_words_per_second(N, iterations / 4, [&](int) {
+           ours[0].flip(0);
+           return visit_set_bits(ours[0]);
+         }),
+         million_words_per_second(N, iterations / 4, [&](int) {
+           host[0].flip(0);
+#  if defined(__GLIBCXX__)
+           return visit_set_bits(host[0]);
+#  else // ^^^ __GLIBCXX__ ^^^ / vvv !__GLIBCXX__ vvv
+           std::size_t sum = 0;
+           for (std::size_t i = 0; i != N; ++i)
+           {
+             sum += host[0][i] ? i : 0;
+           }
+           return sum;
+#  endif // !__GLIBCXX__
+         }));
+  report("and/or/xor",
+         million_words_per_second(N, iterations, [&](int) {
+           ours[0] &= ours[1];
+           ours[0] |= ours[1];
+           ours[0] ^= ours[1];
+           return static_cast<std::size_t>(ours[0][0]);
+         }),
+         million_words_per_second(N, iterations, [&](int) {
+           host[0] &= host[1];
+           host[0] |= host[1];
+           host[0] ^= host[1];
+           return static_cast<std::size_t>(host[0][0]);
+         }));
+  report("shifts",
+         million_words_per_second(N, iterations, [&](int i) {
+           ours[1] <<= static_cast<std::size_t>(i % 67);
+           ours[1] >>= static_cast<std::size_t>(i % 67);
+           return static_cast<std::size_t>(ours[1][N - 1]);
+         }),
+         million_words_per_second(N, iterations, [&](int i) {
+           host[1] <<= static_cast<std::size_t>(i % 67);
+           host[1] >>= static_cast<std::size_t>(i % 67);
+           return static_cast<std::size_t>(host[1][N - 1]);
+         }));
+}
+
+void bench()
+{
+  std::printf("%-36s %16s %17s\n", "input", "cuda::std", "std");
+
+  bench_size<4096>("sparse", 64);
+  bench_size<4096>("dense", 2);
+  bench_size<65536>("sparse", 64);
+  bench_size<65536>("dense", 2);
+}
+#endif // !__CUDA_ARCH__
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench();))
+
+  return 0;
+}
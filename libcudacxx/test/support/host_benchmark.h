@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Helpers for the host benchmarks of the test suite. These are *_bench.pass.cpp tests marked with
+// `REQUIRES: benchmarks`, which only run when lit is given `--param=benchmarks=true`, and print their measurements
+// rather than check them.
+
+#ifndef SUPPORT_HOST_BENCHMARK_H
+#define SUPPORT_HOST_BENCHMARK_H
+
+#ifndef __CUDA_ARCH__
+#  include <chrono>
+
+// Measures the time elapsed since its construction.
+class stopwatch
+{
+  std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+
+public:
+  double seconds() const
+  {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+  }
+};
+#endif // !__CUDA_ARCH__
+
+#endif // SUPPORT_HOST_BENCHMARK_H
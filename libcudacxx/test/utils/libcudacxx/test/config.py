@@ -638,6 +638,11 @@ class Configuration(object):
         if self.long_tests:
             self.config.available_features.add("long_tests")
 
+        # The host benchmarks print timings rather than check anything, so they
+        # only run when asked for, with REQUIRES: benchmarks
+        if self.get_lit_bool("benchmarks", default=False):
+            self.config.available_features.add("benchmarks")
+
         if not self.get_lit_bool("enable_filesystem", default=True):
             self.config.available_features.add("c++filesystem-disabled")
             self.config.available_features.add("dylib-has-no-filesystem")
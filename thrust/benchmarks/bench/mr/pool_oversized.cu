@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+#include <thrust/random.h>
+
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using pool_resource = thrust::mr::unsynchronized_pool_resource<thrust::mr::new_delete_resource>;
+using disjoint_pool_resource =
+  thrust::mr::disjoint_unsynchronized_pool_resource<thrust::mr::new_delete_resource, thrust::mr::new_delete_resource>;
+
+// Measures the latency of oversized allocations served from a pool resource
+// which caches many oversized blocks of varied sizes.
+template <typename Pool>
+static void oversized(nvbench::state& state, Pool& pool)
+{
+  const auto cached_blocks = static_cast<std::size_t>(state.get_int64("CachedBlocks"));
+  const auto requests      = static_cast<std::size_t>(state.get_int64("Requests"));
+
+  // anything above 4 KiB is oversized
+  const std::size_t min_size = std::size_t{8} << 10;
+  const std::size_t max_size = std::size_t{64} << 10;
+
+  thrust::default_random_engine engine;
+  thrust::uniform_int_distribution<std::size_t> size_distribution(min_size, max_size);
+
+  // fill the cache
+  std::vector<std::pair<void*, std::size_t>> blocks(cached_blocks);
+  for (auto& block : blocks)
+  {
+    block.second = size_distribution(engine);
+    block.first  = pool.do_allocate(block.second);
+  }
+  for (auto& block : blocks)
+  {
+    pool.do_deallocate(block.first, block.second);
+  }
+
+  std::vector<std::pair<void*, std::size_t>> allocations(requests);
+  for (auto& allocation : allocations)
+  {
+    allocation.second = size_distribution(engine);
+  }
+
+  state.add_element_count(requests);
+
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::no_batch, [&](nvbench::launch&, auto& timer) {
+    timer.start();
+    for (auto& allocation : allocations)
+    {
+      allocation.first = pool.do_allocate(allocation.second);
+    }
+    for (auto& allocation : allocations)
+    {
+      pool.do_deallocate(allocation.first, allocation.second);
+    }
+    timer.stop();
+  });
+}
+
+static thrust::mr::pool_options options()
+{
+  thrust::mr::pool_options opts = pool_resource::get_default_options();
+  opts.largest_block_size       = std::size_t{4} << 10;
+  return opts;
+}
+
+static void pool(nvbench::state& state)
+{
+  thrust::mr::new_delete_resource upstream;
+  pool_resource pool(&upstream, options());
+
+  oversized(state, pool);
+}
+
+static void disjoint_pool(nvbench::state& state)
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+  disjoint_pool_resource pool(&upstream, &bookkeeper, options());
+
+  oversized(state, pool);
+}
+
+NVBENCH_BENCH(pool)
+  .set_name("pool")
+  .add_int64_power_of_two_axis("CachedBlocks", nvbench::range(4, 12, 4))
+  .add_int64_axis("Requests", {1, 64});
+
+NVBENCH_BENCH(disjoint_pool)
+  .set_name("disjoint_pool")
+  .add_int64_power_of_two_axis("CachedBlocks", nvbench::range(4, 12, 4))
+  .add_int64_axis("Requests", {1, 64});
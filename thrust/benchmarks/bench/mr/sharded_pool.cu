@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Copyright (c) 2011-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the NVIDIA CORPORATION nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL NVIDIA CORPORATION BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/sharded_pool.h>
+#include <thrust/mr/sync_pool.h>
+
+#include <thread>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+using sync_pool    = thrust::mr::synchronized_pool_resource<thrust::mr::new_delete_resource>;
+using sharded_pool = thrust::mr::sharded_pool_resource<thrust::mr::new_delete_resource>;
+
+// Measures the throughput of a pool resource shared by many threads, each of which allocates and frees batches of
+// small, temporary blocks.
+template <typename Pool>
+static void concurrent(nvbench::state& state)
+{
+  const auto threads    = static_cast<int>(state.get_int64("Threads"));
+  const auto batch      = static_cast<std::size_t>(state.get_int64("Batch"));
+  const std::size_t ops = 1 << 12;
+
+  thrust::mr::new_delete_resource upstream;
+  Pool pool(&upstream);
+
+  state.add_element_count(threads * ops * batch);
+
+  state.exec(nvbench::exec_tag::timer | nvbench::exec_tag::no_batch, [&](nvbench::launch&, auto& timer) {
+    std::vector<std::thread> workers;
+    timer.start();
+    for (int thread = 0; thread < threads; ++thread)
+    {
+      workers.emplace_back([&, thread] {
+        std::vector<void*> blocks(batch);
+        for (std::size_t op = 0; op < ops; ++op)
+        {
+          for (std::size_t i = 0; i < batch; ++i)
+          {
+            blocks[i] = pool.do_allocate(std::size_t{16} << ((thread + op + i) % 8));
+          }
+          for (std::size_t i = 0; i < batch; ++i)
+          {
+            pool.do_deallocate(blocks[i], std::size_t{16} << ((thread + op + i) % 8));
+          }
+        }
+      });
+    }
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+    timer.stop();
+  });
+}
+
+static void synchronized(nvbench::state& state)
+{
+  concurrent<sync_pool>(state);
+}
+
+static void sharded(nvbench::state& state)
+{
+  concurrent<sharded_pool>(state);
+}
+
+NVBENCH_BENCH(synchronized)
+  .set_name("synchronized_pool")
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 6, 1))
+  .add_int64_axis("Batch", {1, 64});
+
+NVBENCH_BENCH(sharded)
+  .set_name("sharded_pool")
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 6, 1))
+  .add_int64_axis("Batch", {1, 64});
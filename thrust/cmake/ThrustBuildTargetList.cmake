@@ -6,8 +6,13 @@
 #  - Each item is the name of a thrust interface target that is configured for a
 #    certain combination of host/device/dialect.
 #
+# THRUST_HEADER_TEST_TARGETS
+#  - Built by the calling the `thrust_build_target_list()` function.
+#  - Like THRUST_TARGETS, but for configurations that only get their headers
+#    tested: the mixed OMP/TBB host/device combinations not in the workload.
+#
 # thrust_build_target_list()
-# - Creates the THRUST_TARGETS list.
+# - Creates the THRUST_TARGETS and THRUST_HEADER_TEST_TARGETS lists.
 #
 # The following functions can be used to test/set metadata on a thrust target:
 #
@@ -106,9 +111,14 @@ endfunction()
 
 function(_thrust_init_target_list)
   set(THRUST_TARGETS "" CACHE INTERNAL "" FORCE)
+  set(THRUST_HEADER_TEST_TARGETS "" CACHE INTERNAL "" FORCE)
 endfunction()
 
 function(_thrust_add_target_to_target_list target_name host device dialect prefix)
+  _thrust_add_target_to_list(THRUST_TARGETS ${target_name} ${host} ${device} ${dialect} ${prefix})
+endfunction()
+
+function(_thrust_add_target_to_list list_name target_name host device dialect prefix)
   thrust_set_target_properties(${target_name} ${host} ${device} ${dialect} ${prefix})
 
   # dialect-specific interface:
@@ -116,7 +126,7 @@ function(_thrust_add_target_to_target_list target_name host device dialect prefi
     thrust.compiler_interface_cpp${dialect}
   )
 
-  set(THRUST_TARGETS ${THRUST_TARGETS} ${target_name} CACHE INTERNAL "" FORCE)
+  set(${list_name} ${${list_name}} ${target_name} CACHE INTERNAL "" FORCE)
 
   set(label "${host}.${device}.cpp${dialect}")
   string(TOLOWER "${label}" label)
@@ -187,35 +197,62 @@ function(_thrust_build_target_list_multiconfig)
       foreach(dialect IN LISTS THRUST_CPP_DIALECT_OPTIONS)
         _thrust_is_config_valid(config_valid ${host} ${device} ${dialect})
         if (config_valid)
-          set(prefix "thrust.${host}.${device}.cpp${dialect}")
-          string(TOLOWER "${prefix}" prefix)
-
-          # Configure a thrust interface target for this host/device
-          set(target_name "${prefix}")
-          thrust_create_target(${target_name}
-            HOST ${host}
-            DEVICE ${device}
-            DISPATCH ${THRUST_DISPATCH_TYPE}
-            ${THRUST_TARGET_FLAGS}
-          )
-
-          # Set configuration metadata for this thrust interface target:
-          _thrust_add_target_to_target_list(${target_name}
-            ${host} ${device} ${dialect} ${prefix}
-          )
-
-          # Create a meta target for all targets in this configuration:
-          add_custom_target(${prefix}.all)
-          add_dependencies(thrust.all ${prefix}.all)
+          _thrust_create_config_target(THRUST_TARGETS ${host} ${device} ${dialect})
         endif()
       endforeach() # dialects
     endforeach() # devices
   endforeach() # hosts
 
+  # Build THRUST_HEADER_TEST_TARGETS. The OMP and TBB backends reach each
+  # other's headers through the public algorithm headers, so mixing them must
+  # compile even when the workload doesn't build those configurations.
+  if (THRUST_MULTICONFIG_ENABLE_SYSTEM_OMP AND THRUST_MULTICONFIG_ENABLE_SYSTEM_TBB)
+    foreach(config IN ITEMS OMP_TBB TBB_OMP)
+      if (config IN_LIST THRUST_MULTICONFIG_WORKLOAD_${THRUST_MULTICONFIG_WORKLOAD}_CONFIGS)
+        continue()
+      endif()
+
+      string(REPLACE "_" ";" systems "${config}")
+      list(GET systems 0 host)
+      list(GET systems 1 device)
+
+      foreach(dialect IN LISTS THRUST_CPP_DIALECT_OPTIONS)
+        if (THRUST_MULTICONFIG_ENABLE_DIALECT_CPP${dialect})
+          _thrust_create_config_target(THRUST_HEADER_TEST_TARGETS ${host} ${device} ${dialect})
+        endif()
+      endforeach() # dialects
+    endforeach() # configs
+  endif()
+
   list(LENGTH THRUST_TARGETS count)
   message(STATUS "${count} unique thrust.host.device.dialect configurations generated")
 endfunction()
 
+# Create the thrust interface target of a host/device/dialect configuration
+# and append it to ${list_name}.
+function(_thrust_create_config_target list_name host device dialect)
+  set(prefix "thrust.${host}.${device}.cpp${dialect}")
+  string(TOLOWER "${prefix}" prefix)
+
+  # Configure a thrust interface target for this host/device
+  set(target_name "${prefix}")
+  thrust_create_target(${target_name}
+    HOST ${host}
+    DEVICE ${device}
+    DISPATCH ${THRUST_DISPATCH_TYPE}
+    ${THRUST_TARGET_FLAGS}
+  )
+
+  # Set configuration metadata for this thrust interface target:
+  _thrust_add_target_to_list(${list_name} ${target_name}
+    ${host} ${device} ${dialect} ${prefix}
+  )
+
+  # Create a meta target for all targets in this configuration:
+  add_custom_target(${prefix}.all)
+  add_dependencies(thrust.all ${prefix}.all)
+endfunction()
+
 function(_thrust_build_target_list_singleconfig)
   set(host ${THRUST_HOST_SYSTEM})
   set(device ${THRUST_DEVICE_SYSTEM})
@@ -128,7 +128,7 @@ function(thrust_add_header_test thrust_target label definitions)
   add_dependencies(${config_prefix}.all ${headertest_target})
 endfunction()
 
-foreach(thrust_target IN LISTS THRUST_TARGETS)
+foreach(thrust_target IN LISTS THRUST_TARGETS THRUST_HEADER_TEST_TARGETS)
   thrust_add_header_test(${thrust_target} base "")
 
   # Wrap Thrust/CUB in a custom namespace to check proper use of ns macros:
@@ -4,6 +4,7 @@
 #include <thrust/iterator/retag.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/merge.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/unique.h>
 
@@ -319,3 +320,66 @@ void TestMergeByKeyFromCuDFDremel()
   ASSERT_EQUAL(reference_def_level, def_level);
 }
 DECLARE_UNITTEST(TestMergeByKeyFromCuDFDremel);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+// The parallel backends split the merge into tiles. Runs of equal keys span the tiles, and the values tell whether the
+// elements of the first range still come first.
+void TestMergeByKeyAcrossTilesHelper(size_t n, int distinct_keys)
+{
+  thrust::host_vector<int> h_a_keys(n);
+  thrust::host_vector<int> h_b_keys(n / 3);
+  for (size_t i = 0; i < h_a_keys.size(); ++i)
+  {
+    h_a_keys[i] = static_cast<int>(i * distinct_keys / h_a_keys.size());
+  }
+  for (size_t i = 0; i < h_b_keys.size(); ++i)
+  {
+    h_b_keys[i] = static_cast<int>(i * distinct_keys / h_b_keys.size());
+  }
+  thrust::host_vector<int> h_a_vals(h_a_keys.size());
+  thrust::host_vector<int> h_b_vals(h_b_keys.size());
+  thrust::sequence(h_a_vals.begin(), h_a_vals.end());
+  thrust::sequence(h_b_vals.begin(), h_b_vals.end(), static_cast<int>(n));
+
+  const thrust::device_vector<int> d_a_keys = h_a_keys;
+  const thrust::device_vector<int> d_b_keys = h_b_keys;
+  const thrust::device_vector<int> d_a_vals = h_a_vals;
+  const thrust::device_vector<int> d_b_vals = h_b_vals;
+
+  thrust::host_vector<int> h_result_keys(h_a_keys.size() + h_b_keys.size());
+  thrust::host_vector<int> h_result_vals(h_result_keys.size());
+  thrust::device_vector<int> d_result_keys(h_result_keys.size());
+  thrust::device_vector<int> d_result_vals(h_result_keys.size());
+
+  thrust::merge_by_key(
+    h_a_keys.begin(),
+    h_a_keys.end(),
+    h_b_keys.begin(),
+    h_b_keys.end(),
+    h_a_vals.begin(),
+    h_b_vals.begin(),
+    h_result_keys.begin(),
+    h_result_vals.begin());
+  thrust::merge_by_key(
+    d_a_keys.begin(),
+    d_a_keys.end(),
+    d_b_keys.begin(),
+    d_b_keys.end(),
+    d_a_vals.begin(),
+    d_b_vals.begin(),
+    d_result_keys.begin(),
+    d_result_vals.begin());
+
+  ASSERT_EQUAL(h_result_keys, d_result_keys);
+  ASSERT_EQUAL(h_result_vals, d_result_vals);
+}
+
+void TestMergeByKeyAcrossTiles()
+{
+  TestMergeByKeyAcrossTilesHelper(1000, 1);
+  TestMergeByKeyAcrossTilesHelper(1000, 3);
+  TestMergeByKeyAcrossTilesHelper(100000, 5);
+  TestMergeByKeyAcrossTilesHelper(100000, 1000);
+}
+DECLARE_UNITTEST(TestMergeByKeyAcrossTiles);
+#endif
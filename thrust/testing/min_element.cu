@@ -1,6 +1,8 @@
 #include <thrust/extrema.h>
 #include <thrust/iterator/retag.h>
 
+#include <cuda/std/limits>
+
 #include <unittest/unittest.h>
 
 template <class Vector>
@@ -55,6 +57,33 @@ void TestMinElement(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestMinElement);
 
+// NaNs are unordered, so which element is found is unspecified, but it must be an element of the range. A stride of
+// one puts a NaN at the start of every tile of the parallel backends.
+void TestMinElementWithNaNHelper(size_t n, size_t stride)
+{
+  thrust::host_vector<double> h_data(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_data[i] = i % stride == 0 ? ::cuda::std::numeric_limits<double>::quiet_NaN() : static_cast<double>(n - i);
+  }
+  thrust::device_vector<double> d_data = h_data;
+
+  ASSERT_LESS(thrust::min_element(d_data.begin(), d_data.end()) - d_data.begin(), static_cast<std::ptrdiff_t>(n));
+  ASSERT_LESS(thrust::min_element(d_data.begin(), d_data.end(), ::cuda::std::greater<double>()) - d_data.begin(),
+              static_cast<std::ptrdiff_t>(n));
+}
+
+void TestMinElementWithNaN()
+{
+  for (size_t stride : {1, 2, 3, 17})
+  {
+    TestMinElementWithNaNHelper(17, stride);
+    TestMinElementWithNaNHelper(1000, stride);
+    TestMinElementWithNaNHelper(100000, stride);
+  }
+}
+DECLARE_UNITTEST(TestMinElementWithNaN);
+
 template <typename ForwardIterator>
 ForwardIterator min_element(my_system& system, ForwardIterator first, ForwardIterator)
 {
@@ -1,6 +1,8 @@
 #include <thrust/extrema.h>
 #include <thrust/iterator/retag.h>
 
+#include <cuda/std/limits>
+
 #include <unittest/unittest.h>
 
 template <class Vector>
@@ -62,6 +64,37 @@ void TestMinMaxElement(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestMinMaxElement);
 
+// NaNs are unordered, so which element is found is unspecified, but it must be an element of the range. A stride of
+// one puts a NaN at the start of every tile of the parallel backends.
+void TestMinMaxElementWithNaNHelper(size_t n, size_t stride)
+{
+  thrust::host_vector<double> h_data(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_data[i] = i % stride == 0 ? ::cuda::std::numeric_limits<double>::quiet_NaN() : static_cast<double>(n - i);
+  }
+  thrust::device_vector<double> d_data = h_data;
+
+  const auto result = thrust::minmax_element(d_data.begin(), d_data.end());
+  ASSERT_LESS(result.first - d_data.begin(), static_cast<std::ptrdiff_t>(n));
+  ASSERT_LESS(result.second - d_data.begin(), static_cast<std::ptrdiff_t>(n));
+
+  const auto greater = thrust::minmax_element(d_data.begin(), d_data.end(), ::cuda::std::greater<double>());
+  ASSERT_LESS(greater.first - d_data.begin(), static_cast<std::ptrdiff_t>(n));
+  ASSERT_LESS(greater.second - d_data.begin(), static_cast<std::ptrdiff_t>(n));
+}
+
+void TestMinMaxElementWithNaN()
+{
+  for (size_t stride : {1, 2, 3, 17})
+  {
+    TestMinMaxElementWithNaNHelper(17, stride);
+    TestMinMaxElementWithNaNHelper(1000, stride);
+    TestMinMaxElementWithNaNHelper(100000, stride);
+  }
+}
+DECLARE_UNITTEST(TestMinMaxElementWithNaN);
+
 template <typename ForwardIterator>
 thrust::pair<ForwardIterator, ForwardIterator> minmax_element(my_system& system, ForwardIterator first, ForwardIterator)
 {
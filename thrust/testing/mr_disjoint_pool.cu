@@ -510,3 +510,87 @@ void TestDisjointSynchronizedPoolSqueeze()
   TestDisjointPoolSqueeze<thrust::mr::disjoint_synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolSqueeze);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolStatsAndTrim()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  upstream.id_to_allocate = 1;
+  alloc_id a1             = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+  alloc_id a2             = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  upstream.id_to_allocate = 2;
+  alloc_id a3             = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  upstream.id_to_allocate = 3;
+  alloc_id a4             = pool.do_allocate(8192, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  thrust::mr::pool_stats stats       = pool.stats();
+  const std::size_t blocks_per_chunk = stats.buckets[2].free_blocks + 2;
+  ASSERT_EQUAL(stats.buckets[2].block_size, 64u);
+  ASSERT_EQUAL(stats.chunks, 1u);
+  ASSERT_EQUAL(stats.oversized_blocks, 2u);
+  ASSERT_EQUAL(stats.upstream_bytes, upstream.used_bytes);
+  ASSERT_EQUAL(stats.cached_bytes, (blocks_per_chunk - 2) * 64);
+
+  // the counters are only maintained when THRUST_MR_ENABLE_POOL_STATS is defined
+  ASSERT_EQUAL(stats.buckets[2].hits, 0u);
+  ASSERT_EQUAL(stats.upstream_allocations, 0u);
+
+  pool.do_deallocate(a1, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a3, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a4, 8192, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  stats = pool.stats();
+  ASSERT_EQUAL(stats.cached_oversized_blocks, 2u);
+  ASSERT_EQUAL(stats.cached_bytes, (blocks_per_chunk - 1) * 64 + 4096 + 8192);
+
+  // trimming returns the largest cached oversized blocks first
+  upstream.id_to_deallocate = 3;
+  ASSERT_EQUAL(pool.trim(4096 + (blocks_per_chunk - 1) * 64), 8192u);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  // chunks which are still in use are kept
+  upstream.id_to_deallocate = 2;
+  ASSERT_EQUAL(pool.trim(), 4096u);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  stats = pool.stats();
+  ASSERT_EQUAL(stats.chunks, 1u);
+  ASSERT_EQUAL(stats.oversized_blocks, 0u);
+  ASSERT_EQUAL(stats.upstream_bytes, upstream.used_bytes);
+
+  // and idle ones are returned to upstream
+  pool.do_deallocate(a2, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+  upstream.id_to_deallocate = 1;
+  ASSERT_EQUAL(pool.trim(), blocks_per_chunk * 64);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+  ASSERT_EQUAL(upstream.used_bytes, 0u);
+
+  stats = pool.stats();
+  ASSERT_EQUAL(stats.chunks, 0u);
+  ASSERT_EQUAL(stats.upstream_bytes, 0u);
+  ASSERT_EQUAL(stats.cached_bytes, 0u);
+}
+
+void TestDisjointUnsynchronizedPoolStatsAndTrim()
+{
+  TestDisjointPoolStatsAndTrim<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolStatsAndTrim);
+
+void TestDisjointSynchronizedPoolStatsAndTrim()
+{
+  TestDisjointPoolStatsAndTrim<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolStatsAndTrim);
@@ -0,0 +1,116 @@
+#include <thrust/fill.h>
+#include <thrust/mr/mmap.h>
+#include <thrust/mr/pool.h>
+
+#include <limits>
+
+#include <unittest/unittest.h>
+
+void TestMmapResourceAlignedAllocation(thrust::mr::mmap_resource_options options)
+{
+  thrust::mr::mmap_resource memres(options);
+
+  for (std::size_t size : {std::size_t{1}, std::size_t{100}, std::size_t{4096}, std::size_t{3 * 1024 * 1024 + 1}})
+  {
+    for (std::size_t alignment = 16; alignment <= 4 * 1024 * 1024; alignment <<= 4)
+    {
+      void* ptr = memres.do_allocate(size, alignment);
+      ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+
+      char* char_ptr = reinterpret_cast<char*>(ptr);
+      thrust::fill(char_ptr, char_ptr + size, char{1});
+      ASSERT_EQUAL(char_ptr[size - 1], 1);
+
+      memres.do_deallocate(ptr, size, alignment);
+    }
+  }
+}
+
+void TestMmapResourceRegularPages()
+{
+  thrust::mr::mmap_resource_options options = thrust::mr::mmap_resource::get_default_options();
+  options.huge_pages                        = thrust::mr::mmap_huge_pages::none;
+
+  TestMmapResourceAlignedAllocation(options);
+}
+DECLARE_UNITTEST(TestMmapResourceRegularPages);
+
+void TestMmapResourceTransparentHugePages()
+{
+  TestMmapResourceAlignedAllocation(thrust::mr::mmap_resource::get_default_options());
+}
+DECLARE_UNITTEST(TestMmapResourceTransparentHugePages);
+
+void TestMmapResourceExplicitHugePages()
+{
+  // falls back to regular mappings when no huge pages are reserved
+  thrust::mr::mmap_resource_options options = thrust::mr::mmap_resource::get_default_options();
+  options.huge_pages                        = thrust::mr::mmap_huge_pages::explicit_pages;
+
+  TestMmapResourceAlignedAllocation(options);
+}
+DECLARE_UNITTEST(TestMmapResourceExplicitHugePages);
+
+void TestMmapResourceOverflow(thrust::mr::mmap_resource_options options)
+{
+  thrust::mr::mmap_resource memres(options);
+
+  // rounding up to the page size wraps around
+  const std::size_t max_size = (std::numeric_limits<std::size_t>::max)();
+  ASSERT_THROWS(memres.do_allocate(max_size), std::bad_alloc);
+
+  // the size fits after rounding, but together with the slack for the alignment it wraps around to a small mapping
+  const std::size_t alignment = std::size_t{1} << (std::numeric_limits<std::size_t>::digits - 2);
+  ASSERT_THROWS(memres.do_allocate(max_size - alignment + 8192, alignment), std::bad_alloc);
+}
+
+void TestMmapResourceAllocationTooLarge()
+{
+  thrust::mr::mmap_resource_options options = thrust::mr::mmap_resource::get_default_options();
+
+  options.huge_pages = thrust::mr::mmap_huge_pages::none;
+  TestMmapResourceOverflow(options);
+
+  options.huge_pages = thrust::mr::mmap_huge_pages::transparent;
+  TestMmapResourceOverflow(options);
+
+  options.huge_pages = thrust::mr::mmap_huge_pages::explicit_pages;
+  TestMmapResourceOverflow(options);
+}
+DECLARE_UNITTEST(TestMmapResourceAllocationTooLarge);
+
+void TestMmapResourceNumaPolicy()
+{
+  // node 0 always exists; on systems without NUMA support, the policy has no effect
+  thrust::mr::mmap_resource_options options = thrust::mr::mmap_resource::get_default_options();
+  options.nodes                             = 1;
+
+  options.numa_policy = thrust::mr::mmap_numa_policy::bind;
+  TestMmapResourceAlignedAllocation(options);
+
+  options.numa_policy = thrust::mr::mmap_numa_policy::interleave;
+  TestMmapResourceAlignedAllocation(options);
+
+  options.numa_policy = thrust::mr::mmap_numa_policy::preferred;
+  TestMmapResourceAlignedAllocation(options);
+}
+DECLARE_UNITTEST(TestMmapResourceNumaPolicy);
+
+void TestMmapResourceAsPoolUpstream()
+{
+  thrust::mr::mmap_resource upstream;
+  thrust::mr::unsynchronized_pool_resource<thrust::mr::mmap_resource> pool(&upstream);
+
+  void* a = pool.do_allocate(64, 16);
+  void* b = pool.do_allocate(64, 16);
+  void* c = pool.do_allocate(8 * 1024 * 1024, 4096);
+  ASSERT_NOT_EQUAL(a, b);
+  ASSERT_EQUAL(reinterpret_cast<std::size_t>(c) % 4096, 0u);
+
+  thrust::fill(static_cast<char*>(c), static_cast<char*>(c) + 8 * 1024 * 1024, char{});
+
+  pool.do_deallocate(c, 8 * 1024 * 1024, 4096);
+  pool.do_deallocate(b, 64, 16);
+  pool.do_deallocate(a, 64, 16);
+}
+DECLARE_UNITTEST(TestMmapResourceAsPoolUpstream);
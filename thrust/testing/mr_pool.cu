@@ -2,8 +2,14 @@
 
 #include <thrust/mr/new.h>
 #include <thrust/mr/pool.h>
+#include <thrust/mr/sharded_pool.h>
 #include <thrust/mr/sync_pool.h>
 
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename T>
@@ -244,6 +250,12 @@ void TestSynchronizedPool()
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
 
+void TestShardedPool()
+{
+  TestPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPool);
+
 template <template <typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -285,6 +297,26 @@ void TestPoolCachingOversized()
   tracked_pointer<void> a5 = pool.do_allocate(32, 64);
   ASSERT_EQUAL(a5.id, 3u);
 
+  pool.do_deallocate(a3, 32, 32);
+  pool.do_deallocate(a5, 32, 64);
+
+  // make sure that the smallest suitable cached block is used, even when a larger
+  // one has been cached more recently
+  upstream.id_to_allocate   = 9;
+  tracked_pointer<void> a12 = pool.do_allocate(16384, 32);
+  ASSERT_EQUAL(a12.id, 9u);
+
+  pool.do_deallocate(a12, 16384, 32);
+
+  tracked_pointer<void> a13 = pool.do_allocate(1500, 32);
+  ASSERT_EQUAL(a13.id, 1u);
+
+  tracked_pointer<void> a14 = pool.do_allocate(5000, 32);
+  ASSERT_EQUAL(a14.id, 9u);
+
+  pool.do_deallocate(a14, 5000, 32);
+  pool.do_deallocate(a13, 1500, 32);
+
   pool.release();
 
   // make sure that release actually clears caches
@@ -353,6 +385,12 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+void TestShardedPoolCachingOversized()
+{
+  TestPoolCachingOversized<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolCachingOversized);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -372,3 +410,95 @@ void TestSynchronizedGlobalPool()
   TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+void TestShardedGlobalPool()
+{
+  TestGlobalPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedGlobalPool);
+
+template <template <typename> class PoolTemplate>
+void TestPoolConcurrent()
+{
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource>;
+
+  thrust::mr::new_delete_resource upstream;
+  Pool pool(&upstream);
+
+  const int num_threads = 8;
+  const int iterations  = 2000;
+  const int batch       = 64;
+
+  std::vector<std::vector<std::pair<char*, std::size_t>>> blocks(num_threads);
+  std::vector<int> failures(num_threads, 0);
+
+  // every thread frees the blocks allocated by its neighbor in the previous iteration, to make blocks migrate
+  // between threads, and checks that no block it owns gets handed out to anyone else in the meantime
+  auto work = [&](int thread, int iteration) {
+    std::vector<std::pair<char*, std::size_t>>& mine = blocks[thread];
+    for (int i = 0; i < batch; ++i)
+    {
+      const std::size_t size = std::size_t{1} << ((thread + iteration + i) % 12);
+      char* p                = static_cast<char*>(pool.do_allocate(size));
+      std::memset(p, thread, size);
+      mine.emplace_back(p, size);
+    }
+    for (const auto& block : mine)
+    {
+      for (std::size_t i = 0; i < block.second; ++i)
+      {
+        if (block.first[i] != static_cast<char>(thread))
+        {
+          ++failures[thread];
+          break;
+        }
+      }
+    }
+  };
+
+  for (int iteration = 0; iteration < iterations / batch; ++iteration)
+  {
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < num_threads; ++thread)
+    {
+      threads.emplace_back(work, thread, iteration);
+    }
+    for (auto& t : threads)
+    {
+      t.join();
+    }
+
+    threads.clear();
+    for (int thread = 0; thread < num_threads; ++thread)
+    {
+      threads.emplace_back([&, thread] {
+        for (const auto& block : blocks[(thread + 1) % num_threads])
+        {
+          pool.do_deallocate(block.first, block.second);
+        }
+      });
+    }
+    for (auto& t : threads)
+    {
+      t.join();
+    }
+    for (auto& mine : blocks)
+    {
+      mine.clear();
+    }
+  }
+
+  ASSERT_EQUAL(std::count(failures.begin(), failures.end(), 0), num_threads);
+}
+
+void TestSynchronizedPoolConcurrent()
+{
+  TestPoolConcurrent<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolConcurrent);
+
+void TestShardedPoolConcurrent()
+{
+  TestPoolConcurrent<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolConcurrent);
@@ -0,0 +1,102 @@
+// count the events in the pools, to test pool_stats; the other pool tests use the default configuration
+#define THRUST_MR_ENABLE_POOL_STATS
+
+#include <thrust/detail/config.h>
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+#include <thrust/mr/sync_pool.h>
+
+#include <unittest/unittest.h>
+
+template <template <typename> class PoolTemplate>
+void TestPoolStatsAndTrim()
+{
+  thrust::mr::new_delete_resource upstream;
+
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, opts);
+
+  thrust::mr::pool_stats stats = pool.stats();
+  ASSERT_EQUAL(stats.upstream_bytes, 0u);
+  ASSERT_EQUAL(stats.cached_bytes, 0u);
+  ASSERT_EQUAL(stats.chunks, 0u);
+  ASSERT_EQUAL(stats.buckets.size(), 7u);
+  ASSERT_EQUAL(stats.buckets[2].block_size, 64u);
+
+  void* a1 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+  void* a2 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+  void* a3 = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  void* a4 = pool.do_allocate(8192, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  stats                              = pool.stats();
+  const std::size_t blocks_per_chunk = stats.buckets[2].free_blocks + 2;
+  ASSERT_EQUAL(stats.chunks, 1u);
+  ASSERT_EQUAL(stats.oversized_blocks, 2u);
+  ASSERT_EQUAL(stats.cached_oversized_blocks, 0u);
+  ASSERT_EQUAL(stats.cached_bytes, (blocks_per_chunk - 2) * 64);
+  ASSERT_EQUAL(stats.buckets[2].hits, 1u);
+  ASSERT_EQUAL(stats.buckets[2].misses, 1u);
+  ASSERT_EQUAL(stats.oversized_misses, 2u);
+  ASSERT_EQUAL(stats.upstream_allocations, 3u);
+  ASSERT_EQUAL(stats.allocated_bytes, 64u + 64u + 4096u + 8192u);
+  ASSERT_EQUAL(stats.peak_upstream_bytes, stats.upstream_bytes);
+
+  pool.do_deallocate(a1, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a3, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a4, 8192, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  stats = pool.stats();
+  ASSERT_EQUAL(stats.cached_oversized_blocks, 2u);
+  ASSERT_EQUAL(stats.cached_bytes, (blocks_per_chunk - 1) * 64 + 4096 + 8192);
+  ASSERT_EQUAL(stats.allocated_bytes, 64u);
+  ASSERT_EQUAL(stats.peak_allocated_bytes, 64u + 64u + 4096u + 8192u);
+
+  // trimming returns the largest cached oversized blocks first
+  ASSERT_EQUAL(pool.trim(4096 + (blocks_per_chunk - 1) * 64) > 8192u, true);
+  stats = pool.stats();
+  ASSERT_EQUAL(stats.cached_oversized_blocks, 1u);
+  ASSERT_EQUAL(stats.cached_bytes, (blocks_per_chunk - 1) * 64 + 4096);
+
+  // chunks which are still in use are kept
+  pool.trim();
+  stats = pool.stats();
+  ASSERT_EQUAL(stats.cached_oversized_blocks, 0u);
+  ASSERT_EQUAL(stats.oversized_blocks, 0u);
+  ASSERT_EQUAL(stats.chunks, 1u);
+  ASSERT_EQUAL(stats.cached_bytes, (blocks_per_chunk - 1) * 64);
+
+  // and idle ones are returned to upstream
+  pool.do_deallocate(a2, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.trim();
+  stats = pool.stats();
+  ASSERT_EQUAL(stats.chunks, 0u);
+  ASSERT_EQUAL(stats.upstream_bytes, 0u);
+  ASSERT_EQUAL(stats.cached_bytes, 0u);
+  ASSERT_EQUAL(stats.buckets[2].free_blocks, 0u);
+  ASSERT_EQUAL(stats.upstream_deallocations, 3u);
+
+  // the pool still works after trimming
+  void* a5 = pool.do_allocate(64, THRUST_MR_DEFAULT_ALIGNMENT);
+  stats    = pool.stats();
+  ASSERT_EQUAL(stats.chunks, 1u);
+  ASSERT_EQUAL(stats.buckets[2].free_blocks, blocks_per_chunk - 1);
+  pool.do_deallocate(a5, 64, THRUST_MR_DEFAULT_ALIGNMENT);
+}
+
+void TestUnsynchronizedPoolStatsAndTrim()
+{
+  TestPoolStatsAndTrim<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolStatsAndTrim);
+
+void TestSynchronizedPoolStatsAndTrim()
+{
+  TestPoolStatsAndTrim<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolStatsAndTrim);
@@ -0,0 +1,115 @@
+#include <thrust/host_vector.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/system/omp/vector.h>
+
+#include <unittest/unittest.h>
+
+#include <omp.h>
+
+// records the thread which constructed it
+struct first_touch
+{
+  int thread;
+  int value;
+
+  first_touch()
+      : thread(omp_get_thread_num())
+      , value(0)
+  {}
+
+  first_touch(int value)
+      : thread(omp_get_thread_num())
+      , value(value)
+  {}
+
+  first_touch(const first_touch& other)
+      : thread(omp_get_thread_num())
+      , value(other.value)
+  {}
+
+  first_touch& operator=(const first_touch& other)
+  {
+    value = other.value;
+    return *this;
+  }
+};
+
+// the threads which a traversal of n elements by an omp algorithm assigns to each element
+thrust::host_vector<int> traversal_threads(int n)
+{
+  thrust::host_vector<int> ret(n);
+  int* threads = thrust::raw_pointer_cast(ret.data());
+
+  THRUST_PRAGMA_OMP(parallel for schedule(static))
+  for (int i = 0; i < n; ++i)
+  {
+    threads[i] = omp_get_thread_num();
+  }
+
+  return ret;
+}
+
+template <typename Vector>
+thrust::host_vector<int> construction_threads(const Vector& v)
+{
+  thrust::host_vector<int> ret(v.size());
+  for (std::size_t i = 0; i < v.size(); ++i)
+  {
+    ret[i] = thrust::raw_pointer_cast(v.data())[i].thread;
+  }
+
+  return ret;
+}
+
+void TestOmpVectorFirstTouch()
+{
+  const int n = 1000;
+
+  const thrust::host_vector<int> expected = traversal_threads(n);
+
+  thrust::omp::vector<first_touch> value_initialized(n);
+  ASSERT_EQUAL(construction_threads(value_initialized), expected);
+
+  thrust::omp::vector<first_touch> filled(n, first_touch(13));
+  ASSERT_EQUAL(construction_threads(filled), expected);
+
+  thrust::host_vector<first_touch> h_source(n);
+  for (int i = 0; i < n; ++i)
+  {
+    h_source[i].value = i;
+  }
+
+  // copies from the host system are run by the omp system, which refines it
+  thrust::omp::vector<first_touch> copied(h_source.begin(), h_source.end());
+  ASSERT_EQUAL(construction_threads(copied), expected);
+  for (int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(thrust::raw_pointer_cast(copied.data())[i].value, i);
+  }
+
+  thrust::omp::vector<first_touch> resized;
+  resized.resize(n);
+  ASSERT_EQUAL(construction_threads(resized), expected);
+}
+DECLARE_UNITTEST(TestOmpVectorFirstTouch);
+
+void TestOmpVectorCopyFromHost()
+{
+  const int n = 1000;
+
+  thrust::host_vector<int> h_source(n);
+  for (int i = 0; i < n; ++i)
+  {
+    h_source[i] = i;
+  }
+
+  thrust::omp::vector<int> copied(h_source.begin(), h_source.end());
+  ASSERT_EQUAL(copied, h_source);
+
+  thrust::omp::vector<int> copied_n(h_source);
+  ASSERT_EQUAL(copied_n, h_source);
+
+  thrust::host_vector<int> back(copied.begin(), copied.end());
+  ASSERT_EQUAL(back, h_source);
+}
+DECLARE_UNITTEST(TestOmpVectorCopyFromHost);
@@ -151,6 +151,69 @@ struct TestReduceByKey
 };
 VariableUnitTest<TestReduceByKey, IntegralTypes> TestReduceByKeyInstance;
 
+struct project_second_reduce
+{
+  _CCCL_HOST_DEVICE int operator()(int, int y) const
+  {
+    return y;
+  }
+};
+
+// Segments which span many elements, reduced with an operator which is
+// associative but not commutative.
+void TestReduceByKeyLongSegmentsNonCommutative()
+{
+  const int n = 100000;
+
+  thrust::host_vector<int> h_keys(n);
+  thrust::host_vector<int> h_values(n);
+
+  for (int i = 0; i < n; ++i)
+  {
+    h_keys[i]   = (i / 1000) * (i / 1000) % 7 + (i / 10000);
+    h_values[i] = i;
+  }
+
+  thrust::host_vector<int> h_ref_keys;
+  thrust::host_vector<int> h_ref_values;
+
+  for (int i = 0; i < n; ++i)
+  {
+    if (i == 0 || h_keys[i - 1] != h_keys[i])
+    {
+      h_ref_keys.push_back(h_keys[i]);
+      h_ref_values.push_back(i);
+    }
+
+    h_ref_values.back() = i;
+  }
+
+  thrust::device_vector<int> d_keys   = h_keys;
+  thrust::device_vector<int> d_values = h_values;
+  thrust::device_vector<int> d_out_keys(n);
+  thrust::device_vector<int> d_out_values(n);
+
+  thrust::pair<thrust::device_vector<int>::iterator, thrust::device_vector<int>::iterator> d_last =
+    thrust::reduce_by_key(
+      d_keys.begin(),
+      d_keys.end(),
+      d_values.begin(),
+      d_out_keys.begin(),
+      d_out_values.begin(),
+      ::cuda::std::equal_to<int>(),
+      project_second_reduce());
+
+  ASSERT_EQUAL(d_last.first - d_out_keys.begin(), static_cast<int>(h_ref_keys.size()));
+  ASSERT_EQUAL(d_last.second - d_out_values.begin(), static_cast<int>(h_ref_values.size()));
+
+  d_out_keys.resize(h_ref_keys.size());
+  d_out_values.resize(h_ref_values.size());
+
+  ASSERT_EQUAL(h_ref_keys, d_out_keys);
+  ASSERT_EQUAL(h_ref_values, d_out_values);
+}
+DECLARE_UNITTEST(TestReduceByKeyLongSegmentsNonCommutative);
+
 template <typename K>
 struct TestReduceByKeyToDiscardIterator
 {
@@ -166,6 +166,34 @@ void TestExclusiveScanByKey(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestExclusiveScanByKey);
 
+template <typename T>
+void TestExclusiveScanByKeyLongSegments(const size_t n)
+{
+  // segments span many elements, so they cross the tile boundaries of the
+  // parallel host backends
+  thrust::host_vector<int> h_keys(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    h_keys[i] = static_cast<int>(i / (n / 3 + 1));
+  }
+  thrust::device_vector<int> d_keys = h_keys;
+
+  thrust::host_vector<T> h_vals(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    h_vals[i] = static_cast<int>(i % 7);
+  }
+  thrust::device_vector<T> d_vals = h_vals;
+
+  thrust::host_vector<T> h_output(n);
+  thrust::device_vector<T> d_output(n);
+
+  thrust::exclusive_scan_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_output.begin(), (T) 11);
+  thrust::exclusive_scan_by_key(d_keys.begin(), d_keys.end(), d_vals.begin(), d_output.begin(), (T) 11);
+  ASSERT_EQUAL(d_output, h_output);
+}
+DECLARE_VARIABLE_UNITTEST(TestExclusiveScanByKeyLongSegments);
+
 template <typename T>
 void TestExclusiveScanByKeyInPlace(const size_t n)
 {
@@ -199,6 +227,11 @@ void TestExclusiveScanByKeyInPlace(const size_t n)
   thrust::exclusive_scan_by_key(h_keys.begin(), h_keys.end(), h_vals.begin(), h_keys.begin(), (T) 11);
   thrust::exclusive_scan_by_key(d_keys.begin(), d_keys.end(), d_vals.begin(), d_keys.begin(), (T) 11);
   ASSERT_EQUAL(d_keys, h_keys);
+
+  // in-place scans: in/out keys aliasing through different iterator types
+  thrust::exclusive_scan_by_key(h_keys.data(), h_keys.data() + n, h_vals.begin(), h_keys.begin(), (T) 11);
+  thrust::exclusive_scan_by_key(d_keys.data(), d_keys.data() + n, d_vals.begin(), d_keys.begin(), (T) 11);
+  ASSERT_EQUAL(d_keys, h_keys);
 }
 DECLARE_VARIABLE_UNITTEST(TestExclusiveScanByKeyInPlace);
 
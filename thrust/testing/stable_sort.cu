@@ -105,6 +105,30 @@ struct TestStableSortSemantics
 VariableUnitTest<TestStableSortSemantics, unittest::type_list<unittest::int8_t, unittest::int16_t, unittest::int32_t>>
   TestStableSortSemanticsInstance;
 
+template <typename T>
+struct TestStableSortMixedSigns
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+    // random_integers are non-negative
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_data[i] = static_cast<T>(h_data[i] - ::cuda::std::numeric_limits<T>::max() / 2);
+    }
+
+    thrust::device_vector<T> d_data = h_data;
+
+    thrust::stable_sort(d_data.begin(), d_data.end());
+    ASSERT_EQUAL(true, thrust::is_sorted(d_data.begin(), d_data.end()));
+
+    thrust::stable_sort(d_data.begin(), d_data.end(), ::cuda::std::greater<T>());
+    ASSERT_EQUAL(true, thrust::is_sorted(d_data.begin(), d_data.end(), ::cuda::std::greater<T>()));
+  }
+};
+VariableUnitTest<TestStableSortMixedSigns, SignedIntegralTypes> TestStableSortMixedSignsInstance;
+
 template <typename T>
 struct comp_mod3
 {
@@ -1,5 +1,6 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
 #include <unittest/unittest.h>
@@ -120,3 +121,36 @@ struct TestStableSortByKeySemantics
 VariableUnitTest<TestStableSortByKeySemantics,
                  unittest::type_list<unittest::uint8_t, unittest::uint16_t, unittest::uint32_t>>
   TestStableSortByKeySemanticsInstance;
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+// The parallel backends merge the sorted tiles in parallel pieces. With few distinct keys, the runs of equivalent keys
+// span the pieces, and the values, which are the original positions, tell whether the order of equivalent keys is kept.
+void TestStableSortByKeyAcrossTilesHelper(size_t n, int distinct_keys)
+{
+  thrust::host_vector<int> h_keys(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<int>((i * 7919) % (10 * distinct_keys));
+  }
+  thrust::host_vector<int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+
+  thrust::device_vector<int> d_keys   = h_keys;
+  thrust::device_vector<int> d_values = h_values;
+
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), less_div_10<int>());
+  thrust::stable_sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), less_div_10<int>());
+
+  ASSERT_EQUAL(h_keys, d_keys);
+  ASSERT_EQUAL(h_values, d_values);
+}
+
+void TestStableSortByKeyAcrossTiles()
+{
+  TestStableSortByKeyAcrossTilesHelper(1000, 1);
+  TestStableSortByKeyAcrossTilesHelper(1000, 3);
+  TestStableSortByKeyAcrossTilesHelper(100000, 5);
+  TestStableSortByKeyAcrossTilesHelper(100003, 1000);
+}
+DECLARE_UNITTEST(TestStableSortByKeyAcrossTiles);
+#endif
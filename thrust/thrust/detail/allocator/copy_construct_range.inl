@@ -79,12 +79,33 @@ struct needs_copy_construct_via_allocator<std::allocator<U>, T>
     : integral_constant<bool, !::cuda::std::is_trivially_copy_constructible<T>::value>
 {};
 
+// the destination system refines the source system (e.g. omp and tbb refine cpp), and can traverse the input in
+// parallel; letting it run the copy constructs the elements with the same threads that later traverse them, instead
+// of having the calling thread touch all of them first
+template <typename FromSystem, typename ToSystem, typename InputIterator>
+struct is_refined_by_to_system
+    : integral_constant<bool,
+                        (::cuda::std::is_convertible<ToSystem, FromSystem>::value
+                         && ::cuda::std::is_convertible<typename iterator_traversal<InputIterator>::type,
+                                                        random_access_traversal_tag>::value)>
+{};
+
+// the copy can be run by the destination system when the source system can convert to it, or refines it
+template <typename FromSystem, typename ToSystem, typename InputIterator>
+struct is_copy_constructible_in_to_system
+    : integral_constant<bool,
+                        (::cuda::std::is_convertible<FromSystem, ToSystem>::value
+                         || is_refined_by_to_system<FromSystem, ToSystem, InputIterator>::value)>
+{};
+
 // XXX it's regrettable that this implementation is copied almost
 //     exactly from system::detail::generic::uninitialized_copy
 //     perhaps generic::uninitialized_copy could call this routine
 //     with a default allocator
 template <typename Allocator, typename FromSystem, typename ToSystem, typename InputIterator, typename Pointer>
-_CCCL_HOST_DEVICE enable_if_convertible_t<FromSystem, ToSystem, Pointer> uninitialized_copy_with_allocator(
+_CCCL_HOST_DEVICE
+::cuda::std::enable_if_t<is_copy_constructible_in_to_system<FromSystem, ToSystem, InputIterator>::value, Pointer>
+uninitialized_copy_with_allocator(
   Allocator& a,
   const thrust::execution_policy<FromSystem>&,
   const thrust::execution_policy<ToSystem>& to_system,
@@ -120,7 +141,9 @@ _CCCL_HOST_DEVICE enable_if_convertible_t<FromSystem, ToSystem, Pointer> uniniti
 //     perhaps generic::uninitialized_copy_n could call this routine
 //     with a default allocator
 template <typename Allocator, typename FromSystem, typename ToSystem, typename InputIterator, typename Size, typename Pointer>
-_CCCL_HOST_DEVICE enable_if_convertible_t<FromSystem, ToSystem, Pointer> uninitialized_copy_with_allocator_n(
+_CCCL_HOST_DEVICE
+::cuda::std::enable_if_t<is_copy_constructible_in_to_system<FromSystem, ToSystem, InputIterator>::value, Pointer>
+uninitialized_copy_with_allocator_n(
   Allocator& a,
   const thrust::execution_policy<FromSystem>&,
   const thrust::execution_policy<ToSystem>& to_system,
@@ -148,7 +171,9 @@ _CCCL_HOST_DEVICE enable_if_convertible_t<FromSystem, ToSystem, Pointer> uniniti
 }
 
 template <typename Allocator, typename FromSystem, typename ToSystem, typename InputIterator, typename Pointer>
-_CCCL_HOST_DEVICE typename disable_if_convertible<FromSystem, ToSystem, Pointer>::type uninitialized_copy_with_allocator(
+_CCCL_HOST_DEVICE
+typename disable_if<is_copy_constructible_in_to_system<FromSystem, ToSystem, InputIterator>::value, Pointer>::type
+uninitialized_copy_with_allocator(
   Allocator&,
   const thrust::execution_policy<FromSystem>& from_system,
   const thrust::execution_policy<ToSystem>& to_system,
@@ -162,7 +187,8 @@ _CCCL_HOST_DEVICE typename disable_if_convertible<FromSystem, ToSystem, Pointer>
 } // end uninitialized_copy_with_allocator()
 
 template <typename Allocator, typename FromSystem, typename ToSystem, typename InputIterator, typename Size, typename Pointer>
-_CCCL_HOST_DEVICE typename disable_if_convertible<FromSystem, ToSystem, Pointer>::type
+_CCCL_HOST_DEVICE
+typename disable_if<is_copy_constructible_in_to_system<FromSystem, ToSystem, InputIterator>::value, Pointer>::type
 uninitialized_copy_with_allocator_n(
   Allocator&,
   const thrust::execution_policy<FromSystem>& from_system,
@@ -176,6 +202,46 @@ uninitialized_copy_with_allocator_n(
   return thrust::detail::two_system_copy_n(from_system, to_system, first, n, result);
 } // end uninitialized_copy_with_allocator_n()
 
+template <typename FromSystem, typename ToSystem, typename InputIterator, typename Pointer>
+_CCCL_HOST_DEVICE Pointer trivial_copy_construct_range(
+  const thrust::execution_policy<FromSystem>& from_system,
+  const thrust::execution_policy<ToSystem>& to_system,
+  InputIterator first,
+  InputIterator last,
+  Pointer result)
+{
+  if constexpr (is_refined_by_to_system<FromSystem, ToSystem, InputIterator>::value)
+  {
+    // the destination system refines the source system, so let it copy
+    return thrust::copy(thrust::detail::derived_cast(thrust::detail::strip_const(to_system)), first, last, result);
+  }
+  else
+  {
+    // just call two_system_copy
+    return thrust::detail::two_system_copy(from_system, to_system, first, last, result);
+  }
+}
+
+template <typename FromSystem, typename ToSystem, typename InputIterator, typename Size, typename Pointer>
+_CCCL_HOST_DEVICE Pointer trivial_copy_construct_range_n(
+  const thrust::execution_policy<FromSystem>& from_system,
+  const thrust::execution_policy<ToSystem>& to_system,
+  InputIterator first,
+  Size n,
+  Pointer result)
+{
+  if constexpr (is_refined_by_to_system<FromSystem, ToSystem, InputIterator>::value)
+  {
+    // the destination system refines the source system, so let it copy
+    return thrust::copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(to_system)), first, n, result);
+  }
+  else
+  {
+    // just call two_system_copy_n
+    return thrust::detail::two_system_copy_n(from_system, to_system, first, n, result);
+  }
+}
+
 template <typename FromSystem, typename Allocator, typename InputIterator, typename Pointer>
 _CCCL_HOST_DEVICE
 typename disable_if<needs_copy_construct_via_allocator<Allocator, typename pointer_element<Pointer>::type>::value,
@@ -186,8 +252,7 @@ copy_construct_range(thrust::execution_policy<FromSystem>& from_system,
                      InputIterator last,
                      Pointer result)
 {
-  // just call two_system_copy
-  return thrust::detail::two_system_copy(from_system, allocator_system<Allocator>::get(a), first, last, result);
+  return trivial_copy_construct_range(from_system, allocator_system<Allocator>::get(a), first, last, result);
 }
 
 template <typename FromSystem, typename Allocator, typename InputIterator, typename Size, typename Pointer>
@@ -197,8 +262,7 @@ typename disable_if<needs_copy_construct_via_allocator<Allocator, typename point
 copy_construct_range_n(
   thrust::execution_policy<FromSystem>& from_system, Allocator& a, InputIterator first, Size n, Pointer result)
 {
-  // just call two_system_copy_n
-  return thrust::detail::two_system_copy_n(from_system, allocator_system<Allocator>::get(a), first, n, result);
+  return trivial_copy_construct_range_n(from_system, allocator_system<Allocator>::get(a), first, n, result);
 }
 
 template <typename FromSystem, typename Allocator, typename InputIterator, typename Pointer>
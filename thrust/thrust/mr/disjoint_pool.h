@@ -41,6 +41,7 @@
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/pool_stats.h>
 
 #include <cuda/std/__algorithm/max.h>
 #include <cuda/std/__algorithm/min.h>
@@ -127,6 +128,7 @@ public:
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
+      , m_cached_oversized_bins(0)
       , m_oversized(m_bookkeeper)
   {
     assert(m_options.validate());
@@ -134,6 +136,10 @@ public:
     pointer_vector free(m_bookkeeper);
     pool p(free);
     m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+    oversized_block_vector cached(m_bookkeeper);
+    oversized_bin bin(cached);
+    m_cached_oversized.resize(detail::oversized_bin_count, bin);
   }
 
   // TODO: C++11: use delegating constructors
@@ -150,6 +156,7 @@ public:
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
+      , m_cached_oversized_bins(0)
       , m_oversized(m_bookkeeper)
   {
     assert(m_options.validate());
@@ -157,6 +164,10 @@ public:
     pointer_vector free(m_bookkeeper);
     pool p(free);
     m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+    oversized_block_vector cached(m_bookkeeper);
+    oversized_bin bin(cached);
+    m_cached_oversized.resize(detail::oversized_bin_count, bin);
   }
 
   /*! Destructor. Releases all held memory to upstream.
@@ -243,6 +254,7 @@ private:
     _CCCL_HOST pool(const pool& other)
         : free_blocks(other.free_blocks)
         , previous_allocated_count(other.previous_allocated_count)
+        , counters(other.counters)
     {}
 
     _CCCL_EXEC_CHECK_DISABLE
@@ -252,10 +264,32 @@ private:
 
     pointer_vector free_blocks;
     std::size_t previous_allocated_count;
+    thrust::detail::pool_bucket_counters counters;
   };
 
   using pool_vector = thrust::host_vector<pool, allocator<pool, Bookkeeper>>;
 
+  struct oversized_bin
+  {
+    _CCCL_HOST oversized_bin(const oversized_block_vector& cached)
+        : cached_blocks(cached)
+    {}
+
+    _CCCL_HOST oversized_bin(const oversized_bin& other)
+        : cached_blocks(other.cached_blocks)
+    {}
+
+    _CCCL_EXEC_CHECK_DISABLE
+    oversized_bin& operator=(const oversized_bin&) = default;
+
+    _CCCL_HOST ~oversized_bin() {}
+
+    // sorted by size and alignment
+    oversized_block_vector cached_blocks;
+  };
+
+  using oversized_bin_vector = thrust::host_vector<oversized_bin, allocator<oversized_bin, Bookkeeper>>;
+
   Upstream* m_upstream;
   Bookkeeper* m_bookkeeper;
 
@@ -266,11 +300,16 @@ private:
   pool_vector m_pools;
   // list of all allocations from upstream for the above
   chunk_vector m_allocated;
-  // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
-  oversized_block_vector m_cached_oversized;
+  // lists of all cached oversized/overaligned blocks that have been returned to the pool to cache, binned by the power
+  // of two at or below their size
+  oversized_bin_vector m_cached_oversized;
+  // the mask of the bins holding cached blocks
+  std::size_t m_cached_oversized_bins;
   // list of all oversized/overaligned allocations from upstream
   oversized_block_vector m_oversized;
 
+  thrust::detail::pool_counters m_counters;
+
 public:
   /*! Releases all held memory to upstream.
    */
@@ -287,23 +326,112 @@ public:
     for (std::size_t i = 0; i < m_allocated.size(); ++i)
     {
       m_upstream->do_deallocate(m_allocated[i].pointer, m_allocated[i].size, m_options.alignment);
+      m_counters.upstream_deallocation(m_allocated[i].size);
     }
 
     // deallocate cached oversized/overaligned memory
     for (std::size_t i = 0; i < m_oversized.size(); ++i)
     {
       m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      m_counters.upstream_deallocation(m_oversized[i].size);
     }
 
     m_allocated.clear();
     m_oversized.clear();
-    m_cached_oversized.clear();
+
+    for (std::size_t i = 0; i < m_cached_oversized.size(); ++i)
+    {
+      m_cached_oversized[i].cached_blocks.clear();
+    }
+    m_cached_oversized_bins = 0;
   }
 
-  void squeeze()
+  /*! Returns a snapshot of the memory held by the pool and, if \p THRUST_MR_ENABLE_POOL_STATS is defined, of its
+   *      counters. The bytes held from upstream don't include the bookkeeping, which is allocated from \p Bookkeeper.
+   */
+  pool_stats stats() const
   {
-    // Find all unused chunks and deallocate them
-    for (auto it = m_allocated.begin(); it != m_allocated.end();)
+    pool_stats ret{};
+
+    ret.chunks = m_allocated.size();
+    for (std::size_t i = 0; i < m_allocated.size(); ++i)
+    {
+      ret.upstream_bytes += m_allocated[i].size;
+    }
+
+    ret.oversized_blocks = m_oversized.size();
+    for (std::size_t i = 0; i < m_oversized.size(); ++i)
+    {
+      ret.upstream_bytes += m_oversized[i].size;
+    }
+
+    for (std::size_t bin = 0; bin < m_cached_oversized.size(); ++bin)
+    {
+      const oversized_block_vector& cached = m_cached_oversized[bin].cached_blocks;
+
+      ret.cached_oversized_blocks += cached.size();
+      for (std::size_t i = 0; i < cached.size(); ++i)
+      {
+        ret.cached_bytes += cached[i].size;
+      }
+    }
+
+    ret.buckets.resize(m_pools.size());
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      const pool& bucket         = m_pools[i];
+      pool_bucket_stats& buckets = ret.buckets[i];
+
+      buckets.block_size  = static_cast<std::size_t>(1) << (m_smallest_block_log2 + i);
+      buckets.free_blocks = bucket.free_blocks.size();
+      bucket.counters.copy_to(buckets);
+
+      ret.cached_bytes += buckets.free_blocks * buckets.block_size;
+    }
+
+    m_counters.copy_to(ret);
+
+    return ret;
+  }
+
+  /*! Returns cached memory to upstream, until no more than \p max_cached_bytes bytes (as reported by \p
+   *      pool_stats::cached_bytes) remain cached. Cached oversized blocks are returned first, largest first; then
+   *      chunks none of whose blocks are currently allocated.
+   *
+   *  \param max_cached_bytes the number of cached bytes that may be kept
+   *  \return the number of bytes returned to upstream
+   */
+  std::size_t trim(std::size_t max_cached_bytes = 0)
+  {
+    std::size_t cached   = stats().cached_bytes;
+    std::size_t released = 0;
+
+    // return the cached oversized blocks, from the largest ones; each bin is sorted, so start at the back
+    for (std::size_t bin = m_cached_oversized.size(); bin-- > 0 && cached > max_cached_bytes;)
+    {
+      oversized_block_vector& cached_blocks = m_cached_oversized[bin].cached_blocks;
+
+      while (cached > max_cached_bytes && !cached_blocks.empty())
+      {
+        oversized_block_descriptor block = cached_blocks.back();
+        cached_blocks.pop_back();
+
+        m_upstream->do_deallocate(block.pointer, block.size, block.alignment);
+        m_counters.upstream_deallocation(block.size);
+        m_oversized.erase(find(m_oversized.begin(), m_oversized.end(), block));
+
+        cached -= block.size;
+        released += block.size;
+      }
+
+      if (cached_blocks.empty())
+      {
+        m_cached_oversized_bins &= ~(static_cast<std::size_t>(1) << bin);
+      }
+    }
+
+    // find the chunks which are not in use, and return them
+    for (auto it = m_allocated.begin(); it != m_allocated.end() && cached > max_cached_bytes;)
     {
       const auto pool_idx = (*it).pool_idx;
       auto& pool          = m_pools[pool_idx];
@@ -335,6 +463,11 @@ public:
 
         // Deallocate and remove this chunk from the list of allocated chunks
         m_upstream->do_deallocate((*it).pointer, (*it).size, m_options.alignment);
+        m_counters.upstream_deallocation((*it).size);
+
+        cached -= (*it).size;
+        released += (*it).size;
+
         it = m_allocated.erase(it);
       }
       else
@@ -343,13 +476,14 @@ public:
       }
     }
 
-    // Remove all cached oversized allocations
-    for (auto it = m_cached_oversized.begin(); it != m_cached_oversized.end();)
-    {
-      m_upstream->do_deallocate((*it).pointer, (*it).size, (*it).alignment);
-      m_oversized.erase(find(m_oversized.begin(), m_oversized.end(), *it));
-      it = m_cached_oversized.erase(it);
-    }
+    return released;
+  }
+
+  /*! Returns all cached memory to upstream.
+   */
+  void squeeze()
+  {
+    trim(0);
   }
 
   [[nodiscard]] virtual void_ptr
@@ -379,44 +513,64 @@ public:
       oversized.size      = bytes;
       oversized.alignment = alignment;
 
-      if (m_options.cache_oversized && !m_cached_oversized.empty())
+      if (m_options.cache_oversized)
       {
-        typename oversized_block_vector::iterator it =
-          thrust::lower_bound(thrust::seq, m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
+        // look through the bins which may hold blocks that are large enough but not too large, smallest first
+        // the bins are sorted, so the first fitting block of the first bin with one is the best fit
+        std::size_t bins =
+          m_cached_oversized_bins & detail::oversized_bin_mask(bytes, m_options.cached_size_cutoff_factor);
 
-        // if the size is bigger than the requested size by a factor
-        // bigger than or equal to the specified cutoff for size,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
+        while (bins)
         {
+          const std::size_t bin = detail::lowest_oversized_bin(bins);
+          bins &= bins - 1;
+
+          oversized_block_vector& cached = m_cached_oversized[bin].cached_blocks;
+
+          typename oversized_block_vector::iterator it =
+            thrust::lower_bound(thrust::seq, cached.begin(), cached.end(), oversized);
+
+          if (it != cached.end() && (*it).alignment < alignment)
+          {
+            it = find_if(it + 1, cached.end(), matching_alignment(alignment));
+          }
+
+          if (it == cached.end())
+          {
+            continue;
+          }
+
+          // if the size is bigger than the requested size by a factor
+          // bigger than or equal to the specified cutoff for size,
+          // allocate a new block
           std::size_t size_factor = (*it).size / bytes;
           if (size_factor >= m_options.cached_size_cutoff_factor)
           {
-            it = m_cached_oversized.end();
+            break;
           }
-        }
 
-        if (it != m_cached_oversized.end() && (*it).alignment < alignment)
-        {
-          it = find_if(it + 1, m_cached_oversized.end(), matching_alignment(alignment));
-        }
-
-        // if the alignment is bigger than the requested one by a factor
-        // bigger than or equal to the specified cutoff for alignment,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
-        {
+          // if the alignment is bigger than the requested one by a factor
+          // bigger than or equal to the specified cutoff for alignment,
+          // allocate a new block
           std::size_t alignment_factor = (*it).alignment / alignment;
           if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
           {
-            it = m_cached_oversized.end();
+            break;
           }
-        }
 
-        if (it != m_cached_oversized.end())
-        {
+          // take the last of the equivalent blocks, so that the others don't need to be moved
+          it = thrust::upper_bound(thrust::seq, it, cached.end(), *it) - 1;
+
           oversized.pointer = (*it).pointer;
-          m_cached_oversized.erase(it);
+          cached.erase(it);
+
+          if (cached.empty())
+          {
+            m_cached_oversized_bins &= ~(static_cast<std::size_t>(1) << bin);
+          }
+
+          m_counters.oversized_hit();
+          m_counters.allocation(bytes);
           return oversized.pointer;
         }
       }
@@ -425,6 +579,9 @@ public:
       oversized.pointer = m_upstream->do_allocate(bytes, alignment);
       m_oversized.push_back(oversized);
 
+      m_counters.oversized_miss();
+      m_counters.upstream_allocation(bytes);
+      m_counters.allocation(bytes);
       return oversized.pointer;
     }
 
@@ -434,6 +591,8 @@ public:
     std::size_t pool_idx   = bytes_log2 - m_smallest_block_log2;
     pool& bucket           = m_pools[pool_idx];
 
+    const std::size_t requested = bytes;
+
     // if the free list of the bucket has no elements, allocate a new chunk
     // and split it into blocks pushed to the free list
     if (bucket.free_blocks.empty())
@@ -467,15 +626,24 @@ public:
       m_allocated.push_back(allocated);
       bucket.previous_allocated_count = n;
 
+      bucket.counters.miss();
+      m_counters.upstream_allocation(bytes);
+
       for (std::size_t i = 0; i < n; ++i)
       {
         bucket.free_blocks.push_back(static_cast<void_ptr>(static_cast<char_ptr>(allocated.pointer) + i * bucket_size));
       }
     }
+    else
+    {
+      bucket.counters.hit();
+    }
 
     // allocate a block from the front of the bucket's free list
     void_ptr ret = bucket.free_blocks.back();
     bucket.free_blocks.pop_back();
+
+    m_counters.allocation(requested);
     return ret;
   }
 
@@ -487,6 +655,8 @@ public:
     // verify that the pointer is at least as aligned as claimed
     assert(reinterpret_cast<::cuda::std::intmax_t>(detail::pointer_traits<void_ptr>::get(p)) % alignment == 0);
 
+    m_counters.deallocation(n);
+
     // the deallocated block is oversized and/or overaligned
     if (n > m_options.largest_block_size || alignment > m_options.alignment)
     {
@@ -497,15 +667,21 @@ public:
 
       if (m_options.cache_oversized)
       {
+        const std::size_t bin          = detail::oversized_bin(oversized.size);
+        oversized_block_vector& cached = m_cached_oversized[bin].cached_blocks;
+
+        // insert after the equivalent blocks, so that they don't need to be moved
         typename oversized_block_vector::iterator position =
-          lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-        m_cached_oversized.insert(position, oversized);
+          thrust::upper_bound(thrust::seq, cached.begin(), cached.end(), oversized);
+        cached.insert(position, oversized);
+        m_cached_oversized_bins |= static_cast<std::size_t>(1) << bin;
         return;
       }
 
       m_oversized.erase(it);
 
       m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
+      m_counters.upstream_deallocation(oversized.size);
 
       return;
     }
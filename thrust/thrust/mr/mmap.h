@@ -0,0 +1,361 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A host memory resource which maps memory directly from the operating system, optionally backed by huge
+ *      pages and placed on specific NUMA nodes.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/integral.h>
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+
+#if !_CCCL_OS(WINDOWS)
+#  include <sys/mman.h>
+
+#  include <cerrno>
+#  include <cstring>
+
+#  include <unistd.h>
+#  if defined(__linux__)
+#    include <sys/syscall.h>
+#  endif // __linux__
+#endif // !_CCCL_OS(WINDOWS)
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The kind of pages an \p mmap_resource backs its allocations with.
+ */
+enum class mmap_huge_pages
+{
+  /*! Regular pages, as chosen by the operating system.
+   */
+  none,
+  /*! Regular mappings, aligned to the huge page size and marked as eligible for transparent huge pages (\p
+   * MADV_HUGEPAGE), so that the kernel can back them with huge pages without any pages being reserved up front.
+   */
+  transparent,
+  /*! Explicit huge pages (\p MAP_HUGETLB), taken from the pages reserved by the administrator. When no reserved pages
+   * are available, the allocation falls back to a \p transparent mapping.
+   */
+  explicit_pages
+};
+
+/*! The NUMA placement policy an \p mmap_resource applies to its allocations.
+ */
+enum class mmap_numa_policy
+{
+  /*! Don't set a policy; pages are placed according to the policy of the thread which first touches them.
+   */
+  none,
+  /*! Only place pages on the nodes in \p mmap_resource_options::nodes.
+   */
+  bind,
+  /*! Interleave pages across the nodes in \p mmap_resource_options::nodes, page by page.
+   */
+  interleave,
+  /*! Prefer placing pages on the first node in \p mmap_resource_options::nodes, falling back to other nodes when it
+   * runs out of memory.
+   */
+  preferred
+};
+
+/*! A type used for configuring \p mmap_resource.
+ */
+struct mmap_resource_options
+{
+  /*! The kind of pages to back the allocations with.
+   */
+  mmap_huge_pages huge_pages;
+  /*! The size of a huge page. Must be a power of two. Allocations backed by huge pages are rounded up to, and aligned
+   * to, a multiple of this size.
+   */
+  std::size_t huge_page_size;
+
+  /*! The NUMA placement policy of the allocations.
+   */
+  mmap_numa_policy numa_policy;
+  /*! The mask of the NUMA nodes the policy refers to; bit \p i selects node \p i. Ignored when \p numa_policy is \p
+   * none.
+   */
+  std::uint64_t nodes;
+
+  /*! Checks if the options are self-consistent.
+   *
+   *  \return true if the options are self-consistent, false otherwise.
+   */
+  bool validate() const
+  {
+    if (!::cuda::std::has_single_bit(huge_page_size))
+    {
+      return false;
+    }
+
+    if (numa_policy != mmap_numa_policy::none && nodes == 0)
+    {
+      return false;
+    }
+
+    return true;
+  }
+};
+
+/*! A memory resource which maps anonymous memory directly from the operating system for every allocation, and unmaps
+ *      it on deallocation. Allocations can be backed by huge pages, to reduce the TLB misses of traversing large
+ *      buffers, and bound or interleaved across NUMA nodes.
+ *
+ *  The pages of an allocation aren't touched by the resource, so unless a NUMA policy is set, they are placed on the
+ *      node of the thread which first writes to them. Every allocation is at least a whole page, and costs a system
+ *      call, so this resource is intended for large buffers, or to be used as the upstream resource of a pooling
+ *      resource such as \p unsynchronized_pool_resource, rather than for small allocations.
+ *
+ *  The NUMA policy is applied with the \p mbind system call, where it is available; on systems without NUMA support it
+ *      has no effect, as does the huge page mode where the corresponding mapping flags are unavailable. On Windows,
+ *      this resource allocates with global operator new.
+ */
+class mmap_resource final : public memory_resource<>
+{
+public:
+  /*! Get the default options for an mmap resource: transparent huge pages of 2 MiB, without a NUMA policy.
+   *
+   *  \return the default options for an mmap resource.
+   */
+  static mmap_resource_options get_default_options()
+  {
+    mmap_resource_options ret;
+
+    ret.huge_pages     = mmap_huge_pages::transparent;
+    ret.huge_page_size = 2 * 1024 * 1024;
+    ret.numa_policy    = mmap_numa_policy::none;
+    ret.nodes          = 0;
+
+    return ret;
+  }
+
+  /*! Constructor.
+   *
+   *  \param options the options to use
+   */
+  mmap_resource(mmap_resource_options options = get_default_options())
+      : m_options(options)
+  {
+    assert(m_options.validate());
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if _CCCL_OS(WINDOWS)
+    return new_delete_resource().do_allocate(bytes, alignment);
+#else // ^^^ _CCCL_OS(WINDOWS) ^^^ / vvv !_CCCL_OS(WINDOWS) vvv
+    const mapping m = mapping_of(bytes, alignment);
+
+    void* ret = nullptr;
+#  if defined(MAP_HUGETLB)
+    if (m_options.huge_pages == mmap_huge_pages::explicit_pages)
+    {
+      ret = map_aligned(m, m_options.huge_page_size, MAP_HUGETLB | huge_page_size_flags());
+    }
+#  endif // MAP_HUGETLB
+    if (ret == nullptr)
+    {
+      ret = map_aligned(m, static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)), 0);
+    }
+    if (ret == nullptr)
+    {
+      throw thrust::system::detail::bad_alloc(std::strerror(errno));
+    }
+
+#  if defined(MADV_HUGEPAGE)
+    if (m_options.huge_pages != mmap_huge_pages::none)
+    {
+      // only a hint; fails harmlessly when transparent huge pages are disabled, or the mapping already uses explicit
+      // huge pages
+      ::madvise(ret, m.length, MADV_HUGEPAGE);
+    }
+#  endif // MADV_HUGEPAGE
+
+    set_numa_policy(ret, m.length);
+
+    return ret;
+#endif // !_CCCL_OS(WINDOWS)
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) noexcept override
+  {
+#if _CCCL_OS(WINDOWS)
+    new_delete_resource().do_deallocate(p, bytes, alignment);
+#else // ^^^ _CCCL_OS(WINDOWS) ^^^ / vvv !_CCCL_OS(WINDOWS) vvv
+    ::munmap(p, mapping_of(bytes, alignment).length);
+#endif // !_CCCL_OS(WINDOWS)
+  }
+
+  /*! Returns the options this resource was constructed with.
+   *
+   *  \return the options of this resource.
+   */
+  const mmap_resource_options& options() const noexcept
+  {
+    return m_options;
+  }
+
+private:
+  mmap_resource_options m_options;
+
+#if !_CCCL_OS(WINDOWS)
+  struct mapping
+  {
+    std::size_t length;
+    std::size_t alignment;
+  };
+
+  // The length and alignment of the mapping for an allocation. This must only depend on the arguments, so that
+  // deallocation unmaps exactly what was mapped; in particular, it doesn't depend on whether an explicit huge page
+  // mapping fell back to regular pages. Throws when the length doesn't fit in a std::size_t, which can only happen on
+  // allocation.
+  mapping mapping_of(std::size_t bytes, std::size_t alignment) const
+  {
+    const std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+    std::size_t granularity = page_size;
+    if (m_options.huge_pages == mmap_huge_pages::explicit_pages
+        || (m_options.huge_pages == mmap_huge_pages::transparent && bytes >= m_options.huge_page_size))
+    {
+      granularity = m_options.huge_page_size > page_size ? m_options.huge_page_size : page_size;
+    }
+
+    if (bytes > (std::numeric_limits<std::size_t>::max)() - (granularity - 1))
+    {
+      throw thrust::system::detail::bad_alloc("mmap_resource: allocation size too large");
+    }
+
+    mapping ret;
+    ret.length    = (bytes + granularity - 1) & ~(granularity - 1);
+    ret.alignment = alignment > granularity ? alignment : granularity;
+    if (ret.length == 0)
+    {
+      ret.length = granularity;
+    }
+
+    return ret;
+  }
+
+  // Mappings are only aligned to their page size, so larger alignments are obtained by mapping more than necessary
+  // and unmapping the slack on both sides. Returns null on failure, and throws when the mapping including the slack
+  // doesn't fit in a std::size_t.
+  static void* map_aligned(const mapping& m, std::size_t page_size, int flags)
+  {
+    const std::size_t slack = m.alignment > page_size ? m.alignment - page_size : 0;
+
+    if (m.length > (std::numeric_limits<std::size_t>::max)() - slack)
+    {
+      throw thrust::system::detail::bad_alloc("mmap_resource: allocation size too large");
+    }
+
+    void* p = ::mmap(nullptr, m.length + slack, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    if (p == MAP_FAILED)
+    {
+      return nullptr;
+    }
+
+    char* const begin = static_cast<char*>(p);
+    char* const ret   = begin + (m.alignment - reinterpret_cast<std::uintptr_t>(begin) % m.alignment) % m.alignment;
+    if (ret != begin)
+    {
+      ::munmap(begin, ret - begin);
+    }
+    if (ret != begin + slack)
+    {
+      ::munmap(ret + m.length, begin + slack - ret);
+    }
+
+    return ret;
+  }
+
+  int huge_page_size_flags() const
+  {
+#  if defined(MAP_HUGE_SHIFT)
+    return ::cuda::std::countr_zero(m_options.huge_page_size) << MAP_HUGE_SHIFT;
+#  else // ^^^ MAP_HUGE_SHIFT ^^^ / vvv !MAP_HUGE_SHIFT vvv
+    return 0;
+#  endif // !MAP_HUGE_SHIFT
+  }
+
+  // Sets the NUMA policy of a fresh mapping, before any of its pages are touched. Uses the system call directly, to
+  // avoid a dependency on libnuma; the values of the modes are part of the kernel's ABI.
+  void set_numa_policy([[maybe_unused]] void* p, [[maybe_unused]] std::size_t length) const
+  {
+#  if defined(SYS_mbind)
+    int mode = 0;
+    switch (m_options.numa_policy)
+    {
+      case mmap_numa_policy::none:
+        return;
+      case mmap_numa_policy::preferred:
+        mode = 1; // MPOL_PREFERRED
+        break;
+      case mmap_numa_policy::bind:
+        mode = 2; // MPOL_BIND
+        break;
+      case mmap_numa_policy::interleave:
+        mode = 3; // MPOL_INTERLEAVE
+        break;
+    }
+
+    unsigned long mask[64 / (8 * sizeof(unsigned long))];
+    for (std::size_t i = 0; i < sizeof(mask) / sizeof(mask[0]); ++i)
+    {
+      mask[i] = static_cast<unsigned long>(m_options.nodes >> (i * 8 * sizeof(unsigned long)));
+    }
+
+    // like the placement hints above, the policy is best effort: it fails on kernels built without NUMA support, and
+    // for nodes which don't exist, in which case the pages are placed as if no policy was set
+    ::syscall(SYS_mbind, p, length, mode, mask, 64 + 1, 0);
+#  endif // SYS_mbind
+  }
+#endif // !_CCCL_OS(WINDOWS)
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -37,10 +37,13 @@
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/pool_stats.h>
 
 #include <cuda/std/cassert>
 #include <cuda/std/cstdint>
 
+#include <vector>
+
 THRUST_NAMESPACE_BEGIN
 namespace mr
 {
@@ -117,6 +120,7 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_oversized_bins(0)
   {
     assert(m_options.validate());
 
@@ -138,6 +142,7 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_oversized_bins(0)
   {
     assert(m_options.validate());
 
@@ -179,8 +184,8 @@ private:
 
   // this was originally a forward list, but I made it a doubly linked list
   // because that way deallocation when not caching is faster and doesn't require
-  // traversal of a linked list (it's still a forward list for the cached list,
-  // because allocation from that list already traverses)
+  // traversal of a linked list (the cached lists, one per bin, are still forward
+  // lists, because allocation from them already traverses)
   //
   // TODO: investigate whether it's better to have this be a doubly-linked list
   // with fast do_deallocate when !m_options.cache_oversized, or to have this be
@@ -203,6 +208,7 @@ private:
   {
     block_descriptor_ptr free_list;
     std::size_t previous_allocated_count;
+    thrust::detail::pool_bucket_counters counters;
   };
 
   using pool_vector = thrust::host_vector<pool, allocator<pool, Upstream>>;
@@ -215,7 +221,45 @@ private:
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+  // cached oversized/overaligned blocks, binned by the power of two at or below their size
+  oversized_block_descriptor_ptr m_cached_oversized[thrust::detail::oversized_bin_count];
+  // the mask of the bins holding cached blocks
+  std::size_t m_cached_oversized_bins;
+
+  thrust::detail::pool_counters m_counters;
+
+  // the distance between the blocks of a chunk of the bucket of blocks of the given size
+  std::size_t block_stride(std::size_t bytes) const
+  {
+    std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
+    std::size_t block_size      = bytes + descriptor_size;
+    block_size += m_options.alignment - block_size % m_options.alignment;
+    return block_size;
+  }
+
+  // removes a cached oversized block from the list of all oversized blocks, and returns it to upstream
+  void deallocate_cached_oversized(oversized_block_descriptor_ptr block)
+  {
+    oversized_block_descriptor desc = *block;
+
+    if (oversized_block_ptr_traits::get(desc.prev))
+    {
+      thrust::raw_reference_cast(*desc.prev).next = desc.next;
+    }
+    else
+    {
+      m_oversized = desc.next;
+    }
+
+    if (oversized_block_ptr_traits::get(desc.next))
+    {
+      thrust::raw_reference_cast(*desc.next).prev = desc.prev;
+    }
+
+    void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(block)) - desc.current_size);
+    m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+    m_counters.upstream_deallocation(desc.size + sizeof(oversized_block_descriptor));
+  }
 
 public:
   /*! Releases all held memory to upstream.
@@ -235,10 +279,11 @@ public:
       chunk_descriptor_ptr alloc = m_allocated;
       m_allocated                = thrust::raw_reference_cast(*m_allocated).next;
 
-      void_ptr p = static_cast<void_ptr>(
-        static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - thrust::raw_reference_cast(*alloc).size);
-      m_upstream->do_deallocate(
-        p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+      const std::size_t size = thrust::raw_reference_cast(*alloc).size;
+
+      void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - size);
+      m_upstream->do_deallocate(p, size + sizeof(chunk_descriptor), m_options.alignment);
+      m_counters.upstream_deallocation(size + sizeof(chunk_descriptor));
     }
 
     // deallocate cached oversized/overaligned memory
@@ -251,9 +296,222 @@ public:
 
       void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - desc.current_size);
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      m_counters.upstream_deallocation(desc.size + sizeof(oversized_block_descriptor));
+    }
+
+    for (std::size_t i = 0; i < thrust::detail::oversized_bin_count; ++i)
+    {
+      m_cached_oversized[i] = oversized_block_descriptor_ptr();
+    }
+    m_cached_oversized_bins = 0;
+  }
+
+  /*! Returns a snapshot of the memory held by the pool and, if \p THRUST_MR_ENABLE_POOL_STATS is defined, of its
+   *      counters.
+   */
+  pool_stats stats() const
+  {
+    pool_stats ret{};
+
+    for (chunk_descriptor_ptr chunk = m_allocated; detail::pointer_traits<chunk_descriptor_ptr>::get(chunk);
+         chunk                      = thrust::raw_reference_cast(*chunk).next)
+    {
+      ++ret.chunks;
+      ret.upstream_bytes += thrust::raw_reference_cast(*chunk).size + sizeof(chunk_descriptor);
+    }
+
+    for (oversized_block_descriptor_ptr block = m_oversized; oversized_block_ptr_traits::get(block);
+         block                                = thrust::raw_reference_cast(*block).next)
+    {
+      ++ret.oversized_blocks;
+      ret.upstream_bytes += thrust::raw_reference_cast(*block).size + sizeof(oversized_block_descriptor);
+    }
+
+    for (std::size_t bin = 0; bin < thrust::detail::oversized_bin_count; ++bin)
+    {
+      for (oversized_block_descriptor_ptr block = m_cached_oversized[bin]; oversized_block_ptr_traits::get(block);
+           block                                = thrust::raw_reference_cast(*block).next_cached)
+      {
+        ++ret.cached_oversized_blocks;
+        ret.cached_bytes += thrust::raw_reference_cast(*block).size;
+      }
     }
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+    ret.buckets.resize(m_pools.size());
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      const pool& bucket         = thrust::raw_reference_cast(m_pools[i]);
+      pool_bucket_stats& buckets = ret.buckets[i];
+
+      buckets.block_size  = static_cast<std::size_t>(1) << (m_smallest_block_log2 + i);
+      buckets.free_blocks = 0;
+      for (block_descriptor_ptr block = bucket.free_list; detail::pointer_traits<block_descriptor_ptr>::get(block);
+           block                      = thrust::raw_reference_cast(*block).next)
+      {
+        ++buckets.free_blocks;
+      }
+      bucket.counters.copy_to(buckets);
+
+      ret.cached_bytes += buckets.free_blocks * buckets.block_size;
+    }
+
+    m_counters.copy_to(ret);
+
+    return ret;
+  }
+
+  /*! Returns cached memory to upstream, until no more than \p max_cached_bytes bytes (as reported by \p
+   *      pool_stats::cached_bytes) remain cached. Cached oversized blocks are returned first, largest first; then
+   *      chunks none of whose blocks are currently allocated.
+   *
+   *  \param max_cached_bytes the number of cached bytes that may be kept
+   *  \return the number of bytes returned to upstream
+   */
+  std::size_t trim(std::size_t max_cached_bytes = 0)
+  {
+    std::size_t cached   = stats().cached_bytes;
+    std::size_t released = 0;
+
+    // return the cached oversized blocks, from the bin of the largest ones
+    for (std::size_t bin = thrust::detail::oversized_bin_count; bin-- > 0 && cached > max_cached_bytes;)
+    {
+      while (cached > max_cached_bytes && oversized_block_ptr_traits::get(m_cached_oversized[bin]))
+      {
+        oversized_block_descriptor_ptr block = m_cached_oversized[bin];
+        oversized_block_descriptor desc      = *block;
+        m_cached_oversized[bin]              = desc.next_cached;
+
+        deallocate_cached_oversized(block);
+
+        cached -= desc.size;
+        released += desc.size + sizeof(oversized_block_descriptor);
+      }
+
+      if (!oversized_block_ptr_traits::get(m_cached_oversized[bin]))
+      {
+        m_cached_oversized_bins &= ~(static_cast<std::size_t>(1) << bin);
+      }
+    }
+
+    if (cached <= max_cached_bytes)
+    {
+      return released;
+    }
+
+    // find the chunks all blocks of which are on the free list of their bucket; the blocks don't know the chunk they
+    // were cut from, so look them up by address
+    struct chunk_info
+    {
+      char* begin;
+      chunk_descriptor_ptr descriptor;
+      std::size_t bucket;
+      std::size_t free_blocks;
+      bool release;
+    };
+
+    std::vector<chunk_info> chunks;
+    for (chunk_descriptor_ptr chunk = m_allocated; detail::pointer_traits<chunk_descriptor_ptr>::get(chunk);
+         chunk                      = thrust::raw_reference_cast(*chunk).next)
+    {
+      char* end = static_cast<char*>(void_ptr_traits::get(static_cast<void_ptr>(chunk)));
+      chunks.push_back(chunk_info{end - thrust::raw_reference_cast(*chunk).size, chunk, 0, 0, false});
+    }
+
+    std::sort(chunks.begin(), chunks.end(), [](const chunk_info& lhs, const chunk_info& rhs) {
+      return lhs.begin < rhs.begin;
+    });
+
+    auto chunk_of = [&](block_descriptor_ptr block, std::size_t bytes) -> chunk_info& {
+      char* begin = static_cast<char*>(void_ptr_traits::get(static_cast<void_ptr>(block))) - bytes;
+      auto it     = std::upper_bound(chunks.begin(), chunks.end(), begin, [](char* p, const chunk_info& chunk) {
+        return p < chunk.begin;
+      });
+      assert(it != chunks.begin());
+      return *--it;
+    };
+
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      const std::size_t bytes = static_cast<std::size_t>(1) << (m_smallest_block_log2 + i);
+      for (block_descriptor_ptr block = thrust::raw_reference_cast(m_pools[i]).free_list;
+           detail::pointer_traits<block_descriptor_ptr>::get(block);
+           block = thrust::raw_reference_cast(*block).next)
+      {
+        chunk_info& chunk = chunk_of(block, bytes);
+        chunk.bucket      = i;
+        ++chunk.free_blocks;
+      }
+    }
+
+    bool any = false;
+    for (chunk_info& chunk : chunks)
+    {
+      if (cached <= max_cached_bytes)
+      {
+        break;
+      }
+
+      const std::size_t bytes = static_cast<std::size_t>(1) << (m_smallest_block_log2 + chunk.bucket);
+      const std::size_t size  = thrust::raw_reference_cast(*chunk.descriptor).size;
+      if (chunk.free_blocks != 0 && chunk.free_blocks == size / block_stride(bytes))
+      {
+        chunk.release = true;
+        any           = true;
+        cached -= chunk.free_blocks * bytes;
+      }
+    }
+
+    if (!any)
+    {
+      return released;
+    }
+
+    // unlink the blocks of the released chunks from the free lists
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      const std::size_t bytes = static_cast<std::size_t>(1) << (m_smallest_block_log2 + i);
+      block_descriptor_ptr* previous = &thrust::raw_reference_cast(m_pools[i]).free_list;
+      while (detail::pointer_traits<block_descriptor_ptr>::get(*previous))
+      {
+        block_descriptor_ptr block = *previous;
+        if (chunk_of(block, bytes).release)
+        {
+          *previous = thrust::raw_reference_cast(*block).next;
+        }
+        else
+        {
+          previous = &thrust::raw_reference_cast(*block).next;
+        }
+      }
+    }
+
+    // unlink the released chunks from the list of chunks, and return them to upstream
+    chunk_descriptor_ptr* previous = &m_allocated;
+    while (detail::pointer_traits<chunk_descriptor_ptr>::get(*previous))
+    {
+      chunk_descriptor_ptr chunk = *previous;
+      chunk_descriptor desc      = *chunk;
+      char* end                  = static_cast<char*>(void_ptr_traits::get(static_cast<void_ptr>(chunk)));
+
+      auto it = std::lower_bound(chunks.begin(), chunks.end(), end - desc.size, [](const chunk_info& info, char* p) {
+        return info.begin < p;
+      });
+      if (!it->release)
+      {
+        previous = &thrust::raw_reference_cast(*chunk).next;
+        continue;
+      }
+
+      *previous = desc.next;
+
+      void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(chunk)) - desc.size);
+      m_upstream->do_deallocate(p, desc.size + sizeof(chunk_descriptor), m_options.alignment);
+      m_counters.upstream_deallocation(desc.size + sizeof(chunk_descriptor));
+
+      released += desc.size + sizeof(chunk_descriptor);
+    }
+
+    return released;
   }
 
   [[nodiscard]] virtual void_ptr
@@ -262,90 +520,103 @@ public:
     bytes = (std::max)(bytes, m_options.smallest_block_size);
     assert(detail::is_power_of_2(alignment));
 
+    m_counters.allocation(bytes);
+
     // an oversized and/or overaligned allocation requested; needs to be allocated separately
     if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
     {
       if (m_options.cache_oversized)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (oversized_block_ptr_traits::get(ptr))
+        // look through the bins which may hold blocks that are large enough but not too large, smallest first
+        std::size_t bins =
+          m_cached_oversized_bins & thrust::detail::oversized_bin_mask(bytes, m_options.cached_size_cutoff_factor);
+
+        while (bins)
         {
-          oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
+          const std::size_t bin = thrust::detail::lowest_oversized_bin(bins);
+          bins &= bins - 1;
 
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
+          oversized_block_descriptor_ptr ptr       = m_cached_oversized[bin];
+          oversized_block_descriptor_ptr* previous = &m_cached_oversized[bin];
+          while (oversized_block_ptr_traits::get(ptr))
           {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
+            oversized_block_descriptor desc = *ptr;
+            bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
+
+            // if the size is bigger than the requested size by a factor
+            // bigger than or equal to the specified cutoff for size,
+            // allocate a new block
+            if (is_good)
             {
-              is_good = false;
+              std::size_t size_factor = desc.size / bytes;
+              if (size_factor >= m_options.cached_size_cutoff_factor)
+              {
+                is_good = false;
+              }
             }
-          }
 
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
-          {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+            // if the alignment is bigger than the requested one by a factor
+            // bigger than or equal to the specified cutoff for alignment,
+            // allocate a new block
+            if (is_good)
             {
-              is_good = false;
+              std::size_t alignment_factor = desc.alignment / alignment;
+              if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+              {
+                is_good = false;
+              }
             }
-          }
 
-          if (is_good)
-          {
-            if (previous != &m_cached_oversized)
+            if (is_good)
             {
               *previous = desc.next_cached;
-            }
-            else
-            {
-              m_cached_oversized = desc.next_cached;
-            }
-
-            desc.next_cached = oversized_block_descriptor_ptr();
 
-            auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
+              if (!oversized_block_ptr_traits::get(m_cached_oversized[bin]))
+              {
+                m_cached_oversized_bins &= ~(static_cast<std::size_t>(1) << bin);
+              }
 
-            if (bytes != desc.size)
-            {
-              desc.current_size = bytes;
+              desc.next_cached = oversized_block_descriptor_ptr();
 
-              ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+              auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
 
-              if (oversized_block_ptr_traits::get(desc.prev))
-              {
-                thrust::raw_reference_cast(*desc.prev).next = ptr;
-              }
-              else
+              if (bytes != desc.size)
               {
-                m_oversized = ptr;
+                desc.current_size = bytes;
+
+                ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+
+                if (oversized_block_ptr_traits::get(desc.prev))
+                {
+                  thrust::raw_reference_cast(*desc.prev).next = ptr;
+                }
+                else
+                {
+                  m_oversized = ptr;
+                }
+
+                if (oversized_block_ptr_traits::get(desc.next))
+                {
+                  thrust::raw_reference_cast(*desc.next).prev = ptr;
+                }
               }
 
-              if (oversized_block_ptr_traits::get(desc.next))
-              {
-                thrust::raw_reference_cast(*desc.next).prev = ptr;
-              }
-            }
+              *ptr = desc;
 
-            *ptr = desc;
+              m_counters.oversized_hit();
+              return static_cast<void_ptr>(ret);
+            }
 
-            return static_cast<void_ptr>(ret);
+            previous = &thrust::raw_reference_cast(*ptr).next_cached;
+            ptr      = *previous;
           }
-
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
         }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
       void_ptr allocated = m_upstream->do_allocate(bytes + sizeof(oversized_block_descriptor), alignment);
+      m_counters.oversized_miss();
+      m_counters.upstream_allocation(bytes + sizeof(oversized_block_descriptor));
       oversized_block_descriptor_ptr block =
         static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + bytes));
 
@@ -403,12 +674,12 @@ public:
         }
       }
 
-      std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
-      std::size_t block_size      = bytes + descriptor_size;
-      block_size += m_options.alignment - block_size % m_options.alignment;
+      std::size_t block_size = block_stride(bytes);
       std::size_t chunk_size = block_size * n;
 
       void_ptr allocated = m_upstream->do_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+      bucket.counters.miss();
+      m_counters.upstream_allocation(chunk_size + sizeof(chunk_descriptor));
       chunk_descriptor_ptr chunk =
         static_cast<chunk_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + chunk_size));
 
@@ -429,6 +700,10 @@ public:
         bucket.free_list = block;
       }
     }
+    else
+    {
+      bucket.counters.hit();
+    }
 
     // allocate a block from the front of the bucket's free list
     block_descriptor_ptr block = bucket.free_list;
@@ -441,6 +716,8 @@ public:
     n = (std::max)(n, m_options.smallest_block_size);
     assert(detail::is_power_of_2(alignment));
 
+    m_counters.deallocation(n);
+
     // verify that the pointer is at least as aligned as claimed
     assert(reinterpret_cast<::cuda::std::intmax_t>(void_ptr_traits::get(p)) % alignment == 0);
 
@@ -456,7 +733,9 @@ public:
 
       if (m_options.cache_oversized)
       {
-        desc.next_cached = m_cached_oversized;
+        const std::size_t bin = thrust::detail::oversized_bin(desc.size);
+
+        desc.next_cached = m_cached_oversized[bin];
 
         if (desc.size != n)
         {
@@ -478,8 +757,9 @@ public:
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        m_cached_oversized[bin] = block;
+        m_cached_oversized_bins |= static_cast<std::size_t>(1) << bin;
+        *block = desc;
 
         return;
       }
@@ -499,6 +779,7 @@ public:
       }
 
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      m_counters.upstream_deallocation(desc.size + sizeof(oversized_block_descriptor));
 
       return;
     }
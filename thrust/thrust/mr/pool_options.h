@@ -34,9 +34,55 @@
 #include <thrust/detail/config/memory_resource.h>
 #include <thrust/detail/integer_math.h>
 
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/integral.h>
 #include <cuda/std/cstddef>
+#include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// The pool resources bin their cached oversized and overaligned blocks by the power of two at or below their size, so
+// that an allocation only looks at the bins which may hold blocks that are large enough, but not too large.
+constexpr std::size_t oversized_bin_count = ::cuda::std::numeric_limits<std::size_t>::digits;
+
+inline std::size_t oversized_bin(std::size_t size)
+{
+  return static_cast<std::size_t>(::cuda::std::bit_width(size)) - 1;
+}
+
+// Returns the mask of the bins which may hold blocks of at least bytes, but not larger than bytes by a factor of
+// cutoff_factor or more.
+inline std::size_t oversized_bin_mask(std::size_t bytes, std::size_t cutoff_factor)
+{
+  if (cutoff_factor == 0)
+  {
+    return 0;
+  }
+
+  const std::size_t max_size = ::cuda::std::numeric_limits<std::size_t>::max();
+  const std::size_t limit    = bytes > max_size / cutoff_factor ? max_size : bytes * cutoff_factor - 1;
+
+  const std::size_t first = oversized_bin(bytes);
+  const std::size_t last  = oversized_bin(limit);
+
+  if (last < first)
+  {
+    return 0;
+  }
+
+  return (max_size >> (oversized_bin_count - 1 - last)) & (max_size << first);
+}
+
+// Returns the lowest bin of a non-empty mask.
+inline std::size_t lowest_oversized_bin(std::size_t mask)
+{
+  return static_cast<std::size_t>(::cuda::std::countr_zero(mask));
+}
+
+} // namespace detail
+
 namespace mr
 {
 
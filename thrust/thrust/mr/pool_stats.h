@@ -0,0 +1,242 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A snapshot of the state of a pooling resource, for introspection and tuning of \p pool_options.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cstddef>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! Statistics of a single bucket, i.e. the pool of blocks of a single size, of a pooling resource.
+ */
+struct pool_bucket_stats
+{
+  /*! The size of the blocks in this bucket.
+   */
+  std::size_t block_size;
+  /*! The number of blocks of this bucket which are cached, i.e. not currently allocated to the user.
+   */
+  std::size_t free_blocks;
+
+  /*! The number of allocations served from the blocks already cached in this bucket. Only counted when \p
+   * THRUST_MR_ENABLE_POOL_STATS is defined; zero otherwise.
+   */
+  std::size_t hits;
+  /*! The number of allocations from this bucket which needed a new chunk from upstream. Only counted when \p
+   * THRUST_MR_ENABLE_POOL_STATS is defined; zero otherwise.
+   */
+  std::size_t misses;
+};
+
+/*! A snapshot of the state of a pooling resource, as returned by its \p stats member function.
+ *
+ *  The sizes and counts of the memory currently held by the pool are always available; they are computed when the
+ *      snapshot is taken, in time linear in the number of chunks and cached blocks. The counters of events and the
+ *      high-water marks are only maintained when \p THRUST_MR_ENABLE_POOL_STATS is defined before including any of the
+ *      pool headers (consistently across the whole program), and are zero otherwise, so that pools which don't need
+ *      them don't pay for them.
+ */
+struct pool_stats
+{
+  /*! The number of bytes currently held from upstream, including the bookkeeping overhead the pool places in them.
+   */
+  std::size_t upstream_bytes;
+  /*! The number of bytes held from upstream which aren't currently allocated to the user: free blocks in the buckets,
+   * and cached oversized blocks.
+   */
+  std::size_t cached_bytes;
+  /*! The number of chunks currently held from upstream to be split into blocks of the buckets.
+   */
+  std::size_t chunks;
+  /*! The number of oversized and/or overaligned blocks currently held from upstream, whether allocated or cached.
+   */
+  std::size_t oversized_blocks;
+  /*! The number of cached oversized and/or overaligned blocks.
+   */
+  std::size_t cached_oversized_blocks;
+  /*! The statistics of each bucket, from the smallest block size to the largest.
+   */
+  std::vector<pool_bucket_stats> buckets;
+
+  /*! The number of oversized and/or overaligned allocations served from a cached block.
+   */
+  std::size_t oversized_hits;
+  /*! The number of oversized and/or overaligned allocations which needed a new block from upstream.
+   */
+  std::size_t oversized_misses;
+  /*! The number of calls made to the upstream resource's \p allocate.
+   */
+  std::size_t upstream_allocations;
+  /*! The number of calls made to the upstream resource's \p deallocate.
+   */
+  std::size_t upstream_deallocations;
+  /*! The highest value of \p upstream_bytes seen so far.
+   */
+  std::size_t peak_upstream_bytes;
+  /*! The number of bytes currently allocated to the user, with requests below the smallest block size counted as that
+   * size.
+   */
+  std::size_t allocated_bytes;
+  /*! The highest value of \p allocated_bytes seen so far.
+   */
+  std::size_t peak_allocated_bytes;
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+
+namespace detail
+{
+
+// The counters of a pool which are only maintained when THRUST_MR_ENABLE_POOL_STATS is defined; otherwise all their
+// member functions do nothing, and the counters read as zero.
+struct pool_counters
+{
+#if defined(THRUST_MR_ENABLE_POOL_STATS)
+  std::size_t oversized_hits         = 0;
+  std::size_t oversized_misses       = 0;
+  std::size_t upstream_allocations   = 0;
+  std::size_t upstream_deallocations = 0;
+  std::size_t upstream_bytes         = 0;
+  std::size_t peak_upstream_bytes    = 0;
+  std::size_t allocated_bytes        = 0;
+  std::size_t peak_allocated_bytes   = 0;
+
+  void oversized_hit()
+  {
+    ++oversized_hits;
+  }
+
+  void oversized_miss()
+  {
+    ++oversized_misses;
+  }
+
+  void upstream_allocation(std::size_t bytes)
+  {
+    ++upstream_allocations;
+    upstream_bytes += bytes;
+    peak_upstream_bytes = upstream_bytes > peak_upstream_bytes ? upstream_bytes : peak_upstream_bytes;
+  }
+
+  void upstream_deallocation(std::size_t bytes)
+  {
+    ++upstream_deallocations;
+    upstream_bytes -= bytes;
+  }
+
+  void allocation(std::size_t bytes)
+  {
+    allocated_bytes += bytes;
+    peak_allocated_bytes = allocated_bytes > peak_allocated_bytes ? allocated_bytes : peak_allocated_bytes;
+  }
+
+  void deallocation(std::size_t bytes)
+  {
+    allocated_bytes -= bytes;
+  }
+
+  void copy_to(mr::pool_stats& stats) const
+  {
+    stats.oversized_hits         = oversized_hits;
+    stats.oversized_misses       = oversized_misses;
+    stats.upstream_allocations   = upstream_allocations;
+    stats.upstream_deallocations = upstream_deallocations;
+    stats.peak_upstream_bytes    = peak_upstream_bytes;
+    stats.allocated_bytes        = allocated_bytes;
+    stats.peak_allocated_bytes   = peak_allocated_bytes;
+  }
+#else // ^^^ THRUST_MR_ENABLE_POOL_STATS ^^^ / vvv !THRUST_MR_ENABLE_POOL_STATS vvv
+  void oversized_hit() {}
+  void oversized_miss() {}
+  void upstream_allocation(std::size_t) {}
+  void upstream_deallocation(std::size_t) {}
+  void allocation(std::size_t) {}
+  void deallocation(std::size_t) {}
+
+  void copy_to(mr::pool_stats& stats) const
+  {
+    stats.oversized_hits         = 0;
+    stats.oversized_misses       = 0;
+    stats.upstream_allocations   = 0;
+    stats.upstream_deallocations = 0;
+    stats.peak_upstream_bytes    = 0;
+    stats.allocated_bytes        = 0;
+    stats.peak_allocated_bytes   = 0;
+  }
+#endif // !THRUST_MR_ENABLE_POOL_STATS
+};
+
+// The hit and miss counters of a single bucket of a pool; see pool_counters.
+struct pool_bucket_counters
+{
+#if defined(THRUST_MR_ENABLE_POOL_STATS)
+  std::size_t hits   = 0;
+  std::size_t misses = 0;
+
+  void hit()
+  {
+    ++hits;
+  }
+
+  void miss()
+  {
+    ++misses;
+  }
+
+  void copy_to(mr::pool_bucket_stats& stats) const
+  {
+    stats.hits   = hits;
+    stats.misses = misses;
+  }
+#else // ^^^ THRUST_MR_ENABLE_POOL_STATS ^^^ / vvv !THRUST_MR_ENABLE_POOL_STATS vvv
+  void hit() {}
+  void miss() {}
+
+  void copy_to(mr::pool_bucket_stats& stats) const
+  {
+    stats.hits   = 0;
+    stats.misses = 0;
+  }
+#endif // !THRUST_MR_ENABLE_POOL_STATS
+};
+
+} // namespace detail
+THRUST_NAMESPACE_END
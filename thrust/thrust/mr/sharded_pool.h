@@ -0,0 +1,428 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A thread-safe pool resource which scales with the number of threads using it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/pool.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <cuda/std/__bit/integral.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A thread-safe pool resource, meant as a drop-in replacement for \p synchronized_pool_resource in code where many
+ *      threads allocate and deallocate concurrently.
+ *
+ *  Blocks that are not oversized are cached in magazines: small, fixed-capacity stacks of blocks of a single size.
+ *      Every thread is assigned to one of a number of shards, and each shard holds up to two magazines per block size;
+ *      a thread only takes the lock of its own shard, which is uncontended as long as there are no more threads than
+ *      shards. Magazines that a shard can't keep are exchanged with a shared depot, made of lock-free stacks, one of
+ *      full magazines per block size and one of empty magazines. The stacks are tagged with a version counter, to
+ *      protect them from the ABA problem. Because a shard never holds more than two magazines of a given size, blocks
+ *      freed by one thread and needed by another only sit in a shard for a bounded amount of time.
+ *
+ *  Only refilling magazines and oversized and/or overaligned allocations go to an internal \p
+ *      unsynchronized_pool_resource, under a single mutex. \p release must not be called concurrently with any other
+ *      member function.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template <typename Upstream>
+class sharded_pool_resource final : public memory_resource<typename Upstream::pointer>
+{
+  using unsync_pool = unsynchronized_pool_resource<Upstream>;
+  using lock_t      = std::lock_guard<std::mutex>;
+
+  using void_ptr = typename Upstream::pointer;
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return unsync_pool::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   */
+  sharded_pool_resource(Upstream* upstream, pool_options options = get_default_options())
+      : m_options(options)
+      , m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size))
+      , m_size_classes(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1)
+      , m_shard_count(shard_count())
+      , m_shards(new shard[m_shard_count])
+      , m_full(new depot[m_size_classes])
+      , m_empty()
+      , m_magazine_count(0)
+      , m_segments()
+      , m_pool(upstream, options)
+  {
+    assert(m_options.validate());
+
+    for (std::size_t i = 0; i < m_shard_count; ++i)
+    {
+      m_shards[i].caches.reset(new magazine_pair[m_size_classes]);
+    }
+  }
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   */
+  sharded_pool_resource(pool_options options = get_default_options())
+      : sharded_pool_resource(get_global_resource<Upstream>(), options)
+  {}
+
+  /*! Destructor. Releases all held memory to upstream.
+   */
+  ~sharded_pool_resource()
+  {
+    for (std::atomic<magazine*>& segment : m_segments)
+    {
+      delete[] segment.load(std::memory_order_relaxed);
+    }
+  }
+
+  /*! Releases all held memory to upstream. Must not be called concurrently with any other member function.
+   */
+  void release()
+  {
+    for (std::size_t i = 0; i < m_shard_count * m_size_classes; ++i)
+    {
+      m_shards[i / m_size_classes].caches[i % m_size_classes] = magazine_pair{};
+    }
+    for (std::size_t i = 0; i < m_size_classes; ++i)
+    {
+      m_full[i].head.store(0, std::memory_order_relaxed);
+    }
+    m_empty.head.store(0, std::memory_order_relaxed);
+    m_magazine_count.store(0, std::memory_order_relaxed);
+
+    lock_t lock(m_pool_mutex);
+    m_pool.release();
+  }
+
+  /*! Returns a snapshot of the memory held by the internal pool; see \p unsynchronized_pool_resource::stats. Blocks
+   *      cached in magazines count as allocated.
+   */
+  pool_stats stats()
+  {
+    lock_t lock(m_pool_mutex);
+    return m_pool.stats();
+  }
+
+  /*! Returns cached memory of the internal pool to upstream; see \p unsynchronized_pool_resource::trim. Blocks cached
+   *      in magazines count as allocated, so chunks holding any of them are kept.
+   */
+  std::size_t trim(std::size_t max_cached_bytes = 0)
+  {
+    lock_t lock(m_pool_mutex);
+    return m_pool.trim(max_cached_bytes);
+  }
+
+  [[nodiscard]] virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes = (std::max)(bytes, m_options.smallest_block_size);
+    assert(detail::is_power_of_2(alignment));
+
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_pool_mutex);
+      return m_pool.do_allocate(bytes, alignment);
+    }
+
+    const std::size_t bytes_log2 = detail::log2_ri(bytes);
+    const std::size_t size_class = bytes_log2 - m_smallest_block_log2;
+
+    shard& s = this_thread_shard();
+    lock_t lock(s.mutex);
+    magazine_pair& cache = s.caches[size_class];
+
+    if (cache.loaded && cache.loaded->count != 0)
+    {
+      return cache.loaded->blocks[--cache.loaded->count];
+    }
+    if (cache.previous && cache.previous->count != 0)
+    {
+      std::swap(cache.loaded, cache.previous);
+      return cache.loaded->blocks[--cache.loaded->count];
+    }
+
+    // both magazines are empty; trade one of them in for a full magazine from the depot, or refill it from the pool
+    if (magazine* full = m_full[size_class].pop(*this))
+    {
+      if (cache.previous)
+      {
+        m_empty.push(*cache.previous);
+      }
+      cache.previous = cache.loaded;
+      cache.loaded   = full;
+    }
+    else
+    {
+      if (!cache.loaded)
+      {
+        cache.loaded = acquire_empty_magazine();
+      }
+      refill(*cache.loaded, bytes_log2);
+    }
+
+    return cache.loaded->blocks[--cache.loaded->count];
+  }
+
+  virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    n = (std::max)(n, m_options.smallest_block_size);
+    assert(detail::is_power_of_2(alignment));
+
+    if (n > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_pool_mutex);
+      m_pool.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    const std::size_t size_class = detail::log2_ri(n) - m_smallest_block_log2;
+
+    shard& s = this_thread_shard();
+    lock_t lock(s.mutex);
+    magazine_pair& cache = s.caches[size_class];
+
+    if (cache.loaded && cache.loaded->count != magazine_capacity)
+    {
+      cache.loaded->blocks[cache.loaded->count++] = p;
+      return;
+    }
+    if (cache.previous && cache.previous->count != magazine_capacity)
+    {
+      std::swap(cache.loaded, cache.previous);
+      cache.loaded->blocks[cache.loaded->count++] = p;
+      return;
+    }
+
+    // both magazines are full (or missing); hand one of them over to the depot and start an empty one
+    magazine* empty = nullptr;
+    try
+    {
+      empty = acquire_empty_magazine();
+    }
+    catch (std::bad_alloc&)
+    {
+      // no magazine can be had to hold the block; it goes back to the pool, from which it was refilled
+      lock_t pool_lock(m_pool_mutex);
+      m_pool.do_deallocate(p, std::size_t{1} << detail::log2_ri(n), m_options.alignment);
+      return;
+    }
+
+    if (cache.previous)
+    {
+      m_full[size_class].push(*cache.previous);
+    }
+    cache.previous = cache.loaded;
+    cache.loaded   = empty;
+
+    cache.loaded->blocks[cache.loaded->count++] = p;
+  }
+
+private:
+  // XXX these values are tuning opportunities
+  static constexpr std::size_t magazine_capacity = 32;
+  static constexpr std::size_t refill_bytes      = std::size_t{1} << 16;
+
+  // magazines are allocated in segments which double in size, so that they never move
+  static constexpr std::size_t first_segment_size = 64;
+  static constexpr std::size_t segment_count      = 26;
+
+  struct magazine
+  {
+    std::uint32_t index;
+    std::atomic<std::uint32_t> next;
+    std::size_t count;
+    void_ptr blocks[magazine_capacity];
+  };
+
+  struct magazine_pair
+  {
+    magazine* loaded   = nullptr;
+    magazine* previous = nullptr;
+  };
+
+  struct alignas(64) shard
+  {
+    std::mutex mutex;
+    std::unique_ptr<magazine_pair[]> caches;
+  };
+
+  // A lock-free stack of magazines. The head holds the index of the top magazine plus one in its lower half, and a
+  // version counter, bumped by every push and pop, in its upper half.
+  struct alignas(64) depot
+  {
+    std::atomic<std::uint64_t> head{0};
+
+    void push(magazine& m)
+    {
+      std::uint64_t old = head.load(std::memory_order_relaxed);
+      std::uint64_t top;
+      do
+      {
+        m.next.store(static_cast<std::uint32_t>(old), std::memory_order_relaxed);
+        top = (((old >> 32) + 1) << 32) | (static_cast<std::uint64_t>(m.index) + 1);
+      } while (!head.compare_exchange_weak(old, top, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    magazine* pop(sharded_pool_resource& pool)
+    {
+      std::uint64_t old = head.load(std::memory_order_acquire);
+      while (static_cast<std::uint32_t>(old) != 0)
+      {
+        magazine& m = pool.get(static_cast<std::uint32_t>(old) - 1);
+        // the magazine may be popped and pushed back concurrently; the version counter makes the exchange fail if it
+        // was, as the link read here may then be stale
+        const std::uint64_t top = (((old >> 32) + 1) << 32) | m.next.load(std::memory_order_relaxed);
+        if (head.compare_exchange_weak(old, top, std::memory_order_acquire, std::memory_order_acquire))
+        {
+          return &m;
+        }
+      }
+      return nullptr;
+    }
+  };
+
+  static std::size_t shard_count()
+  {
+    const std::size_t threads = (std::max)(1u, std::thread::hardware_concurrency());
+    return ::cuda::std::bit_ceil(threads);
+  }
+
+  shard& this_thread_shard()
+  {
+    // threads are spread over the shards in the order in which they first use any sharded pool
+    static std::atomic<std::size_t> next_thread{0};
+    static thread_local const std::size_t thread = next_thread.fetch_add(1, std::memory_order_relaxed);
+
+    return m_shards[thread & (m_shard_count - 1)];
+  }
+
+  static std::size_t segment_of(std::size_t index)
+  {
+    return ::cuda::std::bit_width(index / first_segment_size + 1) - 1;
+  }
+
+  magazine& get(std::uint32_t index)
+  {
+    const std::size_t segment = segment_of(index);
+    magazine* magazines       = m_segments[segment].load(std::memory_order_acquire);
+    return magazines[index - first_segment_size * ((std::size_t{1} << segment) - 1)];
+  }
+
+  magazine* acquire_empty_magazine()
+  {
+    if (magazine* m = m_empty.pop(*this))
+    {
+      return m;
+    }
+
+    const std::size_t index   = m_magazine_count.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t segment = segment_of(index);
+    if (segment >= segment_count)
+    {
+      throw thrust::system::detail::bad_alloc("sharded_pool_resource: too many magazines");
+    }
+
+    if (!m_segments[segment].load(std::memory_order_acquire))
+    {
+      lock_t lock(m_segment_mutex);
+      if (!m_segments[segment].load(std::memory_order_relaxed))
+      {
+        m_segments[segment].store(new magazine[first_segment_size << segment](), std::memory_order_release);
+      }
+    }
+
+    magazine& m = get(static_cast<std::uint32_t>(index));
+    m.index     = static_cast<std::uint32_t>(index);
+    m.count     = 0;
+    return &m;
+  }
+
+  void refill(magazine& m, std::size_t bytes_log2)
+  {
+    const std::size_t bytes = std::size_t{1} << bytes_log2;
+    const std::size_t n     = (std::max)(std::size_t{1}, (std::min)(magazine_capacity, refill_bytes >> bytes_log2));
+
+    lock_t lock(m_pool_mutex);
+    while (m.count < n)
+    {
+      m.blocks[m.count] = m_pool.do_allocate(bytes, m_options.alignment);
+      ++m.count;
+    }
+  }
+
+  pool_options m_options;
+  std::size_t m_smallest_block_log2;
+  std::size_t m_size_classes;
+
+  std::size_t m_shard_count;
+  std::unique_ptr<shard[]> m_shards;
+
+  std::unique_ptr<depot[]> m_full;
+  depot m_empty;
+
+  std::mutex m_segment_mutex;
+  std::atomic<std::size_t> m_magazine_count;
+  std::atomic<magazine*> m_segments[segment_count];
+
+  std::mutex m_pool_mutex;
+  unsync_pool m_pool;
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -89,6 +89,22 @@ public:
     upstream_pool.release();
   }
 
+  /*! Returns a snapshot of the memory held by the pool; see \p unsynchronized_pool_resource::stats.
+   */
+  pool_stats stats()
+  {
+    lock_t lock(mtx);
+    return upstream_pool.stats();
+  }
+
+  /*! Returns cached memory to upstream; see \p unsynchronized_pool_resource::trim.
+   */
+  std::size_t trim(std::size_t max_cached_bytes = 0)
+  {
+    lock_t lock(mtx);
+    return upstream_pool.trim(max_cached_bytes);
+  }
+
   [[nodiscard]] virtual void_ptr
   do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
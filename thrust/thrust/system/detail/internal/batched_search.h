@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file batched_search.h
+ *  \brief Lock-step binary searches of many values in one sorted range.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The search kinds of batched_search. goes_right tells whether the position
+// searched for lies after the probed element, and result turns the position
+// into the value written to the output.
+
+struct lower_bound_search
+{
+  template <typename Reference, typename T, typename StrictWeakOrdering>
+  static bool goes_right(Reference&& x, const T& value, StrictWeakOrdering& comp)
+  {
+    return comp(x, value);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+  static Size result(RandomAccessIterator, Size, Size pos, const T&, StrictWeakOrdering&)
+  {
+    return pos;
+  }
+};
+
+struct upper_bound_search
+{
+  template <typename Reference, typename T, typename StrictWeakOrdering>
+  static bool goes_right(Reference&& x, const T& value, StrictWeakOrdering& comp)
+  {
+    return !comp(value, x);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+  static Size result(RandomAccessIterator, Size, Size pos, const T&, StrictWeakOrdering&)
+  {
+    return pos;
+  }
+};
+
+struct binary_search_search
+{
+  template <typename Reference, typename T, typename StrictWeakOrdering>
+  static bool goes_right(Reference&& x, const T& value, StrictWeakOrdering& comp)
+  {
+    return comp(x, value);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+  static bool result(RandomAccessIterator first, Size n, Size pos, const T& value, StrictWeakOrdering& comp)
+  {
+    return pos != n && !comp(value, first[pos]);
+  }
+};
+
+// Searches the sorted range [first, first + n) for each of the num_values
+// values starting at values and writes one result per value to output.
+//
+// A single binary search is a chain of dependent loads, each of which is
+// likely a cache miss once the range outgrows the cache. The values are
+// therefore searched in groups: every search of a group halves the same
+// length in the same number of branch-free steps, so the searches advance in
+// lock step and the loads of one step are independent of each other and
+// overlap in the memory system.
+template <typename SearchKind,
+          typename RandomAccessIterator1,
+          typename Size,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename StrictWeakOrdering>
+void batched_search(
+  RandomAccessIterator1 first,
+  Size n,
+  RandomAccessIterator2 values,
+  Size num_values,
+  RandomAccessIterator3 output,
+  StrictWeakOrdering comp)
+{
+  constexpr int group_size = 16;
+
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size base[group_size];
+
+  for (Size group_begin = 0; group_begin < num_values; group_begin += group_size)
+  {
+    const int count = static_cast<int>(::cuda::std::min<Size>(group_size, num_values - group_begin));
+
+    for (int i = 0; i < count; ++i)
+    {
+      base[i] = 0;
+    }
+
+    // the position searched for stays within [base, base + len]
+    for (Size len = n; len > 1;)
+    {
+      const Size half = len / 2;
+
+      for (int i = 0; i < count; ++i)
+      {
+        const bool right = SearchKind::goes_right(first[base[i] + half], values[group_begin + i], wrapped_comp);
+
+        base[i] += right ? half : Size(0);
+      }
+
+      len -= half;
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+      Size pos = base[i];
+
+      if (n > 0 && SearchKind::goes_right(first[pos], values[group_begin + i], wrapped_comp))
+      {
+        ++pos;
+      }
+
+      output[group_begin + i] = SearchKind::result(first, n, pos, values[group_begin + i], wrapped_comp);
+    }
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,207 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file extrema.h
+ *  \brief Extrema of the tiles of a range and their combination.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The extremum kinds of tile_extremum. replaces tells whether x takes the
+// place of the extremum m found so far, which keeps the first occurrence of
+// the extremum.
+
+struct min_extremum
+{
+  template <typename T, typename BinaryPredicate>
+  static bool replaces(const T& x, const T& m, BinaryPredicate& comp)
+  {
+    return comp(x, m);
+  }
+};
+
+struct max_extremum
+{
+  template <typename T, typename BinaryPredicate>
+  static bool replaces(const T& x, const T& m, BinaryPredicate& comp)
+  {
+    return comp(m, x);
+  }
+};
+
+// Returns the index of the first extremum of [begin, end), which must not be
+// empty. Arithmetic values are first reduced to the value of the extremum, in
+// a loop without the index which compilers can vectorize, and then searched
+// for: the first value which the extremum would not replace is equivalent to
+// it.
+//
+// comp must be a strict weak ordering on the values of the range. For
+// unordered values such as NaNs, the extremum found depends on the order of
+// the comparisons, so the result is unspecified and may differ from the
+// sequential backend, though it is always an index of [begin, end).
+template <typename Extremum, typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+Size tile_extremum(RandomAccessIterator first, Size begin, Size end, BinaryPredicate comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // wrap comp
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_comp{comp};
+
+  value_type m = first[begin];
+  Size result  = begin;
+
+  if constexpr (::cuda::std::is_arithmetic_v<value_type>)
+  {
+    for (Size i = begin + 1; i < end; ++i)
+    {
+      const value_type x = first[i];
+      m                  = Extremum::replaces(x, m, wrapped_comp) ? x : m;
+    }
+
+    while (Extremum::replaces(m, static_cast<value_type>(first[result]), wrapped_comp))
+    {
+      ++result;
+    }
+  }
+  else
+  {
+    for (Size i = begin + 1; i < end; ++i)
+    {
+      value_type x = first[i];
+
+      if (Extremum::replaces(x, m, wrapped_comp))
+      {
+        m      = x;
+        result = i;
+      }
+    }
+  }
+
+  return result;
+}
+
+// Returns the indices of the first minimum and the first maximum of
+// [begin, end), which must not be empty, like tile_extremum does for either.
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+thrust::pair<Size, Size> tile_minmax(RandomAccessIterator first, Size begin, Size end, BinaryPredicate comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // wrap comp
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_comp{comp};
+
+  value_type min = first[begin];
+  value_type max = min;
+  Size min_index = begin;
+  Size max_index = begin;
+
+  if constexpr (::cuda::std::is_arithmetic_v<value_type>)
+  {
+    for (Size i = begin + 1; i < end; ++i)
+    {
+      const value_type x = first[i];
+      min                = min_extremum::replaces(x, min, wrapped_comp) ? x : min;
+      max                = max_extremum::replaces(x, max, wrapped_comp) ? x : max;
+    }
+
+    while (min_extremum::replaces(min, static_cast<value_type>(first[min_index]), wrapped_comp))
+    {
+      ++min_index;
+    }
+
+    while (max_extremum::replaces(max, static_cast<value_type>(first[max_index]), wrapped_comp))
+    {
+      ++max_index;
+    }
+  }
+  else
+  {
+    for (Size i = begin + 1; i < end; ++i)
+    {
+      value_type x = first[i];
+
+      if (min_extremum::replaces(x, min, wrapped_comp))
+      {
+        min       = x;
+        min_index = i;
+      }
+
+      if (max_extremum::replaces(x, max, wrapped_comp))
+      {
+        max       = x;
+        max_index = i;
+      }
+    }
+  }
+
+  return thrust::make_pair(min_index, max_index);
+}
+
+// Returns the index of the first extremum among the indices of the extrema of
+// the tiles, given in the order of the tiles.
+template <typename Extremum, typename RandomAccessIterator, typename Iterator, typename Size, typename BinaryPredicate>
+Size combine_extrema(RandomAccessIterator first, Iterator indices, Size num_tiles, BinaryPredicate comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // wrap comp
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_comp{comp};
+
+  Size result  = indices[0];
+  value_type m = first[result];
+
+  for (Size i = 1; i < num_tiles; ++i)
+  {
+    const Size index = indices[i];
+    value_type x     = first[index];
+
+    if (Extremum::replaces(x, m, wrapped_comp))
+    {
+      m      = x;
+      result = index;
+    }
+  }
+
+  return result;
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
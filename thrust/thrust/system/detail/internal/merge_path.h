@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file merge_path.h
+ *  \brief Partitioning of merges along the merge path.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/pair.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Returns the number of elements of [first1, first1 + n1) among the first diag
+// elements of the stable merge of [first1, first1 + n1) and
+// [first2, first2 + n2); the remaining diag - i elements come from the second
+// range. Splitting both ranges at the merge path of evenly spaced diagonals
+// gives independent merges of equal output size.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Size, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size merge_path(
+  RandomAccessIterator1 first1, Size n1, RandomAccessIterator2 first2, Size n2, Size diag, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size begin = ::cuda::std::max<Size>(0, diag - n2);
+  Size end   = ::cuda::std::min<Size>(diag, n1);
+
+  while (begin < end)
+  {
+    Size mid = begin + (end - begin) / 2;
+
+    // ties are resolved in favor of the first range
+    if (!wrapped_comp(first2[diag - 1 - mid], first1[mid]))
+    {
+      begin = mid + 1;
+    }
+    else
+    {
+      end = mid;
+    }
+  }
+
+  return begin;
+}
+
+// Returns the number of elements of [first, first + n) which order strictly
+// before *pivot.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Size, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size
+lower_bound_index(RandomAccessIterator1 first, Size n, RandomAccessIterator2 pivot, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size begin = 0;
+  Size end   = n;
+
+  while (begin < end)
+  {
+    Size mid = begin + (end - begin) / 2;
+
+    if (wrapped_comp(first[mid], *pivot))
+    {
+      begin = mid + 1;
+    }
+    else
+    {
+      end = mid;
+    }
+  }
+
+  return begin;
+}
+
+// Like merge_path, but moves the split back so that no run of equivalent
+// elements straddles it: all elements equivalent to the first element after
+// the split end up after it, in both ranges. Set operations pair up
+// equivalent elements across the two ranges, so they can only be partitioned
+// at such splits. Returns the split positions in both ranges.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Size, typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<Size, Size> equivalence_preserving_merge_path(
+  RandomAccessIterator1 first1, Size n1, RandomAccessIterator2 first2, Size n2, Size diag, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  const Size i = merge_path(first1, n1, first2, n2, diag, comp);
+  const Size j = diag - i;
+
+  // the first element after the split comes from the second range only when
+  // it orders strictly before the next element of the first range
+  if (j < n2 && (i == n1 || wrapped_comp(first2[j], first1[i])))
+  {
+    return thrust::make_pair(
+      lower_bound_index(first1, i, first2 + j, comp), lower_bound_index(first2, j, first2 + j, comp));
+  }
+  else if (i < n1)
+  {
+    return thrust::make_pair(
+      lower_bound_index(first1, i, first1 + i, comp), lower_bound_index(first2, j, first1 + i, comp));
+  }
+
+  return thrust::make_pair(i, j);
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
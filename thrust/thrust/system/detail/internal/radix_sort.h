@@ -0,0 +1,179 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file radix_sort.h
+ *  \brief Building blocks of parallel LSD radix sorts.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// A parallel LSD radix sort splits the keys into tiles and makes one pass per
+// digit, starting from the least significant one. Every pass counts the
+// digits of each tile, scans the counts of all tiles into the output offset
+// of each tile's first key of each digit, and then lets every tile scatter
+// its keys to their offsets. Tiles scatter their keys in order, so every pass
+// is stable.
+
+template <typename KeyType>
+struct radix_sort_traits
+{
+  using encoder      = thrust::system::detail::sequential::radix_sort_detail::RadixEncoder<KeyType>;
+  using encoded_type = decltype(::cuda::std::declval<encoder>()(::cuda::std::declval<KeyType>()));
+
+  static constexpr unsigned int radix_bits  = 8;
+  static constexpr unsigned int num_buckets = 1u << radix_bits;
+  static constexpr unsigned int num_passes  = (8 * sizeof(encoded_type) + radix_bits - 1) / radix_bits;
+
+  // descending sorts complement the encoded keys
+  template <bool Descending>
+  static unsigned int digit(const KeyType& key, unsigned int pass)
+  {
+    encoded_type x = encoder()(key);
+
+    if (Descending)
+    {
+      x = static_cast<encoded_type>(~x);
+    }
+
+    return static_cast<unsigned int>(x >> (radix_bits * pass)) & (num_buckets - 1);
+  }
+};
+
+// Keys can be radix sorted when their encoding is an unsigned integer which
+// orders like the keys and the ordering is less or greater.
+template <typename KeyType, typename StrictWeakOrdering>
+struct use_radix_sort
+    : ::cuda::std::_And<::cuda::std::is_arithmetic<KeyType>,
+                        ::cuda::std::_Not<::cuda::std::is_same<KeyType, bool>>,
+                        ::cuda::std::is_unsigned<typename radix_sort_traits<KeyType>::encoded_type>,
+                        ::cuda::std::disjunction<::cuda::std::is_same<StrictWeakOrdering, ::cuda::std::less<KeyType>>,
+                                                 ::cuda::std::is_same<StrictWeakOrdering, ::cuda::std::greater<KeyType>>>>
+{};
+
+template <typename KeyType, typename StrictWeakOrdering>
+struct radix_sort_is_descending : ::cuda::std::is_same<StrictWeakOrdering, ::cuda::std::greater<KeyType>>
+{};
+
+// Counts the digits of the keys [begin, end) of the tile.
+template <bool Descending, typename RandomAccessIterator, typename Size>
+void radix_histogram(RandomAccessIterator keys, Size begin, Size end, unsigned int pass, ::cuda::std::size_t* histogram)
+{
+  using traits = radix_sort_traits<thrust::detail::it_value_t<RandomAccessIterator>>;
+
+  for (unsigned int i = 0; i < traits::num_buckets; ++i)
+  {
+    histogram[i] = 0;
+  }
+
+  for (Size i = begin; i < end; ++i)
+  {
+    ++histogram[traits::template digit<Descending>(keys[i], pass)];
+  }
+}
+
+// Replaces the histograms of all tiles, stored one after the other, by the
+// output offsets of the tiles' first keys of each digit. Returns false when
+// all keys share the same digit, in which case the pass would not move them.
+template <unsigned int NumBuckets>
+bool radix_scan_histograms(::cuda::std::size_t* histograms, ::cuda::std::size_t num_tiles, ::cuda::std::size_t n)
+{
+  ::cuda::std::size_t sum = 0;
+
+  for (unsigned int bucket = 0; bucket < NumBuckets; ++bucket)
+  {
+    const ::cuda::std::size_t bucket_begin = sum;
+
+    for (::cuda::std::size_t tile = 0; tile < num_tiles; ++tile)
+    {
+      const ::cuda::std::size_t count = histograms[tile * NumBuckets + bucket];
+
+      histograms[tile * NumBuckets + bucket] = sum;
+
+      sum += count;
+    }
+
+    if (sum - bucket_begin == n)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Moves the keys [begin, end) of the tile, and their values if HasValues, to
+// the offsets computed by radix_scan_histograms.
+template <bool HasValues,
+          bool Descending,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size>
+void radix_scatter(
+  RandomAccessIterator1 keys,
+  RandomAccessIterator2 values,
+  Size begin,
+  Size end,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  unsigned int pass,
+  ::cuda::std::size_t* offsets)
+{
+  using traits = radix_sort_traits<thrust::detail::it_value_t<RandomAccessIterator1>>;
+
+  for (Size i = begin; i < end; ++i)
+  {
+    const ::cuda::std::size_t pos = offsets[traits::template digit<Descending>(keys[i], pass)]++;
+
+    keys_result[pos] = keys[i];
+
+    if constexpr (HasValues)
+    {
+      values_result[pos] = values[i];
+    }
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
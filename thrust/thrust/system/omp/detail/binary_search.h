@@ -25,8 +25,17 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/detail/internal/batched_search.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -71,6 +80,137 @@ bool binary_search(execution_policy<DerivedPolicy>& exec,
   return thrust::system::detail::generic::binary_search(exec, begin, end, value, comp);
 }
 
+namespace binary_search_detail
+{
+
+// Splits the values into the tiles of the default decomposition and searches
+// each tile with the lock-step searches of batched_search.
+template <typename SearchKind,
+          typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using traversal1 = typename iterator_traversal<ForwardIterator>::type;
+  using traversal2 = typename iterator_traversal<InputIterator>::type;
+  using traversal3 = typename iterator_traversal<OutputIterator>::type;
+  using traversal  = typename thrust::detail::minimum_type<traversal1, traversal2, traversal3>::type;
+
+  // other iterators fall back to the generic searches, which are named by
+  // their declarations: the helpers of generic/binary_search.inl may not be
+  // declared yet when the #include cycle through thrust/binary_search.h
+  // reaches this header
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    // we're attempting to launch an omp kernel, assert we're compiling with omp support
+    // ========================================================================
+    // X Note to the user: If you've found this line due to a compiler error, X
+    // X you need to enable OpenMP support in your compiler.                  X
+    // ========================================================================
+    static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                          (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                  "OpenMP compiler support is not enabled");
+
+    using difference_type = thrust::detail::it_difference_t<ForwardIterator>;
+
+    const difference_type n          = end - begin;
+    const difference_type num_values = values_end - values_begin;
+
+    thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+      thrust::system::omp::detail::default_decomposition(num_values);
+
+    using index_type = std::intptr_t;
+
+    const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type i = 0; i < num_tiles; ++i)
+    {
+      thrust::system::detail::internal::batched_search<SearchKind>(
+        begin, n, values_begin + decomp[i].begin(), decomp[i].size(), output + decomp[i].begin(), comp);
+    }
+
+    return output + num_values;
+  }
+  else if constexpr (::cuda::std::is_same_v<SearchKind, thrust::system::detail::internal::lower_bound_search>)
+  {
+    return thrust::system::detail::generic::lower_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+  else if constexpr (::cuda::std::is_same_v<SearchKind, thrust::system::detail::internal::upper_bound_search>)
+  {
+    return thrust::system::detail::generic::upper_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+  else
+  {
+    return thrust::system::detail::generic::binary_search(exec, begin, end, values_begin, values_end, output, comp);
+  }
+}
+
+} // end namespace binary_search_detail
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::binary_search<thrust::system::detail::internal::lower_bound_search>(
+    exec, begin, end, values_begin, values_end, output, comp);
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::binary_search<thrust::system::detail::internal::upper_bound_search>(
+    exec, begin, end, values_begin, values_end, output, comp);
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::binary_search<thrust::system::detail::internal::binary_search_search>(
+    exec, begin, end, values_begin, values_end, output, comp);
+}
+
 } // namespace detail
 } // namespace omp
 } // namespace system
@@ -25,8 +25,20 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
 #include <thrust/system/detail/generic/extrema.h>
+#include <thrust/system/detail/internal/extrema.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/type_traits/unwrap_contiguous_iterator.h>
+
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,28 +48,146 @@ namespace omp
 namespace detail
 {
 
+namespace extrema_detail
+{
+
+template <typename ForwardIterator>
+struct is_random_access
+    : ::cuda::std::is_convertible<typename iterator_traversal<ForwardIterator>::type, random_access_traversal_tag>
+{};
+
+// Finds the first extremum of each tile and then the first among those.
+template <typename Extremum, typename DerivedPolicy, typename RandomAccessIterator, typename BinaryPredicate>
+RandomAccessIterator extremum(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, BinaryPredicate comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using index_type = std::intptr_t;
+
+  const index_type n = static_cast<index_type>(last - first);
+
+  if (n == 0)
+  {
+    return last;
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  auto raw_first = thrust::try_unwrap_contiguous_iterator(first);
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> indices(exec, num_tiles);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    indices[i] =
+      thrust::system::detail::internal::tile_extremum<Extremum>(raw_first, decomp[i].begin(), decomp[i].end(), comp);
+  }
+
+  return first
+       + thrust::system::detail::internal::combine_extrema<Extremum>(raw_first, indices.begin(), num_tiles, comp);
+}
+
+} // end namespace extrema_detail
+
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator
 max_element(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
 {
-  // omp prefers generic::max_element to cpp::max_element
-  return thrust::system::detail::generic::max_element(exec, first, last, comp);
+  if constexpr (extrema_detail::is_random_access<ForwardIterator>::value)
+  {
+    return extrema_detail::extremum<thrust::system::detail::internal::max_extremum>(exec, first, last, comp);
+  }
+  else
+  {
+    // omp prefers generic::max_element to cpp::max_element
+    return thrust::system::detail::generic::max_element(exec, first, last, comp);
+  }
 } // end max_element()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator
 min_element(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
 {
-  // omp prefers generic::min_element to cpp::min_element
-  return thrust::system::detail::generic::min_element(exec, first, last, comp);
+  if constexpr (extrema_detail::is_random_access<ForwardIterator>::value)
+  {
+    return extrema_detail::extremum<thrust::system::detail::internal::min_extremum>(exec, first, last, comp);
+  }
+  else
+  {
+    // omp prefers generic::min_element to cpp::min_element
+    return thrust::system::detail::generic::min_element(exec, first, last, comp);
+  }
 } // end min_element()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 thrust::pair<ForwardIterator, ForwardIterator>
 minmax_element(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
 {
-  // omp prefers generic::minmax_element to cpp::minmax_element
-  return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
+  if constexpr (extrema_detail::is_random_access<ForwardIterator>::value)
+  {
+    // we're attempting to launch an omp kernel, assert we're compiling with omp support
+    // ========================================================================
+    // X Note to the user: If you've found this line due to a compiler error, X
+    // X you need to enable OpenMP support in your compiler.                  X
+    // ========================================================================
+    static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                          (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                  "OpenMP compiler support is not enabled");
+
+    using index_type = std::intptr_t;
+
+    const index_type n = static_cast<index_type>(last - first);
+
+    if (n == 0)
+    {
+      return thrust::make_pair(last, last);
+    }
+
+    thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+      thrust::system::omp::detail::default_decomposition(n);
+
+    const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+    auto raw_first = thrust::try_unwrap_contiguous_iterator(first);
+
+    // the indices of the minima of the tiles followed by those of the maxima
+    thrust::detail::temporary_array<index_type, DerivedPolicy> indices(exec, 2 * num_tiles);
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type i = 0; i < num_tiles; ++i)
+    {
+      const thrust::pair<index_type, index_type> minmax =
+        thrust::system::detail::internal::tile_minmax(raw_first, decomp[i].begin(), decomp[i].end(), comp);
+
+      indices[i]             = minmax.first;
+      indices[num_tiles + i] = minmax.second;
+    }
+
+    return thrust::make_pair(
+      first
+        + thrust::system::detail::internal::combine_extrema<thrust::system::detail::internal::min_extremum>(
+          raw_first, indices.begin(), num_tiles, comp),
+      first
+        + thrust::system::detail::internal::combine_extrema<thrust::system::detail::internal::max_extremum>(
+          raw_first, indices.begin() + num_tiles, num_tiles, comp));
+  }
+  else
+  {
+    // omp prefers generic::minmax_element to cpp::minmax_element
+    return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
+  }
 } // end minmax_element()
 
 } // namespace detail
@@ -29,8 +29,19 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/find.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/find.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -40,11 +51,81 @@ namespace omp
 namespace detail
 {
 
+namespace find_detail
+{
+
+// Lowers best to index unless it already holds a lower one.
+inline void fetch_min(::cuda::std::atomic<std::intptr_t>& best, std::intptr_t index)
+{
+  std::intptr_t current = best.load(::cuda::std::memory_order_relaxed);
+
+  while (index < current && !best.compare_exchange_weak(current, index, ::cuda::std::memory_order_relaxed))
+  {
+  }
+}
+
+} // end namespace find_detail
+
+// Each tile is searched front to back in blocks. A hit lowers the shared
+// index of the first hit, and the tiles stop at the first block past it, so
+// that the other tiles give up early once a hit near the front is found.
 template <typename DerivedPolicy, typename InputIterator, typename Predicate>
 InputIterator find_if(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, Predicate pred)
 {
-  // omp prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  using traversal = typename iterator_traversal<InputIterator>::type;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    // we're attempting to launch an omp kernel, assert we're compiling with omp support
+    // ========================================================================
+    // X Note to the user: If you've found this line due to a compiler error, X
+    // X you need to enable OpenMP support in your compiler.                  X
+    // ========================================================================
+    static_assert(thrust::detail::depend_on_instantiation<InputIterator,
+                                                          (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                  "OpenMP compiler support is not enabled");
+
+    using index_type = std::intptr_t;
+
+    const index_type n = static_cast<index_type>(last - first);
+
+    const index_type block_size = 1 << 12;
+
+    thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+      thrust::system::omp::detail::default_decomposition(n);
+
+    const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+    ::cuda::std::atomic<index_type> best(n);
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type i = 0; i < num_tiles; ++i)
+    {
+      for (index_type block = decomp[i].begin(); block < decomp[i].end(); block += block_size)
+      {
+        if (best.load(::cuda::std::memory_order_relaxed) < block)
+        {
+          break;
+        }
+
+        const index_type block_end = ::cuda::std::min(decomp[i].end(), block + block_size);
+        const index_type hit       = thrust::find_if(thrust::seq, first + block, first + block_end, pred) - first;
+
+        if (hit < block_end)
+        {
+          find_detail::fetch_min(best, hit);
+          break;
+        }
+      }
+    }
+
+    return first + best.load();
+  }
+  else
+  {
+    // omp prefers generic::find_if to cpp::find_if
+    return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  }
 }
 
 } // end namespace detail
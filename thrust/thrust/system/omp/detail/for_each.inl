@@ -64,7 +64,9 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
   using DifferenceType    = thrust::detail::it_difference_t<RandomAccessIterator>;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
+  // a static schedule splits the range the same way on every call of the same size, so the elements a thread
+  // first touches, e.g. when a vector is constructed, are the ones it gets again in later traversals
+  THRUST_PRAGMA_OMP(parallel for schedule(static))
   for (DifferenceType i = 0; i < signed_n; ++i)
   {
     RandomAccessIterator temp = first + i;
@@ -25,10 +25,21 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/distance.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
 #include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -37,6 +48,125 @@ namespace omp
 namespace detail
 {
 
+namespace reduce_by_key_detail
+{
+
+// Counts the segment tails in [begin, end) of the n keys and returns the
+// position one past the last of them through segment_end, or begin if the
+// tile has no tail. The last key is a tail by definition.
+template <typename RandomIterator, typename Size, typename BinaryPredicate>
+Size count_tails(RandomIterator keys, Size n, Size begin, Size end, BinaryPredicate binary_pred, Size& segment_end)
+{
+  using key_type = thrust::detail::it_value_t<RandomIterator>;
+
+  Size count  = 0;
+  segment_end = begin;
+
+  key_type key = keys[begin];
+
+  for (Size j = begin; j < end; ++j)
+  {
+    bool is_tail = true;
+
+    if (j + 1 < n)
+    {
+      key_type next = keys[j + 1];
+      is_tail       = !binary_pred(key, next);
+      key           = next;
+    }
+
+    if (is_tail)
+    {
+      ++count;
+      segment_end = j + 1;
+    }
+  }
+
+  return count;
+}
+
+// Reduces the values in [begin, end) into a carry.
+template <typename RandomIterator, typename Size, typename BinaryFunction>
+thrust::detail::it_value_t<RandomIterator>
+reduce_carry(RandomIterator values, Size begin, Size end, BinaryFunction binary_op)
+{
+  using value_type = thrust::detail::it_value_t<RandomIterator>;
+
+  value_type carry = values[begin];
+
+  for (Size j = begin + 1; j < end; ++j)
+  {
+    value_type value = values[j];
+    carry            = binary_op(carry, value);
+  }
+
+  return carry;
+}
+
+// Finishes the segment which crosses into the tile starting at begin with
+// the carry of the tiles before it and writes it to the outputs. The segment
+// ends at or before segment_end. Returns the position one past its end.
+template <typename RandomIterator1,
+          typename RandomIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+Size finish_carry(
+  RandomIterator1 keys,
+  RandomIterator2 values,
+  Size begin,
+  Size segment_end,
+  Size carry_begin,
+  thrust::detail::it_value_t<RandomIterator2> carry,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using key_type   = thrust::detail::it_value_t<RandomIterator1>;
+  using value_type = thrust::detail::it_value_t<RandomIterator2>;
+
+  key_type key = keys[begin];
+  Size j       = begin;
+
+  for (;;)
+  {
+    value_type value = values[j];
+    carry            = binary_op(carry, value);
+
+    // the tile's last segment ends at segment_end
+    if (++j == segment_end)
+    {
+      break;
+    }
+
+    key_type next = keys[j];
+
+    if (!binary_pred(key, next))
+    {
+      break;
+    }
+
+    key = next;
+  }
+
+  *keys_output   = keys[carry_begin];
+  *values_output = carry;
+
+  return j;
+}
+
+} // end namespace reduce_by_key_detail
+
+// Each tile first counts the segments ending inside it and reduces the
+// trailing part of the segment which crosses its end into a carry. The carries
+// are accumulated in order to find the carry into each tile, after which the
+// tiles reduce their segments in parallel, finishing the one crossing into
+// them with their carry. binary_op need not be commutative, the outputs are
+// only ever written, and the key of each output is the first key of its
+// segment, as for the sequential algorithm.
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -54,9 +184,141 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  using traversal1 = typename iterator_traversal<InputIterator1>::type;
+  using traversal2 = typename iterator_traversal<InputIterator2>::type;
+  using traversal3 = typename iterator_traversal<OutputIterator1>::type;
+  using traversal4 = typename iterator_traversal<OutputIterator2>::type;
+  using traversal  = typename thrust::detail::minimum_type<traversal1, traversal2, traversal3, traversal4>::type;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    // we're attempting to launch an omp kernel, assert we're compiling with omp support
+    // ========================================================================
+    // X Note to the user: If you've found this line due to a compiler error, X
+    // X you need to enable OpenMP support in your compiler.                  X
+    // ========================================================================
+    static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                          (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                  "OpenMP compiler support is not enabled");
+
+    using index_type = std::intptr_t;
+
+    // Use the input iterator's value type per https://wg21.link/P0571
+    using value_type = thrust::detail::it_value_t<InputIterator2>;
+
+    const index_type n = static_cast<index_type>(keys_last - keys_first);
+
+    thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+      thrust::system::omp::detail::default_decomposition(n);
+
+    const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+    if (num_tiles < 2)
+    {
+      return thrust::reduce_by_key(
+        thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+    }
+
+    thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+    thrust::detail::temporary_array<index_type, DerivedPolicy> segment_ends(exec, num_tiles);
+    thrust::detail::temporary_array<index_type, DerivedPolicy> carry_begins(exec, num_tiles);
+    thrust::detail::temporary_array<value_type, DerivedPolicy> carries(exec, num_tiles);
+
+    // count the segments ending in each tile and reduce the carry past them
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type i = 0; i < num_tiles; ++i)
+    {
+      index_type segment_end = 0;
+
+      offsets[i + 1] = reduce_by_key_detail::count_tails(
+        keys_first, n, decomp[i].begin(), decomp[i].end(), binary_pred, segment_end);
+      segment_ends[i] = segment_end;
+
+      if (segment_end < decomp[i].end())
+      {
+        carries[i] = reduce_by_key_detail::reduce_carry(values_first, segment_end, decomp[i].end(), binary_op);
+      }
+    }
+
+    // scan the counts to get each tile's output offset
+    offsets[0] = 0;
+    thrust::inclusive_scan(thrust::seq, offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+
+    // accumulate the carries into the carry into each tile
+    // a carry begin of -1 marks a tile without a carry into it
+    {
+      index_type carry_begin = -1;
+      value_type carry{};
+
+      for (index_type i = 0; i < num_tiles; ++i)
+      {
+        const value_type tile_carry = carries[i];
+
+        carry_begins[i] = carry_begin;
+        carries[i]      = carry;
+
+        if (offsets[i + 1] == offsets[i] && carry_begin != -1)
+        {
+          carry = binary_op(carry, tile_carry);
+        }
+        else if (segment_ends[i] < decomp[i].end())
+        {
+          carry_begin = segment_ends[i];
+          carry       = tile_carry;
+        }
+        else
+        {
+          carry_begin = -1;
+        }
+      }
+    }
+
+    // reduce the segments ending in each tile
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type i = 0; i < num_tiles; ++i)
+    {
+      index_type begin = decomp[i].begin();
+      index_type out   = offsets[i];
+
+      if (out == offsets[i + 1])
+      {
+        continue;
+      }
+
+      if (carry_begins[i] != -1)
+      {
+        begin = reduce_by_key_detail::finish_carry(
+          keys_first,
+          values_first,
+          begin,
+          static_cast<index_type>(segment_ends[i]),
+          static_cast<index_type>(carry_begins[i]),
+          static_cast<value_type>(carries[i]),
+          keys_output + out,
+          values_output + out,
+          binary_pred,
+          binary_op);
+        ++out;
+      }
+
+      thrust::reduce_by_key(
+        thrust::seq,
+        keys_first + begin,
+        keys_first + segment_ends[i],
+        values_first + begin,
+        keys_output + out,
+        values_output + out,
+        binary_pred,
+        binary_op);
+    }
+
+    return thrust::make_pair(keys_output + offsets[num_tiles], values_output + offsets[num_tiles]);
+  }
+  else
+  {
+    return thrust::system::detail::generic::reduce_by_key(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
 } // end reduce_by_key()
 
 } // namespace detail
@@ -0,0 +1,243 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/scan.h>
+
+#include <cuda/std/__functional/invoke.h>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_detail
+{
+
+// scans the tile [first, last) into result, seeding the running sum with
+// carry when has_carry is set
+template <bool Inclusive, typename InputIterator, typename OutputIterator, typename ValueType, typename BinaryFunction>
+void scan_tile(InputIterator first,
+               InputIterator last,
+               OutputIterator result,
+               bool has_carry,
+               ValueType carry,
+               thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op)
+{
+  if (first == last)
+  {
+    return;
+  }
+
+  if constexpr (Inclusive)
+  {
+    ValueType sum = has_carry ? binary_op(carry, *first) : ValueType(*first);
+    *result       = sum;
+
+    for (++first, ++result; first != last; ++first, (void) ++result)
+    {
+      *result = sum = binary_op(sum, *first);
+    }
+  }
+  else
+  {
+    ValueType sum = carry;
+
+    for (; first != last; ++first, (void) ++result)
+    {
+      ValueType tmp = *first; // temporary value allows in-situ scan
+      *result       = sum;
+      sum           = binary_op(sum, tmp);
+    }
+  }
+}
+
+// reduce-then-scan over the default decomposition:
+//   1. every thread reduces its own tile (reduce_intervals)
+//   2. the tile sums are scanned sequentially into per-tile carries
+//   3. every thread scans its own tile seeded with its carry
+template <bool Inclusive,
+          bool HasInit,
+          typename ValueType,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryFunction>
+OutputIterator scan(execution_policy<DerivedPolicy>& exec,
+                    InputIterator first,
+                    InputIterator last,
+                    OutputIterator result,
+                    ValueType init,
+                    BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  using difference_type = thrust::detail::it_difference_t<InputIterator>;
+
+  const difference_type n = ::cuda::std::distance(first, last);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  // a single tile needs no carry propagation
+  if (decomp.size() == 1)
+  {
+    scan_tile<Inclusive>(first, last, result, HasInit, init, wrapped_binary_op);
+    return result + n;
+  }
+
+  // reduce each tile
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+  thrust::system::omp::detail::reduce_intervals(exec, first, carries.begin(), binary_op, decomp);
+
+  // turn the tile sums into the carry-in of each tile; when there is no
+  // initial value, the first tile has no carry-in and its sum seeds the rest
+  {
+    ValueType sum = HasInit ? init : ValueType(carries[0]);
+
+    for (difference_type i = HasInit ? 0 : 1; i < decomp.size(); ++i)
+    {
+      ValueType tmp = carries[i];
+      carries[i]    = sum;
+      sum           = wrapped_binary_op(sum, tmp);
+    }
+  }
+
+  using index_type = std::intptr_t;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  // scan each tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    const bool has_carry = HasInit || i > 0;
+
+    scan_tile<Inclusive>(
+      first + decomp[i].begin(),
+      first + decomp[i].end(),
+      result + decomp[i].begin(),
+      has_carry,
+      has_carry ? ValueType(carries[i]) : init,
+      wrapped_binary_op);
+  }
+
+  return result + n;
+}
+
+} // end namespace scan_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = thrust::detail::it_value_t<InputIterator>;
+
+  if (first == last)
+  {
+    return result;
+  }
+
+  // the initial value is never used, we just need something to pass around
+  const ValueType unused = *first;
+
+  return scan_detail::scan<true, false>(exec, first, last, result, unused, binary_op);
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // Use the input iterator's value type and the initial value type per wg21.link/p2322
+  using ValueType =
+    typename ::cuda::std::__accumulator_t<BinaryFunction, thrust::detail::it_value_t<InputIterator>, InitialValueType>;
+
+  return scan_detail::scan<true, true>(exec, first, last, result, ValueType(init), binary_op);
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator exclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
+{
+  // Use the initial value type per https://wg21.link/P0571
+  using ValueType = InitialValueType;
+
+  return scan_detail::scan<false, true>(exec, first, last, result, ValueType(init), binary_op);
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,353 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/scan_by_key.h>
+
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+namespace scan_by_key_detail
+{
+
+// reduces the tile [first, first + n) of a segmented scan: sum is the running
+// value at the end of the tile and the return value tells whether a segment
+// starts inside the tile, in which case sum does not depend on earlier tiles.
+// an exclusive scan restarts each segment from init.
+template <bool Inclusive,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename Size,
+          typename ValueType,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+bool reduce_tile(InputIterator1 first1,
+                 InputIterator2 first2,
+                 Size n,
+                 bool head,
+                 ValueType init,
+                 ValueType& sum,
+                 BinaryPredicate binary_pred,
+                 BinaryFunction binary_op)
+{
+  using KeyType = thrust::detail::it_value_t<InputIterator1>;
+
+  KeyType prev_key = *first1;
+
+  if (Inclusive || !head)
+  {
+    sum = *first2;
+  }
+  else
+  {
+    sum = binary_op(init, *first2);
+  }
+
+  bool segmented = head;
+
+  for (++first1, ++first2; --n > 0; ++first1, (void) ++first2)
+  {
+    KeyType key = *first1;
+
+    if (binary_pred(prev_key, key))
+    {
+      sum = binary_op(sum, *first2);
+    }
+    else
+    {
+      sum       = Inclusive ? ValueType(*first2) : binary_op(init, *first2);
+      segmented = true;
+    }
+
+    prev_key = key;
+  }
+
+  return segmented;
+}
+
+// scans the tile [first, first + n), continuing from carry unless the tile
+// begins a new segment
+template <bool Inclusive,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Size,
+          typename ValueType,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+void scan_tile(InputIterator1 first1,
+               InputIterator2 first2,
+               OutputIterator result,
+               Size n,
+               bool head,
+               ValueType init,
+               ValueType carry,
+               BinaryPredicate binary_pred,
+               BinaryFunction binary_op)
+{
+  using KeyType = thrust::detail::it_value_t<InputIterator1>;
+
+  // keys and values are read before result is written to permit in-place scans
+  KeyType prev_key = *first1;
+
+  if constexpr (Inclusive)
+  {
+    ValueType sum = head ? ValueType(*first2) : binary_op(carry, *first2);
+    *result       = sum;
+
+    for (++first1, ++first2, ++result; --n > 0; ++first1, (void) ++first2, (void) ++result)
+    {
+      KeyType key = *first1;
+
+      if (binary_pred(prev_key, key))
+      {
+        *result = sum = binary_op(sum, *first2);
+      }
+      else
+      {
+        *result = sum = *first2;
+      }
+
+      prev_key = key;
+    }
+  }
+  else
+  {
+    ValueType next = head ? init : carry;
+
+    for (;;)
+    {
+      ValueType temp_value = *first2;
+
+      *result = next;
+      next    = binary_op(next, temp_value);
+
+      if (--n == 0)
+      {
+        break;
+      }
+
+      ++first1;
+      ++first2;
+      ++result;
+
+      KeyType key = *first1;
+
+      if (!binary_pred(prev_key, key))
+      {
+        next = init; // reset sum
+      }
+
+      prev_key = key;
+    }
+  }
+}
+
+// segmented reduce-then-scan over the default decomposition:
+//   1. every thread reduces its own tile and records whether the tile starts
+//      or contains a segment head
+//   2. the tile sums are scanned sequentially into per-tile carries; a tile
+//      containing a head stops the carry from propagating past it
+//   3. every thread scans its own tile seeded with its carry
+template <bool Inclusive,
+          typename ValueType,
+          typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  ValueType init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using difference_type = thrust::detail::it_difference_t<InputIterator1>;
+  using HeadFlagType    = std::uint8_t;
+
+  const difference_type n = last1 - first1;
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred{binary_pred};
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  // a single tile needs no carry propagation
+  if (decomp.size() == 1)
+  {
+    scan_tile<Inclusive>(first1, first2, result, n, true, init, init, wrapped_binary_pred, wrapped_binary_op);
+    return result + n;
+  }
+
+  using index_type = std::intptr_t;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, decomp.size());
+  thrust::detail::temporary_array<HeadFlagType, DerivedPolicy> heads(exec, decomp.size());
+  thrust::detail::temporary_array<HeadFlagType, DerivedPolicy> segmented(exec, decomp.size());
+
+  // reduce each tile; the head flag at the start of each tile is computed
+  // here, before any output is written, since first1 may equal result
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    const difference_type begin = decomp[i].begin();
+
+    const bool head = begin == 0 || !wrapped_binary_pred(first1[begin - 1], first1[begin]);
+
+    ValueType sum = init;
+    const bool has_head = reduce_tile<Inclusive>(
+      first1 + begin, first2 + begin, decomp[i].size(), head, init, sum, wrapped_binary_pred, wrapped_binary_op);
+
+    carries[i]   = sum;
+    heads[i]     = head;
+    segmented[i] = has_head;
+  }
+
+  // turn the tile sums into the carry-in of each tile
+  {
+    ValueType sum = carries[0];
+
+    for (index_type i = 1; i < num_tiles; ++i)
+    {
+      ValueType tmp = carries[i];
+      carries[i]    = sum;
+      sum           = segmented[i] ? tmp : wrapped_binary_op(sum, tmp);
+    }
+  }
+
+  // scan each tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    const difference_type begin = decomp[i].begin();
+
+    scan_tile<Inclusive>(
+      first1 + begin,
+      first2 + begin,
+      result + begin,
+      decomp[i].size(),
+      i == 0 || heads[i],
+      init,
+      ValueType(carries[i]),
+      wrapped_binary_pred,
+      wrapped_binary_op);
+  }
+
+  return result + n;
+}
+
+} // end namespace scan_by_key_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+  if (first1 == last1)
+  {
+    return result;
+  }
+
+  // the initial value is never used, we just need something to pass around
+  const ValueType unused = *first2;
+
+  return scan_by_key_detail::scan_by_key<true>(exec, first1, last1, first2, result, unused, binary_pred, binary_op);
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using ValueType = T;
+
+  return scan_by_key_detail::scan_by_key<false>(
+    exec, first1, last1, first2, result, ValueType(init), binary_pred, binary_op);
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
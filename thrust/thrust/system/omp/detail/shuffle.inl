@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/random_bijection.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/scan.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/shuffle.h>
+
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+namespace shuffle_detail
+{
+
+// Returns the number of indices in [begin, end) which the bijection maps
+// below m.
+template <typename Size>
+Size count_kept(const thrust::detail::feistel_bijection& bijection, std::uint64_t m, Size begin, Size end)
+{
+  Size count = 0;
+
+  for (Size i = begin; i < end; ++i)
+  {
+    count += bijection(static_cast<std::uint64_t>(i)) < m ? 1 : 0;
+  }
+
+  return count;
+}
+
+// Gathers the elements of the indices in [begin, end) which the bijection
+// maps below m.
+template <typename RandomIterator, typename OutputIterator, typename Size>
+void gather_kept(const thrust::detail::feistel_bijection& bijection,
+                 std::uint64_t m,
+                 Size begin,
+                 Size end,
+                 RandomIterator first,
+                 OutputIterator result)
+{
+  for (Size i = begin; i < end; ++i)
+  {
+    const std::uint64_t key = bijection(static_cast<std::uint64_t>(i));
+
+    if (key < m)
+    {
+      *result = first[key];
+      ++result;
+    }
+  }
+}
+
+} // end namespace shuffle_detail
+
+// Like generic::shuffle_copy, this walks the bijection over [0, n), n being
+// the power of two it permutes, and keeps the keys below m in order. The
+// walk is split into tiles which first count their keys and then write them
+// at the offsets scanned from the counts, so the output is identical to the
+// sequential one for the same generator.
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using index_type = std::intptr_t;
+
+  const std::uint64_t m = last - first;
+  thrust::detail::feistel_bijection bijection(m, g);
+  const index_type n = static_cast<index_type>(bijection.nearest_power_of_two());
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+
+  // count the kept keys of each tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    offsets[i + 1] = shuffle_detail::count_kept(bijection, m, decomp[i].begin(), decomp[i].end());
+  }
+
+  // scan the counts to get each tile's output offset
+  offsets[0] = 0;
+  thrust::inclusive_scan(thrust::seq, offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+
+  // gather the elements of the kept keys of each tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    shuffle_detail::gather_kept(bijection, m, decomp[i].begin(), decomp[i].end(), first, result + offsets[i]);
+  }
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
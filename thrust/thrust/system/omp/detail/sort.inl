@@ -26,18 +26,22 @@
 #  pragma system_header
 #endif // no system header
 
-// don't attempt to #include this file without omp support
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-#  include <omp.h>
-#endif // omp support
-
+#include <thrust/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/radix_sort.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -49,126 +53,300 @@ namespace detail
 namespace sort_detail
 {
 
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+// Returns where the tile with the given index begins, or n past the last
+// tile.
+template <typename Size>
+Size pair_boundary(const thrust::system::detail::internal::uniform_decomposition<Size>& decomp, Size n, Size tile)
 {
-  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
-
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
-
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+  return tile < decomp.size() ? decomp[tile].begin() : n;
 }
 
-template <typename DerivedPolicy,
+// Merges the adjacent pairs of sorted runs of width tiles each of the keys
+// [keys1, keys1 + n), and their values if HasValues, into keys2 and vals2.
+// The output is split evenly across the tiles of decomp and every tile finds
+// its inputs by searching the merge paths of the pairs it overlaps, so every
+// thread merges an equal share of every level.
+template <bool HasValues,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
           typename StrictWeakOrdering>
-void inplace_merge_by_key(
-  execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
+void merge_sort_level(
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+  RandomAccessIterator1 keys1,
+  RandomAccessIterator2 vals1,
+  RandomAccessIterator3 keys2,
+  RandomAccessIterator4 vals2,
+  Size n,
+  Size width,
   StrictWeakOrdering comp)
 {
-  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
-  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
+  using index_type = std::intptr_t;
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    const Size end = decomp[i].end();
 
-  thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
-}
+    for (Size begin = decomp[i].begin(); begin < end;)
+    {
+      // find the pair of runs which begin belongs to
+      Size pair = 0;
 
-} // namespace sort_detail
+      while (pair_boundary(decomp, n, (pair + 1) * 2 * width) <= begin)
+      {
+        ++pair;
+      }
 
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
-  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+      const Size first  = pair_boundary(decomp, n, pair * 2 * width);
+      const Size middle = pair_boundary(decomp, n, pair * 2 * width + width);
+      const Size last   = pair_boundary(decomp, n, (pair + 1) * 2 * width);
+
+      const Size stop = ::cuda::std::min(end, last);
+
+      const Size begin1 = thrust::system::detail::internal::merge_path(
+        keys1 + first, middle - first, keys1 + middle, last - middle, begin - first, comp);
+      const Size end1 = thrust::system::detail::internal::merge_path(
+        keys1 + first, middle - first, keys1 + middle, last - middle, stop - first, comp);
+
+      const Size begin2 = begin - first - begin1;
+      const Size end2   = stop - first - end1;
+
+      if constexpr (HasValues)
+      {
+        thrust::merge_by_key(
+          thrust::seq,
+          keys1 + first + begin1,
+          keys1 + first + end1,
+          keys1 + middle + begin2,
+          keys1 + middle + end2,
+          vals1 + first + begin1,
+          vals1 + middle + begin2,
+          keys2 + begin,
+          vals2 + begin,
+          comp);
+      }
+      else
+      {
+        thrust::merge(thrust::seq,
+                      keys1 + first + begin1,
+                      keys1 + first + end1,
+                      keys1 + middle + begin2,
+                      keys1 + middle + end2,
+                      keys2 + begin,
+                      comp);
+      }
+
+      begin = stop;
+    }
+  }
+}
+
+// Sorts the keys [keys1, keys1 + n), and the values starting at vals1 if
+// HasValues, by sorting the tiles of the default decomposition and merging
+// them level by level, with keys2 and vals2 as scratch space.
+template <bool HasValues,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename StrictWeakOrdering>
+void merge_sort(execution_policy<DerivedPolicy>& exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                Size n,
+                StrictWeakOrdering comp)
 {
-  // we're attempting to launch an omp kernel, assert we're compiling with omp support
-  // ========================================================================
-  // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to enable OpenMP support in your compiler.                  X
-  // ========================================================================
-  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator,
-                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
-                "OpenMP compiler support is not enabled");
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using index_type = std::intptr_t;
 
-  if (first == last)
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  // every thread sorts its own tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
   {
-    return;
+    if constexpr (HasValues)
+    {
+      thrust::stable_sort_by_key(
+        thrust::seq, keys1 + decomp[i].begin(), keys1 + decomp[i].end(), vals1 + decomp[i].begin(), comp);
+    }
+    else
+    {
+      thrust::stable_sort(thrust::seq, keys1 + decomp[i].begin(), keys1 + decomp[i].end(), comp);
+    }
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  for (Size width = 1; width < decomp.size(); width *= 2)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+    if (flip)
+    {
+      merge_sort_level<HasValues>(decomp, keys2, vals2, keys1, vals1, n, width, comp);
+    }
+    else
+    {
+      merge_sort_level<HasValues>(decomp, keys1, vals1, keys2, vals2, n, width, comp);
+    }
+
+    flip = !flip;
+  }
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
 
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
+    if constexpr (HasValues)
     {
-      thrust::stable_sort(thrust::seq, first + decomp[p_i].begin(), first + decomp[p_i].end(), comp);
+      thrust::copy(exec, vals2, vals2 + n, vals1);
     }
+  }
+}
 
-    THRUST_PRAGMA_OMP(barrier)
+// Makes one pass of the radix sort over the keys [keys1, keys1 + n) split into
+// the tiles of decomp. Returns false when the pass was skipped because all
+// keys share the digit of this pass.
+template <bool HasValues,
+          bool Descending,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size>
+bool radix_sort_pass(
+  const thrust::system::detail::internal::uniform_decomposition<Size>& decomp,
+  RandomAccessIterator1 keys1,
+  RandomAccessIterator2 vals1,
+  RandomAccessIterator3 keys2,
+  RandomAccessIterator4 vals2,
+  Size n,
+  unsigned int pass,
+  ::cuda::std::size_t* histograms)
+{
+  using traits = thrust::system::detail::internal::radix_sort_traits<thrust::detail::it_value_t<RandomAccessIterator1>>;
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
+  using index_type = std::intptr_t;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::radix_histogram<Descending>(
+      keys1, decomp[i].begin(), decomp[i].end(), pass, histograms + i * traits::num_buckets);
+  }
 
-    while (nseg > 1)
-    {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
+  if (!thrust::system::detail::internal::radix_scan_histograms<traits::num_buckets>(histograms, num_tiles, n))
+  {
+    return false;
+  }
 
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
+  THRUST_PRAGMA_OMP(parallel for)
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::radix_scatter<HasValues, Descending>(
+      keys1, vals1, decomp[i].begin(), decomp[i].end(), keys2, vals2, pass, histograms + i * traits::num_buckets);
+  }
 
-        b = c;
-        c += h;
-      }
+  return true;
+}
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+// Sorts the keys [keys1, keys1 + n), and the values starting at vals1 if
+// HasValues, by a parallel LSD radix sort with keys2 and vals2 as scratch
+// space.
+template <bool HasValues,
+          bool Descending,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size>
+void radix_sort(execution_policy<DerivedPolicy>& exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                Size n)
+{
+  using traits = thrust::system::detail::internal::radix_sort_traits<thrust::detail::it_value_t<RandomAccessIterator1>>;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp =
+    thrust::system::omp::detail::default_decomposition(n);
+
+  thrust::detail::temporary_array<::cuda::std::size_t, DerivedPolicy> histograms(
+    exec, decomp.size() * traits::num_buckets);
+
+  ::cuda::std::size_t* histograms_ptr = thrust::raw_pointer_cast(histograms.data());
+
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  for (unsigned int pass = 0; pass < traits::num_passes; ++pass)
+  {
+    const bool shuffled =
+      flip
+        ? radix_sort_pass<HasValues, Descending>(decomp, keys2, vals2, keys1, vals1, n, pass, histograms_ptr)
+        : radix_sort_pass<HasValues, Descending>(decomp, keys1, vals1, keys2, vals2, n, pass, histograms_ptr);
+
+    flip = shuffled ? !flip : flip;
+  }
 
-      THRUST_PRAGMA_OMP(barrier)
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
+
+    if constexpr (HasValues)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
     }
   }
-#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_merge_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator>;
+  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  const IndexType n = last - first;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, n);
+
+  sort_detail::merge_sort<false>(exec, first, temp.begin(), static_cast<int*>(0), static_cast<int*>(0), n, comp);
 }
 
 template <typename DerivedPolicy,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
           typename StrictWeakOrdering>
-void stable_sort_by_key(
+void stable_merge_sort_by_key(
   execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator1 keys_first,
   RandomAccessIterator1 keys_last,
@@ -184,73 +362,78 @@ void stable_sort_by_key(
                                                         (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
                 "OpenMP compiler support is not enabled");
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
   using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
 
-  if (keys_first == keys_last)
-  {
-    return;
-  }
+  const IndexType n = keys_last - keys_first;
 
-  THRUST_PRAGMA_OMP(parallel)
-  {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
-      keys_last - keys_first, 1, omp_get_num_threads());
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp1(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> temp2(exec, n);
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+  sort_detail::merge_sort<true>(exec, keys_first, temp1.begin(), values_first, temp2.begin(), n, comp);
+}
 
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
-    {
-      thrust::stable_sort_by_key(
-        thrust::seq,
-        keys_first + decomp[p_i].begin(),
-        keys_first + decomp[p_i].end(),
-        values_first + decomp[p_i].begin(),
-        comp);
-    }
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator>;
 
-    THRUST_PRAGMA_OMP(barrier)
+  // primitive keys are radix sorted, which keeps all threads busy in every
+  // pass, unlike the merges of stable_merge_sort
+  if constexpr (thrust::system::detail::internal::use_radix_sort<KeyType, StrictWeakOrdering>::value)
+  {
+    using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
+    const difference_type n = last - first;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+    thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, n);
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    constexpr bool descending =
+      thrust::system::detail::internal::radix_sort_is_descending<KeyType, StrictWeakOrdering>::value;
 
-    while (nseg > 1)
-    {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
+    sort_detail::radix_sort<false, descending>(
+      exec, first, temp.begin(), static_cast<int*>(0), static_cast<int*>(0), n);
+  }
+  else
+  {
+    omp::detail::stable_merge_sort(exec, first, last, comp);
+  }
+}
 
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
 
-        b = c;
-        c += h;
-      }
+  if constexpr (thrust::system::detail::internal::use_radix_sort<KeyType, StrictWeakOrdering>::value)
+  {
+    using difference_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+    const difference_type n = keys_last - keys_first;
 
-      THRUST_PRAGMA_OMP(barrier)
-    }
+    thrust::detail::temporary_array<KeyType, DerivedPolicy> temp1(exec, n);
+    thrust::detail::temporary_array<ValueType, DerivedPolicy> temp2(exec, n);
+
+    constexpr bool descending =
+      thrust::system::detail::internal::radix_sort_is_descending<KeyType, StrictWeakOrdering>::value;
+
+    sort_detail::radix_sort<true, descending>(exec, keys_first, temp1.begin(), values_first, temp2.begin(), n);
+  }
+  else
+  {
+    omp::detail::stable_merge_sort_by_key(exec, keys_first, keys_last, values_first, comp);
   }
-#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
 } // end namespace detail
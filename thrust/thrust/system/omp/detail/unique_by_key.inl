@@ -25,10 +25,21 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/pair.h>
+#include <thrust/scan.h>
 #include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/unique_by_key.h>
 
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -37,6 +48,71 @@ namespace omp
 namespace detail
 {
 
+namespace unique_by_key_detail
+{
+
+// Returns the number of segment heads in [begin, end). The first key is a
+// head by definition.
+template <typename RandomIterator, typename Size, typename BinaryPredicate>
+Size count_heads(RandomIterator keys, Size begin, Size end, BinaryPredicate binary_pred)
+{
+  using key_type = thrust::detail::it_value_t<RandomIterator>;
+
+  key_type key = keys[begin];
+  Size count   = (begin == 0 || !binary_pred(key_type(keys[begin - 1]), key)) ? 1 : 0;
+
+  for (Size j = begin + 1; j < end; ++j)
+  {
+    key_type next = keys[j];
+    count += binary_pred(key, next) ? 0 : 1;
+    key = next;
+  }
+
+  return count;
+}
+
+// Copies the key and value of each segment head in [begin, end).
+template <typename RandomIterator1,
+          typename RandomIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename BinaryPredicate>
+void copy_heads(RandomIterator1 keys,
+                RandomIterator2 values,
+                Size begin,
+                Size end,
+                OutputIterator1 keys_output,
+                OutputIterator2 values_output,
+                BinaryPredicate binary_pred)
+{
+  using key_type = thrust::detail::it_value_t<RandomIterator1>;
+
+  key_type key = keys[begin];
+  bool is_head = begin == 0 || !binary_pred(key_type(keys[begin - 1]), key);
+
+  for (Size j = begin; j < end;)
+  {
+    if (is_head)
+    {
+      *keys_output   = key;
+      *values_output = values[j];
+
+      ++keys_output;
+      ++values_output;
+    }
+
+    if (++j < end)
+    {
+      key_type next = keys[j];
+      is_head       = !binary_pred(key, next);
+      key           = next;
+    }
+  }
+}
+
+} // end namespace unique_by_key_detail
+
 template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIterator2, typename BinaryPredicate>
 thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
   execution_policy<DerivedPolicy>& exec,
@@ -64,9 +140,67 @@ thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_copy(
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
-  return thrust::system::detail::generic::unique_by_key_copy(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
+  using traversal1 = typename iterator_traversal<InputIterator1>::type;
+  using traversal2 = typename iterator_traversal<InputIterator2>::type;
+  using traversal3 = typename iterator_traversal<OutputIterator1>::type;
+  using traversal4 = typename iterator_traversal<OutputIterator2>::type;
+  using traversal  = typename thrust::detail::minimum_type<traversal1, traversal2, traversal3, traversal4>::type;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    // we're attempting to launch an omp kernel, assert we're compiling with omp support
+    // ========================================================================
+    // X Note to the user: If you've found this line due to a compiler error, X
+    // X you need to enable OpenMP support in your compiler.                  X
+    // ========================================================================
+    static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                          (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                  "OpenMP compiler support is not enabled");
+
+    using index_type = std::intptr_t;
+
+    const index_type n = static_cast<index_type>(keys_last - keys_first);
+
+    thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+      thrust::system::omp::detail::default_decomposition(n);
+
+    const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+    thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+
+    // count the segment heads of each tile
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type i = 0; i < num_tiles; ++i)
+    {
+      offsets[i + 1] =
+        unique_by_key_detail::count_heads(keys_first, decomp[i].begin(), decomp[i].end(), binary_pred);
+    }
+
+    // scan the counts to get each tile's output offset
+    offsets[0] = 0;
+    thrust::inclusive_scan(thrust::seq, offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+
+    // copy the segment heads of each tile
+    THRUST_PRAGMA_OMP(parallel for)
+    for (index_type i = 0; i < num_tiles; ++i)
+    {
+      unique_by_key_detail::copy_heads(
+        keys_first,
+        values_first,
+        decomp[i].begin(),
+        decomp[i].end(),
+        keys_output + offsets[i],
+        values_output + offsets[i],
+        binary_pred);
+    }
+
+    return thrust::make_pair(keys_output + offsets[num_tiles], values_output + offsets[num_tiles]);
+  }
+  else
+  {
+    return thrust::system::detail::generic::unique_by_key_copy(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
+  }
 } // end unique_by_key_copy()
 
 } // end namespace detail
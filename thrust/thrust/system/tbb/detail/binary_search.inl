@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/detail/internal/batched_search.h>
+#include <thrust/system/tbb/detail/binary_search.h>
+
+#include <cuda/std/type_traits>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace binary_search_detail
+{
+
+template <typename SearchKind,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Size,
+          typename StrictWeakOrdering>
+struct body
+{
+  RandomAccessIterator1 first;
+  Size n;
+  RandomAccessIterator2 values;
+  RandomAccessIterator3 output;
+  StrictWeakOrdering comp;
+
+  body(RandomAccessIterator1 first,
+       Size n,
+       RandomAccessIterator2 values,
+       RandomAccessIterator3 output,
+       StrictWeakOrdering comp)
+      : first(first)
+      , n(n)
+      , values(values)
+      , output(output)
+      , comp(comp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    thrust::system::detail::internal::batched_search<SearchKind>(
+      first, n, values + r.begin(), static_cast<Size>(r.size()), output + r.begin(), comp);
+  }
+}; // end body
+
+// Searches chunks of the values in parallel with the lock-step searches of
+// batched_search.
+template <typename SearchKind,
+          typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  using traversal1 = typename iterator_traversal<ForwardIterator>::type;
+  using traversal2 = typename iterator_traversal<InputIterator>::type;
+  using traversal3 = typename iterator_traversal<OutputIterator>::type;
+  using traversal  = typename thrust::detail::minimum_type<traversal1, traversal2, traversal3>::type;
+
+  // other iterators fall back to the generic searches, which are named by
+  // their declarations: the helpers of generic/binary_search.inl may not be
+  // declared yet when the #include cycle through thrust/binary_search.h
+  // reaches this header
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    using Size = thrust::detail::it_difference_t<ForwardIterator>;
+
+    const Size n          = end - begin;
+    const Size num_values = values_end - values_begin;
+
+    // chunks should hold several groups of lock-step searches
+    const Size grain_size = 1024;
+
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<Size>(0, num_values, grain_size),
+      body<SearchKind, ForwardIterator, InputIterator, OutputIterator, Size, StrictWeakOrdering>(
+        begin, n, values_begin, output, comp));
+
+    return output + num_values;
+  }
+  else if constexpr (::cuda::std::is_same_v<SearchKind, thrust::system::detail::internal::lower_bound_search>)
+  {
+    return thrust::system::detail::generic::lower_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+  else if constexpr (::cuda::std::is_same_v<SearchKind, thrust::system::detail::internal::upper_bound_search>)
+  {
+    return thrust::system::detail::generic::upper_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+  else
+  {
+    return thrust::system::detail::generic::binary_search(exec, begin, end, values_begin, values_end, output, comp);
+  }
+} // end binary_search()
+
+} // end namespace binary_search_detail
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::binary_search<thrust::system::detail::internal::lower_bound_search>(
+    exec, begin, end, values_begin, values_end, output, comp);
+} // end lower_bound()
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::binary_search<thrust::system::detail::internal::upper_bound_search>(
+    exec, begin, end, values_begin, values_end, output, comp);
+} // end upper_bound()
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::binary_search<thrust::system::detail::internal::binary_search_search>(
+    exec, begin, end, values_begin, values_end, output, comp);
+} // end binary_search()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -25,8 +25,24 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
 #include <thrust/system/detail/generic/extrema.h>
+#include <thrust/system/detail/internal/extrema.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/type_traits/unwrap_contiguous_iterator.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,28 +52,185 @@ namespace tbb
 namespace detail
 {
 
+namespace extrema_detail
+{
+
+template <typename ForwardIterator>
+struct is_random_access
+    : ::cuda::std::is_convertible<typename iterator_traversal<ForwardIterator>::type, random_access_traversal_tag>
+{};
+
+// finds the first extremum of each interval
+template <typename Extremum, typename RandomAccessIterator, typename Iterator, typename Size, typename BinaryPredicate>
+struct extremum_body
+{
+  RandomAccessIterator first;
+  Iterator indices;
+  Size n, interval_size;
+  BinaryPredicate comp;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size i = r.begin(); i < r.end(); ++i)
+    {
+      const Size begin = i * interval_size;
+      const Size end   = ::cuda::std::min(n, begin + interval_size);
+
+      indices[i] = thrust::system::detail::internal::tile_extremum<Extremum>(first, begin, end, comp);
+    }
+  }
+};
+
+// finds the first minimum and the first maximum of each interval
+template <typename RandomAccessIterator, typename Iterator, typename Size, typename BinaryPredicate>
+struct minmax_body
+{
+  RandomAccessIterator first;
+  Iterator min_indices, max_indices;
+  Size n, interval_size;
+  BinaryPredicate comp;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size i = r.begin(); i < r.end(); ++i)
+    {
+      const Size begin = i * interval_size;
+      const Size end   = ::cuda::std::min(n, begin + interval_size);
+
+      const thrust::pair<Size, Size> minmax =
+        thrust::system::detail::internal::tile_minmax(first, begin, end, comp);
+
+      min_indices[i] = minmax.first;
+      max_indices[i] = minmax.second;
+    }
+  }
+};
+
+constexpr std::int64_t parallelism_threshold = 10000;
+
+// generate O(P) intervals of sequential work
+inline std::int64_t interval_size(std::int64_t n)
+{
+  // count the number of processors
+  const unsigned int p = ::cuda::std::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  return ::cuda::std::max<std::int64_t>(parallelism_threshold, thrust::detail::divide_ri(n, std::int64_t(p)));
+}
+
+// Finds the first extremum of each interval and then the first among those.
+template <typename Extremum, typename DerivedPolicy, typename RandomAccessIterator, typename BinaryPredicate>
+RandomAccessIterator extremum(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, BinaryPredicate comp)
+{
+  using Size = std::int64_t;
+
+  const Size n = static_cast<Size>(last - first);
+
+  if (n == 0)
+  {
+    return last;
+  }
+
+  const Size interval_size = extrema_detail::interval_size(n);
+  const Size num_intervals = thrust::detail::divide_ri(n, interval_size);
+
+  auto raw_first = thrust::try_unwrap_contiguous_iterator(first);
+
+  using temporary_array = thrust::detail::temporary_array<Size, DerivedPolicy>;
+  using Iterator        = typename temporary_array::iterator;
+
+  temporary_array indices(exec, num_intervals);
+
+  using Body = extremum_body<Extremum, decltype(raw_first), Iterator, Size, BinaryPredicate>;
+
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
+                      Body{raw_first, indices.begin(), n, interval_size, comp},
+                      ::tbb::simple_partitioner());
+
+  return first
+       + thrust::system::detail::internal::combine_extrema<Extremum>(raw_first, indices.begin(), num_intervals, comp);
+}
+
+} // end namespace extrema_detail
+
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator
 max_element(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
 {
-  // tbb prefers generic::max_element to cpp::max_element
-  return thrust::system::detail::generic::max_element(exec, first, last, comp);
+  if constexpr (extrema_detail::is_random_access<ForwardIterator>::value)
+  {
+    return extrema_detail::extremum<thrust::system::detail::internal::max_extremum>(exec, first, last, comp);
+  }
+  else
+  {
+    // tbb prefers generic::max_element to cpp::max_element
+    return thrust::system::detail::generic::max_element(exec, first, last, comp);
+  }
 } // end max_element()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator
 min_element(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
 {
-  // tbb prefers generic::min_element to cpp::min_element
-  return thrust::system::detail::generic::min_element(exec, first, last, comp);
+  if constexpr (extrema_detail::is_random_access<ForwardIterator>::value)
+  {
+    return extrema_detail::extremum<thrust::system::detail::internal::min_extremum>(exec, first, last, comp);
+  }
+  else
+  {
+    // tbb prefers generic::min_element to cpp::min_element
+    return thrust::system::detail::generic::min_element(exec, first, last, comp);
+  }
 } // end min_element()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 thrust::pair<ForwardIterator, ForwardIterator>
 minmax_element(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate comp)
 {
-  // tbb prefers generic::minmax_element to cpp::minmax_element
-  return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
+  if constexpr (extrema_detail::is_random_access<ForwardIterator>::value)
+  {
+    using Size = std::int64_t;
+
+    const Size n = static_cast<Size>(last - first);
+
+    if (n == 0)
+    {
+      return thrust::make_pair(last, last);
+    }
+
+    const Size interval_size = extrema_detail::interval_size(n);
+    const Size num_intervals = thrust::detail::divide_ri(n, interval_size);
+
+    auto raw_first = thrust::try_unwrap_contiguous_iterator(first);
+
+    using temporary_array = thrust::detail::temporary_array<Size, DerivedPolicy>;
+    using Iterator        = typename temporary_array::iterator;
+
+    // the indices of the minima of the intervals followed by those of the maxima
+    temporary_array indices(exec, 2 * num_intervals);
+
+    using Body = extrema_detail::minmax_body<decltype(raw_first), Iterator, Size, BinaryPredicate>;
+
+    // force grainsize == 1 with simple_partioner()
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<Size>(0, num_intervals, 1),
+      Body{raw_first, indices.begin(), indices.begin() + num_intervals, n, interval_size, comp},
+      ::tbb::simple_partitioner());
+
+    return thrust::make_pair(
+      first
+        + thrust::system::detail::internal::combine_extrema<thrust::system::detail::internal::min_extremum>(
+          raw_first, indices.begin(), num_intervals, comp),
+      first
+        + thrust::system::detail::internal::combine_extrema<thrust::system::detail::internal::max_extremum>(
+          raw_first, indices.begin() + num_intervals, num_intervals, comp));
+  }
+  else
+  {
+    // tbb prefers generic::minmax_element to cpp::minmax_element
+    return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
+  }
 } // end minmax_element()
 
 } // namespace detail
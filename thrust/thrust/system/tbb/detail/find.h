@@ -25,9 +25,21 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/seq.h>
+#include <thrust/find.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/find.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -36,11 +48,84 @@ namespace tbb
 namespace detail
 {
 
+namespace find_detail
+{
+
+// Lowers best to index unless it already holds a lower one.
+inline void fetch_min(::cuda::std::atomic<std::int64_t>& best, std::int64_t index)
+{
+  std::int64_t current = best.load(::cuda::std::memory_order_relaxed);
+
+  while (index < current && !best.compare_exchange_weak(current, index, ::cuda::std::memory_order_relaxed))
+  {
+  }
+}
+
+// searches each block front to back until a block past the first hit
+template <typename RandomAccessIterator, typename Size, typename Predicate>
+struct block_body
+{
+  RandomAccessIterator first;
+  Size n, block_size;
+  Predicate pred;
+  ::cuda::std::atomic<Size>* best;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size i = r.begin(); i < r.end(); ++i)
+    {
+      const Size begin = i * block_size;
+
+      if (best->load(::cuda::std::memory_order_relaxed) < begin)
+      {
+        return;
+      }
+
+      const Size end = ::cuda::std::min(n, begin + block_size);
+      const Size hit = thrust::find_if(thrust::seq, first + begin, first + end, pred) - first;
+
+      if (hit < end)
+      {
+        fetch_min(*best, hit);
+        return;
+      }
+    }
+  }
+};
+
+} // end namespace find_detail
+
+// The blocks are searched front to back within each range TBB hands out. A
+// hit lowers the shared index of the first hit, and the blocks past it are
+// skipped, so that the search gives up early once a hit near the front is
+// found.
 template <typename DerivedPolicy, typename InputIterator, typename Predicate>
 InputIterator find_if(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, Predicate pred)
 {
-  // tbb prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  using traversal = typename iterator_traversal<InputIterator>::type;
+
+  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    using Size = std::int64_t;
+
+    const Size n = static_cast<Size>(last - first);
+
+    const Size block_size = 1 << 12;
+
+    const Size num_blocks = thrust::detail::divide_ri(n, block_size);
+
+    ::cuda::std::atomic<Size> best(n);
+
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_blocks),
+                        find_detail::block_body<InputIterator, Size, Predicate>{first, n, block_size, pred, &best});
+
+    return first + best.load();
+  }
+  else
+  {
+    // tbb prefers generic::find_if to cpp::find_if
+    return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  }
 }
 
 } // end namespace detail
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/integer_math.h>
 #include <thrust/detail/range/tail_flags.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
@@ -54,12 +55,6 @@ namespace detail
 namespace reduce_by_key_detail
 {
 
-template <typename L, typename R>
-inline L divide_ri(const L x, const R y)
-{
-  return (x + (y - 1)) / y;
-}
-
 template <typename InputIterator, typename BinaryFunction, typename SFINAE = void>
 struct partial_sum_type
 {
@@ -91,7 +86,8 @@ reduce_last_segment_backward(
   for (++keys_first_r, ++values_first_r; (keys_first_r != keys_last_r) && binary_pred(*keys_first_r, result_key);
        ++keys_first_r, ++values_first_r)
   {
-    result_value = binary_op(result_value, *values_first_r);
+    // the values are consumed backward, so they go on the left
+    result_value = binary_op(*values_first_r, result_value);
   }
 
   return thrust::make_pair(keys_first_r.base(), thrust::make_pair(result_key, result_value));
@@ -327,7 +323,7 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
   const unsigned int subscription_rate = 1;
   difference_type interval_size        = ::cuda::std::min<difference_type>(
     parallelism_threshold, ::cuda::std::max<difference_type>(n, n / (subscription_rate * p)));
-  difference_type num_intervals = reduce_by_key_detail::divide_ri(n, interval_size);
+  difference_type num_intervals = thrust::detail::divide_ri(n, interval_size);
 
   // decompose the input into intervals of size N / num_intervals
   // add one extra element to this vector to store the size of the entire result
@@ -378,8 +374,10 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
 
   // sequentially accumulate the carries
   // note that the last interval does not have a carry
+  // the carries precede the output they are summed to, and consecutive intervals without a tail sum their carries to
+  // the same output, so walk them backward to keep binary_op's operands in order
   // XXX find a way to express this loop via a sequential algorithm, perhaps reduce_by_key
-  for (typename thrust::detail::temporary_array<carry_type, DerivedPolicy>::size_type i = 0; i < carries.size(); ++i)
+  for (typename thrust::detail::temporary_array<carry_type, DerivedPolicy>::size_type i = carries.size(); i-- > 0;)
   {
     // if our interval has a carry, then we need to sum the carry to the next interval's output offset
     // if it does not have a carry, then we need to ignore carry_value[i]
@@ -387,7 +385,7 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
     {
       difference_type output_idx = interval_output_offsets[i + 1];
 
-      values_result[output_idx] = binary_op(values_result[output_idx], carries[i]);
+      values_result[output_idx] = binary_op(carries[i], values_result[output_idx]);
     }
   }
 
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/integer_math.h>
 #include <thrust/detail/seq.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
@@ -47,12 +48,6 @@ namespace detail
 namespace reduce_intervals_detail
 {
 
-template <typename L, typename R>
-inline L divide_ri(const L x, const R y)
-{
-  return (x + (y - 1)) / y;
-}
-
 template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename BinaryFunction>
 struct body
 {
@@ -113,7 +108,7 @@ void reduce_intervals(
 {
   thrust::detail::it_difference_t<RandomAccessIterator1> n = last - first;
 
-  Size num_intervals = reduce_intervals_detail::divide_ri(n, interval_size);
+  Size num_intervals = thrust::detail::divide_ri(n, interval_size);
 
   ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
                       reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op),
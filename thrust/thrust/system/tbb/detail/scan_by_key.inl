@@ -0,0 +1,284 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/scan_by_key.h>
+
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_scan.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+namespace scan_by_key_detail
+{
+
+// computes the flag telling whether a segment starts at each position
+template <typename InputIterator, typename HeadFlagIterator, typename BinaryPredicate>
+struct head_flags_body
+{
+  InputIterator first;
+  HeadFlagIterator heads;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+
+  head_flags_body(InputIterator first, HeadFlagIterator heads, BinaryPredicate binary_pred)
+      : first(first)
+      , heads(heads)
+      , binary_pred{binary_pred}
+  {}
+
+  template <typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      heads[i] = i == 0 || !binary_pred(first[i - 1], first[i]);
+    }
+  }
+};
+
+// the summary of a range of a segmented scan is the running value at its end
+// together with whether a segment starts inside the range; a range without a
+// segment head continues the running value of the range to its left.
+// an exclusive scan restarts each segment from init.
+template <bool Inclusive,
+          typename HeadFlagIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename ValueType,
+          typename BinaryFunction>
+struct body
+{
+  HeadFlagIterator heads;
+  InputIterator first;
+  OutputIterator result;
+  ValueType init;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+  ValueType sum;
+  bool has_sum;
+  bool segmented;
+
+  body(HeadFlagIterator heads, InputIterator first, OutputIterator result, ValueType init, BinaryFunction binary_op)
+      : heads(heads)
+      , first(first)
+      , result(result)
+      , init(init)
+      , binary_op{binary_op}
+      , sum(init)
+      , has_sum(false)
+      , segmented(false)
+  {}
+
+  body(body& b, ::tbb::split)
+      : heads(b.heads)
+      , first(b.first)
+      , result(b.result)
+      , init(b.init)
+      , binary_op{b.binary_op}
+      , sum(b.init)
+      , has_sum(false)
+      , segmented(false)
+  {}
+
+  template <typename Size, typename Tag>
+  void operator()(const ::tbb::blocked_range<Size>& r, Tag)
+  {
+    constexpr bool is_final = ::cuda::std::is_same_v<Tag, ::tbb::final_scan_tag>;
+
+    InputIterator iter1  = first + r.begin();
+    OutputIterator iter2 = result + r.begin();
+
+    for (Size i = r.begin(); i != r.end(); ++i, ++iter1, (void) ++iter2)
+    {
+      const bool head = heads[i];
+
+      // use temp to permit in-place scans
+      ValueType temp_value = *iter1;
+
+      if constexpr (is_final && !Inclusive)
+      {
+        *iter2 = head ? init : sum;
+      }
+
+      if (head)
+      {
+        sum       = Inclusive ? temp_value : binary_op(init, temp_value);
+        segmented = true;
+      }
+      else
+      {
+        sum = has_sum ? binary_op(sum, temp_value) : temp_value;
+      }
+
+      has_sum = true;
+
+      if constexpr (is_final && Inclusive)
+      {
+        *iter2 = sum;
+      }
+    }
+  }
+
+  void reverse_join(body& b)
+  {
+    if (!b.has_sum)
+    {
+      return;
+    }
+
+    if (!has_sum)
+    {
+      sum       = b.sum;
+      segmented = b.segmented;
+    }
+    else if (!segmented)
+    {
+      sum       = binary_op(b.sum, sum);
+      segmented = b.segmented;
+    }
+
+    has_sum = true;
+  }
+
+  void assign(body& b)
+  {
+    sum       = b.sum;
+    has_sum   = b.has_sum;
+    segmented = b.segmented;
+  }
+};
+
+// the head flags are computed before the scan writes any output, since the
+// keys may share storage with the result through any iterator type
+template <bool Inclusive,
+          typename ValueType,
+          typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  ValueType init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using Size         = thrust::detail::it_difference_t<InputIterator1>;
+  using HeadFlagType = std::uint8_t;
+  using HeadFlags    = thrust::detail::temporary_array<HeadFlagType, DerivedPolicy>;
+  using Body = body<Inclusive, typename HeadFlags::iterator, InputIterator2, OutputIterator, ValueType, BinaryFunction>;
+
+  Size n = last1 - first1;
+
+  if (n != 0)
+  {
+    HeadFlags heads(exec, n);
+
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n),
+                        head_flags_body<InputIterator1, typename HeadFlags::iterator, BinaryPredicate>(
+                          first1, heads.begin(), binary_pred));
+
+    Body scan_body(heads.begin(), first2, result, init, binary_op);
+    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+  }
+
+  return result + n;
+}
+
+} // end namespace scan_by_key_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+  if (first1 == last1)
+  {
+    return result;
+  }
+
+  // the initial value is never used, we just need something to pass around
+  const ValueType unused = *first2;
+
+  return scan_by_key_detail::scan_by_key<true>(exec, first1, last1, first2, result, unused, binary_pred, binary_op);
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using ValueType = T;
+
+  return scan_by_key_detail::scan_by_key<false>(
+    exec, first1, last1, first2, result, ValueType(init), binary_pred, binary_op);
+}
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,316 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/system/tbb/detail/set_operations.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+namespace set_operations_detail
+{
+
+// finds the boundaries of the intervals
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename Iterator,
+          typename Size,
+          typename StrictWeakOrdering>
+struct split_body
+{
+  InputIterator1 first1;
+  InputIterator2 first2;
+  Iterator splits1, splits2;
+  Size n1, n2, interval_size;
+  StrictWeakOrdering comp;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      const Size diag = ::cuda::std::min<Size>(n1 + n2, i * interval_size);
+
+      thrust::pair<Size, Size> split =
+        thrust::system::detail::internal::equivalence_preserving_merge_path(first1, n1, first2, n2, diag, comp);
+
+      splits1[i] = split.first;
+      splits2[i] = split.second;
+    }
+  }
+};
+
+// applies the set operation to each interval, writing its output to
+// result + offsets[i], or only counting it into offsets[i + 1] when counting
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Iterator,
+          typename Size,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+struct interval_body
+{
+  InputIterator1 first1;
+  InputIterator2 first2;
+  OutputIterator result;
+  Iterator splits1, splits2, offsets;
+  StrictWeakOrdering comp;
+  SetOperation set_op;
+  bool counting;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      InputIterator1 my_first1 = first1 + splits1[i];
+      InputIterator1 my_last1  = first1 + splits1[i + 1];
+      InputIterator2 my_first2 = first2 + splits2[i];
+      InputIterator2 my_last2  = first2 + splits2[i + 1];
+
+      if (counting)
+      {
+        thrust::discard_iterator<> discard = thrust::make_discard_iterator();
+
+        offsets[i + 1] = set_op(my_first1, my_last1, my_first2, my_last2, discard, comp) - discard;
+      }
+      else
+      {
+        set_op(my_first1, my_last1, my_first2, my_last2, result + offsets[i], comp);
+      }
+    }
+  }
+};
+
+// The inputs are split into O(P) intervals along the merge path, with each
+// split moved back to the start of a run of equivalent elements so that the
+// intervals are independent. Each interval first counts its output; the
+// counts are scanned into output offsets and each interval then writes its
+// output at its offset.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  using difference_type = thrust::detail::it_difference_t<InputIterator1>;
+
+  const difference_type n1 = last1 - first1;
+  const difference_type n2 = last2 - first2;
+  const difference_type n  = n1 + n2;
+
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < 2 * parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  // count the number of processors
+  const unsigned int p = ::cuda::std::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate O(P) intervals of sequential work
+  const difference_type interval_size =
+    ::cuda::std::max<difference_type>(parallelism_threshold, thrust::detail::divide_ri(n, difference_type(p)));
+  const difference_type num_intervals = thrust::detail::divide_ri(n, interval_size);
+
+  using temporary_array = thrust::detail::temporary_array<difference_type, DerivedPolicy>;
+  using Iterator        = typename temporary_array::iterator;
+
+  temporary_array splits1(exec, num_intervals + 1);
+  temporary_array splits2(exec, num_intervals + 1);
+  temporary_array offsets(exec, num_intervals + 1);
+
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals + 1),
+    split_body<InputIterator1, InputIterator2, Iterator, difference_type, StrictWeakOrdering>{
+      first1, first2, splits1.begin(), splits2.begin(), n1, n2, interval_size, comp});
+
+  using Body = interval_body<InputIterator1,
+                             InputIterator2,
+                             OutputIterator,
+                             Iterator,
+                             difference_type,
+                             StrictWeakOrdering,
+                             SetOperation>;
+
+  // count the output of each interval
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    Body{first1, first2, result, splits1.begin(), splits2.begin(), offsets.begin(), comp, set_op, true},
+    ::tbb::simple_partitioner());
+
+  // scan the counts to get each interval's output offset
+  offsets[0] = 0;
+  thrust::inclusive_scan(thrust::seq, offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+
+  // write the output of each interval
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    Body{first1, first2, result, splits1.begin(), splits2.begin(), offsets.begin(), comp, set_op, false},
+    ::tbb::simple_partitioner());
+
+  return result + offsets[num_intervals];
+}
+
+} // end namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::set_difference_fn{});
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::set_intersection_fn{});
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::set_symmetric_difference_fn{});
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec,
+    first1,
+    last1,
+    first2,
+    last2,
+    result,
+    comp,
+    thrust::system::detail::internal::set_union_fn{});
+} // end set_union()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
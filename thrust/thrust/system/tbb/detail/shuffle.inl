@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/random_bijection.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/scan.h>
+#include <thrust/system/tbb/detail/shuffle.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstdint>
+
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+namespace shuffle_detail
+{
+
+// counts the kept keys of each interval, or gathers their elements
+template <typename RandomIterator, typename OutputIterator, typename Iterator, typename Size>
+struct interval_body
+{
+  thrust::detail::feistel_bijection bijection;
+  std::uint64_t m;
+  RandomIterator first;
+  OutputIterator result;
+  Iterator offsets;
+  Size n, interval_size;
+  bool count;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size i = r.begin(); i < r.end(); ++i)
+    {
+      const Size begin = i * interval_size;
+      const Size end   = ::cuda::std::min(n, begin + interval_size);
+
+      if (count)
+      {
+        Size num_kept = 0;
+
+        for (Size j = begin; j < end; ++j)
+        {
+          num_kept += bijection(static_cast<std::uint64_t>(j)) < m ? 1 : 0;
+        }
+
+        offsets[i + 1] = num_kept;
+      }
+      else
+      {
+        OutputIterator out = result + offsets[i];
+
+        for (Size j = begin; j < end; ++j)
+        {
+          const std::uint64_t key = bijection(static_cast<std::uint64_t>(j));
+
+          if (key < m)
+          {
+            *out = first[key];
+            ++out;
+          }
+        }
+      }
+    }
+  }
+};
+
+} // end namespace shuffle_detail
+
+// Like generic::shuffle_copy, this walks the bijection over [0, n), n being
+// the power of two it permutes, and keeps the keys below m in order. The
+// walk is split into intervals which first count their keys and then write
+// them at the offsets scanned from the counts, so the output is identical to
+// the sequential one for the same generator.
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  using Size = std::int64_t;
+
+  const std::uint64_t m = last - first;
+  thrust::detail::feistel_bijection bijection(m, g);
+  const Size n = static_cast<Size>(bijection.nearest_power_of_two());
+
+  const Size parallelism_threshold = 10000;
+
+  // count the number of processors
+  const unsigned int p = ::cuda::std::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate O(P) intervals of sequential work
+  const Size interval_size = ::cuda::std::max<Size>(parallelism_threshold, thrust::detail::divide_ri(n, Size(p)));
+  const Size num_intervals = thrust::detail::divide_ri(n, interval_size);
+
+  using temporary_array = thrust::detail::temporary_array<Size, DerivedPolicy>;
+  using Iterator        = typename temporary_array::iterator;
+
+  temporary_array offsets(exec, num_intervals + 1);
+
+  using Body = shuffle_detail::interval_body<RandomIterator, OutputIterator, Iterator, Size>;
+
+  // count the kept keys of each interval
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
+                      Body{bijection, m, first, result, offsets.begin(), n, interval_size, true},
+                      ::tbb::simple_partitioner());
+
+  // scan the counts to get each interval's output offset
+  offsets[0] = 0;
+  thrust::inclusive_scan(thrust::seq, offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+
+  // gather the elements of the kept keys of each interval
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
+                      Body{bijection, m, first, result, offsets.begin(), n, interval_size, false},
+                      ::tbb::simple_partitioner());
+}
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
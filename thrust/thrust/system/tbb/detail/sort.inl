@@ -26,13 +26,24 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy.h>
+#include <thrust/detail/integer_math.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/radix_sort.h>
 
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -256,15 +267,187 @@ void merge_sort_by_key(
 
 } // namespace sort_by_key_detail
 
+namespace radix_sort_detail
+{
+
+// counts the digits of each interval, or scatters the keys of each interval
+template <bool HasValues,
+          bool Descending,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size>
+struct pass_body
+{
+  static constexpr unsigned int num_buckets =
+    thrust::system::detail::internal::radix_sort_traits<thrust::detail::it_value_t<RandomAccessIterator1>>::num_buckets;
+
+  RandomAccessIterator1 keys1;
+  RandomAccessIterator2 vals1;
+  RandomAccessIterator3 keys2;
+  RandomAccessIterator4 vals2;
+  Size n, interval_size;
+  unsigned int pass;
+  ::cuda::std::size_t* histograms;
+  bool scatter;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size i = r.begin(); i < r.end(); ++i)
+    {
+      const Size begin = i * interval_size;
+      const Size end   = ::cuda::std::min(n, begin + interval_size);
+
+      if (scatter)
+      {
+        thrust::system::detail::internal::radix_scatter<HasValues, Descending>(
+          keys1, vals1, begin, end, keys2, vals2, pass, histograms + i * num_buckets);
+      }
+      else
+      {
+        thrust::system::detail::internal::radix_histogram<Descending>(
+          keys1, begin, end, pass, histograms + i * num_buckets);
+      }
+    }
+  }
+};
+
+// Makes one pass of the radix sort over the keys [keys1, keys1 + n). Returns
+// false when the pass was skipped because all keys share the digit of this
+// pass.
+template <bool HasValues,
+          bool Descending,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size>
+bool radix_sort_pass(
+  RandomAccessIterator1 keys1,
+  RandomAccessIterator2 vals1,
+  RandomAccessIterator3 keys2,
+  RandomAccessIterator4 vals2,
+  Size n,
+  Size interval_size,
+  unsigned int pass,
+  ::cuda::std::size_t* histograms)
+{
+  using Body = pass_body<HasValues,
+                         Descending,
+                         RandomAccessIterator1,
+                         RandomAccessIterator2,
+                         RandomAccessIterator3,
+                         RandomAccessIterator4,
+                         Size>;
+
+  const Size num_intervals = thrust::detail::divide_ri(n, interval_size);
+
+  // count the digits of each interval
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
+                      Body{keys1, vals1, keys2, vals2, n, interval_size, pass, histograms, false},
+                      ::tbb::simple_partitioner());
+
+  if (!thrust::system::detail::internal::radix_scan_histograms<Body::num_buckets>(histograms, num_intervals, n))
+  {
+    return false;
+  }
+
+  // scatter the keys of each interval
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
+                      Body{keys1, vals1, keys2, vals2, n, interval_size, pass, histograms, true},
+                      ::tbb::simple_partitioner());
+
+  return true;
+}
+
+// Sorts the keys [keys1, keys1 + n), and the values starting at vals1 if
+// HasValues, by a parallel LSD radix sort with keys2 and vals2 as scratch
+// space.
+template <bool HasValues,
+          bool Descending,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size>
+void radix_sort(execution_policy<DerivedPolicy>& exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                Size n)
+{
+  using traits = thrust::system::detail::internal::radix_sort_traits<thrust::detail::it_value_t<RandomAccessIterator1>>;
+
+  const Size parallelism_threshold = 10000;
+
+  // count the number of processors
+  const unsigned int p = ::cuda::std::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate O(P) intervals of sequential work
+  const Size interval_size = ::cuda::std::max<Size>(parallelism_threshold, thrust::detail::divide_ri(n, Size(p)));
+  const Size num_intervals = thrust::detail::divide_ri(n, interval_size);
+
+  thrust::detail::temporary_array<::cuda::std::size_t, DerivedPolicy> histograms(
+    exec, num_intervals * traits::num_buckets);
+
+  ::cuda::std::size_t* histograms_ptr = thrust::raw_pointer_cast(histograms.data());
+
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  for (unsigned int pass = 0; pass < traits::num_passes; ++pass)
+  {
+    const bool shuffled =
+      flip
+        ? radix_sort_pass<HasValues, Descending>(keys2, vals2, keys1, vals1, n, interval_size, pass, histograms_ptr)
+        : radix_sort_pass<HasValues, Descending>(keys1, vals1, keys2, vals2, n, interval_size, pass, histograms_ptr);
+
+    flip = shuffled ? !flip : flip;
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
+
+    if constexpr (HasValues)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
+    }
+  }
+}
+
+} // namespace radix_sort_detail
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
 void stable_sort(
   execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
 {
   using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
-  thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
+  // primitive keys are radix sorted
+  if constexpr (thrust::system::detail::internal::use_radix_sort<key_type, StrictWeakOrdering>::value)
+  {
+    constexpr bool descending =
+      thrust::system::detail::internal::radix_sort_is_descending<key_type, StrictWeakOrdering>::value;
+
+    const auto n = ::cuda::std::distance(first, last);
+
+    thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, n);
+
+    radix_sort_detail::radix_sort<false, descending>(
+      exec, first, temp.begin(), static_cast<int*>(0), static_cast<int*>(0), n);
+  }
+  else
+  {
+    thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
-  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+    sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  }
 }
 
 template <typename DerivedPolicy,
@@ -281,12 +464,28 @@ void stable_sort_by_key(
   using key_type = thrust::detail::it_value_t<RandomAccessIterator1>;
   using val_type = thrust::detail::it_value_t<RandomAccessIterator2>;
 
-  RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
+  // primitive keys are radix sorted
+  if constexpr (thrust::system::detail::internal::use_radix_sort<key_type, StrictWeakOrdering>::value)
+  {
+    constexpr bool descending =
+      thrust::system::detail::internal::radix_sort_is_descending<key_type, StrictWeakOrdering>::value;
 
-  thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
-  thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
+    const auto n = ::cuda::std::distance(first1, last1);
 
-  sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+    thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, n);
+    thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, n);
+
+    radix_sort_detail::radix_sort<true, descending>(exec, first1, temp1.begin(), first2, temp2.begin(), n);
+  }
+  else
+  {
+    RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
+
+    thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
+    thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
+
+    sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+  }
 }
 
 } // end namespace detail